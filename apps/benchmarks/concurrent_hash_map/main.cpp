@@ -0,0 +1,272 @@
+#include "le_backend_vk/le_concurrent_hash_map.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Stress test and microbenchmark for ConcurrentHashMap, the map which backs the
+// pipeline manager's caches for pipelines, pipeline layouts, descriptor set layouts,
+// and shader modules.
+//
+// The stress test has all threads insert and look up objects while the map grows,
+// and checks that every inserted object can be found, and that objects never move.
+//
+// The benchmark compares lookup throughput against the map which ConcurrentHashMap
+// replaced: a std::unordered_map guarded by a std::shared_mutex.
+//
+// Checks stay active in release builds - run with `--quick` for a shorter run.
+
+#define CHECK( condition )                                                                               \
+	do {                                                                                                 \
+		if ( !( condition ) ) {                                                                          \
+			fprintf( stderr, "CHECK FAILED: %s (%s:%d)\n", #condition, __FILE__, __LINE__ );            \
+			fflush( stderr );                                                                            \
+			std::abort();                                                                                \
+		}                                                                                                \
+	} while ( 0 )
+
+constexpr uint32_t NUM_THREADS = 16;
+
+// ----------------------------------------------------------------------
+
+struct Value {
+	uint64_t key;
+	uint64_t check; // always ~key - lets us detect torn, or misplaced objects
+};
+
+// ----------------------------------------------------------------------
+// Keys in the pipeline manager are hash values - we generate keys which look alike.
+static uint64_t make_key( uint64_t i ) {
+	uint64_t z = ( i + 1 ) * 0x9e3779b97f4a7c15ull; // splitmix64
+	z          = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+	z          = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+	return z ^ ( z >> 31 );
+}
+
+// ----------------------------------------------------------------------
+
+static uint64_t xorshift64( uint64_t &state ) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+// ----------------------------------------------------------------------
+// The map which ConcurrentHashMap replaced in le_pipeline.cpp - kept here as a baseline.
+template <typename T>
+class SharedMutexHashMap : NoCopy, NoMove {
+
+	struct IdentityHash {
+		size_t operator()( uint64_t const &key ) const noexcept {
+			return size_t( key );
+		}
+	};
+
+	mutable std::shared_mutex                       mtx;
+	std::unordered_map<uint64_t, T *, IdentityHash> store; // owning
+
+  public:
+	T *find( uint64_t key ) const {
+		std::shared_lock lock( mtx );
+		auto             it = store.find( key );
+		return it == store.end() ? nullptr : it->second;
+	}
+
+	bool try_insert( uint64_t key, T const &obj ) {
+		std::unique_lock lock( mtx );
+		auto             result = store.emplace( key, nullptr );
+		if ( result.second ) {
+			result.first->second = new T( obj );
+		}
+		return result.second;
+	}
+
+	~SharedMutexHashMap() {
+		for ( auto &e : store ) {
+			delete e.second;
+		}
+	}
+};
+
+// ----------------------------------------------------------------------
+// Runs `fun( thread_index )` on NUM_THREADS threads, which all start at the same time.
+// Returns wall-clock time in seconds, measured from start until the last thread has finished.
+template <typename F>
+static double run_threads( F &&fun ) {
+
+	std::atomic<uint32_t> ready{ 0 };
+	std::atomic<bool>     go{ false };
+
+	std::vector<std::thread> threads;
+	threads.reserve( NUM_THREADS );
+
+	for ( uint32_t t = 0; t != NUM_THREADS; t++ ) {
+		threads.emplace_back( [ &, t ]() {
+			ready++;
+			while ( !go.load( std::memory_order_acquire ) ) {
+				std::this_thread::yield();
+			}
+			fun( t );
+		} );
+	}
+
+	while ( ready.load() != NUM_THREADS ) {
+		std::this_thread::yield();
+	}
+
+	auto t_start = std::chrono::steady_clock::now();
+	go.store( true, std::memory_order_release );
+
+	for ( auto &t : threads ) {
+		t.join();
+	}
+
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - t_start ).count();
+}
+
+// ----------------------------------------------------------------------
+// Every key gets inserted by two threads concurrently, so that some insertions race
+// and must fail. Between insertions, each thread looks up keys which it has seen
+// before - these must be found at the same address, even if the map has grown since.
+static void stress_test( uint32_t num_keys ) {
+
+	ConcurrentHashMap<Value> map;
+
+	uint32_t const keys_per_segment = num_keys / NUM_THREADS;
+
+	// Address at which each thread has seen each key of its two segments.
+	std::vector<std::vector<Value *>> seen( NUM_THREADS );
+	std::atomic<uint64_t>             num_inserted{ 0 };
+
+	double seconds = run_threads( [ & ]( uint32_t t ) {
+		auto &   pointers = seen[ t ];
+		uint64_t rng      = 0x2545f4914f6cdd1dull + t;
+		uint64_t inserted = 0;
+
+		pointers.resize( 2 * keys_per_segment );
+
+		for ( uint32_t i = 0; i != 2 * keys_per_segment; i++ ) {
+
+			// First segment is this thread's own, second segment is its neighbour's.
+			uint32_t segment = ( i < keys_per_segment ) ? t : ( t + 1 ) % NUM_THREADS;
+			uint64_t key     = make_key( segment * keys_per_segment + i % keys_per_segment );
+
+			if ( map.try_insert( key, Value{ key, ~key } ) ) {
+				inserted++;
+			}
+
+			Value *obj = map.find( key );
+			CHECK( obj != nullptr );
+			CHECK( obj->key == key && obj->check == ~key );
+			pointers[ i ] = obj;
+
+			// Look up a few keys which this thread has seen before.
+			for ( int j = 0; j != 4; j++ ) {
+				uint32_t k         = uint32_t( xorshift64( rng ) % ( i + 1 ) );
+				uint32_t k_segment = ( k < keys_per_segment ) ? t : ( t + 1 ) % NUM_THREADS;
+				uint64_t k_key     = make_key( k_segment * keys_per_segment + k % keys_per_segment );
+				Value *  k_obj     = map.find( k_key );
+				CHECK( k_obj == pointers[ k ] ); // objects must never move
+				CHECK( k_obj->key == k_key && k_obj->check == ~k_key );
+			}
+		}
+
+		num_inserted += inserted;
+	} );
+
+	// Each key must have been inserted exactly once.
+	CHECK( num_inserted == uint64_t( keys_per_segment ) * NUM_THREADS );
+
+	// Both threads which inserted a key must have seen it at the same address, which is
+	// where the map still keeps it.
+	for ( uint32_t t = 0; t != NUM_THREADS; t++ ) {
+		uint32_t neighbour = ( t + 1 ) % NUM_THREADS;
+		for ( uint32_t i = 0; i != keys_per_segment; i++ ) {
+			uint64_t key = make_key( neighbour * keys_per_segment + i );
+			CHECK( seen[ t ][ keys_per_segment + i ] == seen[ neighbour ][ i ] );
+			CHECK( map.find( key ) == seen[ t ][ keys_per_segment + i ] );
+		}
+	}
+
+	printf( "stress test: %u threads, %u keys, each inserted twice concurrently: ok (%.1f ms)\n",
+	        NUM_THREADS, keys_per_segment * NUM_THREADS, seconds * 1000.0 );
+}
+
+// ----------------------------------------------------------------------
+// Measures lookup throughput for NUM_THREADS threads which look up keys from a populated map.
+// If `insert_every` is not 0, each thread inserts a new key after every `insert_every` lookups.
+template <typename Map>
+static double measure_lookups( uint32_t num_keys, uint64_t lookups_per_thread, uint64_t insert_every ) {
+
+	Map map;
+
+	for ( uint32_t i = 0; i != num_keys; i++ ) {
+		uint64_t key = make_key( i );
+		map.try_insert( key, Value{ key, ~key } );
+	}
+
+	std::atomic<uint64_t> checksum{ 0 };
+
+	double seconds = run_threads( [ & ]( uint32_t t ) {
+		uint64_t rng        = 0x9e3779b97f4a7c15ull + t;
+		uint64_t sum        = 0;
+		uint64_t next_index = num_keys + t; // keys which this thread inserts
+
+		for ( uint64_t i = 0; i != lookups_per_thread; i++ ) {
+			uint64_t key = make_key( xorshift64( rng ) % num_keys );
+			Value *  obj = map.find( key );
+			CHECK( obj != nullptr );
+			sum += obj->check;
+
+			if ( insert_every && ( i % insert_every ) == 0 ) {
+				uint64_t new_key = make_key( next_index );
+				map.try_insert( new_key, Value{ new_key, ~new_key } );
+				next_index += NUM_THREADS;
+			}
+		}
+
+		checksum += sum;
+	} );
+
+	CHECK( checksum != 0 ); // keeps lookups from being optimised away
+
+	return double( lookups_per_thread ) * NUM_THREADS / seconds;
+}
+
+// ----------------------------------------------------------------------
+
+static void benchmark( char const *label, uint32_t num_keys, uint64_t lookups_per_thread, uint64_t insert_every ) {
+
+	double baseline   = measure_lookups<SharedMutexHashMap<Value>>( num_keys, lookups_per_thread, insert_every );
+	double concurrent = measure_lookups<ConcurrentHashMap<Value>>( num_keys, lookups_per_thread, insert_every );
+
+	printf( "%-34s %12.1f %12.1f %8.2fx\n", label, baseline / 1e6, concurrent / 1e6, concurrent / baseline );
+}
+
+// ----------------------------------------------------------------------
+
+int main( int argc, char const *argv[] ) {
+
+	bool quick = ( argc > 1 && 0 == strcmp( argv[ 1 ], "--quick" ) );
+
+	stress_test( quick ? ( 1u << 14 ) : ( 1u << 18 ) );
+
+	uint64_t const lookups_per_thread = quick ? ( 1u << 16 ) : ( 1u << 22 );
+
+	printf( "\nlookup throughput, %u threads, million lookups/s:\n", NUM_THREADS );
+	printf( "%-34s %12s %12s %9s\n", "", "shared_mutex", "lock-free", "speedup" );
+
+	// Typical pipeline manager cache sizes are in the hundreds to low thousands of entries.
+	benchmark( "256 keys, lookups only", 256, lookups_per_thread, 0 );
+	benchmark( "4096 keys, lookups only", 4096, lookups_per_thread, 0 );
+	benchmark( "4096 keys, 1 insert / 1000 lookups", 4096, lookups_per_thread, 1000 );
+
+	return 0;
+}
@@ -0,0 +1,179 @@
+// We compile the encoder module straight into this benchmark, so that we can
+// reach its (static) pool functions without loading le_renderer.
+#include "le_renderer/le_command_buffer_encoder.cpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Allocation test and benchmark for the command buffer encoder pool.
+//
+// Each frame, the renderer acquires one encoder per render pass from the pool, records
+// commands into pooled command stream chunks, and resets the pool once the backend
+// has processed the frame. Once the pool has warmed up, this must not allocate.
+//
+// We replay a frame loop with a varying number of encoders and commands per frame,
+// and check that - after warm-up - neither the pool's chunk count, nor its heap
+// allocation count, nor the number of calls to global operator new change from
+// frame to frame.
+
+#define CHECK( condition )                                                                               \
+	do {                                                                                                 \
+		if ( !( condition ) ) {                                                                          \
+			fprintf( stderr, "CHECK FAILED: %s (%s:%d)\n", #condition, __FILE__, __LINE__ );            \
+			fflush( stderr );                                                                            \
+			std::abort();                                                                                \
+		}                                                                                                \
+	} while ( 0 )
+
+// ----------------------------------------------------------------------
+// Counts every call to global operator new, so that we catch allocations which the
+// pool's own heap allocation count does not know about.
+
+static std::atomic<uint64_t> g_operator_new_count{ 0 };
+
+void *operator new( size_t sz ) {
+	g_operator_new_count.fetch_add( 1, std::memory_order_relaxed );
+	void *p = malloc( sz ? sz : 1 );
+	if ( p == nullptr ) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete( void *p ) noexcept {
+	free( p );
+}
+
+void operator delete( void *p, size_t ) noexcept {
+	free( p );
+}
+
+// ----------------------------------------------------------------------
+// Stand-ins for the le_core entry points which le_command_buffer_encoder.cpp refers to.
+// The encoder module only loads le_renderer (itself) and le_backend_vk statically - and
+// neither is called into by the commands which this benchmark records.
+
+extern "C" void *le_core_load_module_static( char const *, void ( *module_reg_fun )( void * ), uint64_t api_size_in_bytes ) {
+	void *api = calloc( 1, api_size_in_bytes );
+	module_reg_fun( api );
+	return api;
+}
+
+LE_MODULE_REGISTER_IMPL( le_renderer, api ) {
+	register_le_command_buffer_encoder_api( api );
+}
+
+LE_MODULE_REGISTER_IMPL( le_backend_vk, api ) {
+	// nothing to do - the benchmark does not call into the backend.
+}
+
+// ----------------------------------------------------------------------
+// Describes the shape of a frame: how many passes (encoders), and how many draws each pass records.
+struct FrameShape {
+	uint32_t num_encoders;
+	uint32_t draws_per_encoder;
+};
+
+// Frames cycle through these shapes, so that encoders get re-used with both more and
+// fewer commands than they held in the previous frame. The largest shape spans several
+// command stream chunks per encoder.
+static constexpr FrameShape FRAME_SHAPES[] = {
+    { 4, 500 },
+    { 12, 4000 },
+    { 1, 20 },
+    { 8, 12000 },
+};
+
+static constexpr size_t NUM_FRAME_SHAPES = sizeof( FRAME_SHAPES ) / sizeof( FRAME_SHAPES[ 0 ] );
+
+// ----------------------------------------------------------------------
+// Records one frame into encoders acquired from pool, then resets the pool, as the
+// renderer does once a frame has been processed. Returns number of commands recorded.
+static size_t record_frame( le_command_buffer_encoder_pool_o *pool, FrameShape const &shape ) {
+
+	size_t num_commands = 0;
+
+	for ( uint32_t e = 0; e != shape.num_encoders; e++ ) {
+
+		// Commands recorded here need no transient allocator, pipeline manager, or staging
+		// allocator - these would be owned by the backend frame, not by the pool.
+		auto encoder = encoder_pool_acquire( pool, nullptr, nullptr, nullptr, { 1024, 768 } );
+
+		for ( uint32_t i = 0; i != shape.draws_per_encoder; i++ ) {
+			// Scissors and line widths differ per draw, so that they are not elided as redundant.
+			le::Rect2D scissor = { i & 63, e, 1024 - ( i & 63 ), 768 };
+			cbe_set_scissor( encoder, 0, 1, &scissor );
+			cbe_set_line_width( encoder, 1.f + float( i & 7 ) );
+			cbe_draw( encoder, 6, 1, 0, i );
+		}
+
+		num_commands += encoder->mCommandCount;
+	}
+
+	encoder_pool_reset( pool );
+
+	return num_commands;
+}
+
+// ----------------------------------------------------------------------
+
+int main( int argc, char const **argv ) {
+
+	bool quick = ( argc > 1 && 0 == strcmp( argv[ 1 ], "--quick" ) );
+
+	size_t const num_steady_frames = quick ? 200 : 5000;
+
+	auto pool = encoder_pool_create();
+
+	// Warm-up: one full cycle of frame shapes lets every encoder grow to the
+	// largest number of chunks which it will ever need.
+
+	for ( size_t f = 0; f != NUM_FRAME_SHAPES; f++ ) {
+		record_frame( pool, FRAME_SHAPES[ f ] );
+	}
+
+	uint64_t const chunks_after_warmup           = pool->chunks_allocated;
+	uint64_t const heap_allocations_after_warmup = encoder_pool_get_heap_allocation_count( pool );
+	uint64_t const operator_new_after_warmup     = g_operator_new_count.load();
+
+	printf( "warm-up: %zu frames, %zu encoders, %zu chunks (%zu KB), %llu heap allocations\n",
+	        NUM_FRAME_SHAPES,
+	        pool->encoders.size(),
+	        size_t( chunks_after_warmup ),
+	        size_t( chunks_after_warmup * LE_COMMAND_STREAM_CHUNK_SIZE / 1024 ),
+	        ( unsigned long long )heap_allocations_after_warmup );
+
+	// ---------| invariant: pool has warmed up, steady-state frames must not allocate
+
+	size_t total_commands = 0;
+
+	auto t_start = std::chrono::high_resolution_clock::now();
+
+	for ( size_t f = 0; f != num_steady_frames; f++ ) {
+		total_commands += record_frame( pool, FRAME_SHAPES[ f % NUM_FRAME_SHAPES ] );
+
+		CHECK( pool->chunks_allocated == chunks_after_warmup );
+		CHECK( encoder_pool_get_heap_allocation_count( pool ) == heap_allocations_after_warmup );
+	}
+
+	auto t_end = std::chrono::high_resolution_clock::now();
+
+	CHECK( g_operator_new_count.load() == operator_new_after_warmup );
+
+	double elapsed_ms = std::chrono::duration<double, std::milli>( t_end - t_start ).count();
+
+	printf( "steady state: %zu frames, %zu commands in %.2f ms (%.2f ns per command), 0 new chunks, 0 heap allocations\n",
+	        num_steady_frames,
+	        total_commands,
+	        elapsed_ms,
+	        elapsed_ms * 1e6 / double( total_commands ) );
+
+	encoder_pool_destroy( pool );
+
+	printf( "OK\n" );
+
+	return 0;
+}
@@ -0,0 +1,338 @@
+#include "le_renderer/private/le_renderer_types.h"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Before/after benchmark for resource handles: compares the 40 byte handle which
+// stored its debug name inline against the current 64 bit handle, whose name lives
+// in the resource name registry.
+//
+// There is no Vulkan device here, so rather than calling into le_rendergraph and
+// le_backend_vk, the benchmark replays the loops which touch handles most often,
+// with the same data structures:
+//
+// + rendergraph build: passes declare resources; rendergraph_build() translates passes
+//   into tasks by linear search through an array of unique handles.
+// + backend processing: per-frame resource map lookups and inserts (as for the sync chain
+//   table), sorted per-pass used resources, and commands which embed handles being
+//   written to, and read back from a command stream.
+//
+// Both handle types share the same code - only their size differs.
+
+#define CHECK( condition )                                                                               \
+	do {                                                                                                 \
+		if ( !( condition ) ) {                                                                          \
+			fprintf( stderr, "CHECK FAILED: %s (%s:%d)\n", #condition, __FILE__, __LINE__ );            \
+			fflush( stderr );                                                                            \
+			std::abort();                                                                                \
+		}                                                                                                \
+	} while ( 0 )
+
+// ----------------------------------------------------------------------
+// Resource handle as it was before names moved to the registry: 64 bit payload,
+// followed by a 32 byte inline name.
+struct le_resource_handle_with_name_t {
+	le_resource_handle_t::Handle handle;
+	char                         debug_name[ 32 ];
+};
+
+static_assert( sizeof( le_resource_handle_with_name_t ) == 40, "legacy resource handle must be 40 bytes of size." );
+
+static inline bool operator==( le_resource_handle_with_name_t const &lhs, le_resource_handle_with_name_t const &rhs ) noexcept {
+	return lhs.handle.as_data == rhs.handle.as_data;
+}
+
+// ----------------------------------------------------------------------
+
+template <typename H>
+static H make_handle( uint32_t i, LeResourceType type ) {
+	char name[ 32 ];
+	snprintf( name, sizeof( name ), "benchmark_resource_%u", i );
+	H h{};
+	h.handle.as_handle.name_hash         = hash_32_fnv1a_const( name );
+	h.handle.as_handle.meta.as_meta.type = type;
+	if constexpr ( sizeof( H ) > sizeof( uint64_t ) ) {
+		strncpy( h.debug_name, name, sizeof( h.debug_name ) - 1 );
+	}
+	return h;
+}
+
+// ----------------------------------------------------------------------
+
+static uint64_t xorshift64( uint64_t &state ) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+// ----------------------------------------------------------------------
+// Describes the shape of a frame: how many passes, and how many resources each pass uses.
+struct FrameShape {
+	char const *label;
+	uint32_t    num_passes;
+	uint32_t    resources_per_pass;
+	uint32_t    num_unique_resources;
+	uint32_t    commands_per_pass;
+};
+
+// ----------------------------------------------------------------------
+
+template <typename H>
+struct Pass {
+	std::vector<H>        resources;              // as in le_renderpass_o::resources
+	std::vector<uint32_t> resources_access_flags; // 1: read, 2: write
+	std::vector<H>        used_resources;         // as in LeRenderPass::used_resources
+};
+
+// Command with embedded resource handle, laid out like le::CommandBindVertexBuffers
+// followed by its payload.
+template <typename H>
+struct CommandBindBuffer {
+	uint32_t type;
+	uint32_t size;
+	uint32_t first_binding;
+	uint32_t binding_count;
+	H        buffer;
+	uint64_t offset;
+};
+
+// ----------------------------------------------------------------------
+// Open addressing map, keyed by resource handle, as FrameResourceMap in le_backend_vk.
+template <typename H, typename T>
+class FrameResourceMap {
+	std::vector<std::pair<H, T>> entries;
+	std::vector<uint32_t>        slots; // 0: empty, otherwise index into entries + 1
+	size_t                       count = 0;
+
+	size_t slot_for( H const &key ) const noexcept {
+		return size_t( ( key.handle.as_data * 11400714819323198485ull ) >> 32 ) & ( slots.size() - 1 );
+	}
+
+  public:
+	void clear() noexcept {
+		for ( size_t i = 0; i != count; i++ ) {
+			entries[ i ].second.clear();
+		}
+		count = 0;
+		std::fill( slots.begin(), slots.end(), 0 );
+	}
+
+	T &operator[]( H const &key ) {
+		if ( ( count + 1 ) * 2 > slots.size() ) {
+			std::vector<uint32_t> new_slots( std::max<size_t>( 64, slots.size() * 2 ), 0 );
+			slots.swap( new_slots );
+			for ( uint32_t i = 0; i != count; i++ ) {
+				size_t s = slot_for( entries[ i ].first );
+				while ( slots[ s ] != 0 ) {
+					s = ( s + 1 ) & ( slots.size() - 1 );
+				}
+				slots[ s ] = i + 1;
+			}
+		}
+		size_t s = slot_for( key );
+		for ( ; slots[ s ] != 0; s = ( s + 1 ) & ( slots.size() - 1 ) ) {
+			if ( entries[ slots[ s ] - 1 ].first == key ) {
+				return entries[ slots[ s ] - 1 ].second;
+			}
+		}
+		if ( count == entries.size() ) {
+			entries.emplace_back();
+		}
+		entries[ count ].first = key;
+		slots[ s ]             = uint32_t( ++count );
+		return entries[ count - 1 ].second;
+	}
+
+	size_t size() const noexcept {
+		return count;
+	}
+};
+
+// ----------------------------------------------------------------------
+
+template <typename H>
+struct Frame {
+	std::vector<Pass<H>>                       passes;
+	FrameResourceMap<H, std::vector<uint32_t>> sync_chain_table;
+	std::vector<char>                          command_stream;
+	std::vector<std::bitset<4096>>             task_reads;
+	std::vector<std::bitset<4096>>             task_writes;
+	std::array<H, 4096>                        unique_handles; // as in rendergraph_build
+};
+
+// ----------------------------------------------------------------------
+// Passes declare their resources, and get translated into tasks.
+template <typename H>
+static uint64_t rendergraph_build( Frame<H> &frame, FrameShape const &shape, std::vector<H> const &handles, uint64_t &rng ) {
+
+	frame.passes.resize( shape.num_passes );
+
+	for ( auto &p : frame.passes ) {
+		p.resources.clear();
+		p.resources_access_flags.clear();
+		for ( uint32_t i = 0; i != shape.resources_per_pass; i++ ) {
+			p.resources.push_back( handles[ xorshift64( rng ) % shape.num_unique_resources ] );
+			p.resources_access_flags.push_back( 1 + uint32_t( xorshift64( rng ) & 1 ) );
+		}
+	}
+
+	frame.task_reads.assign( shape.num_passes, {} );
+	frame.task_writes.assign( shape.num_passes, {} );
+
+	size_t num_unique = 0;
+
+	for ( uint32_t pass_index = 0; pass_index != shape.num_passes; pass_index++ ) {
+		auto const &p = frame.passes[ pass_index ];
+		for ( size_t i = 0; i != p.resources.size(); i++ ) {
+			size_t res_idx = 0;
+			for ( auto r = frame.unique_handles.data(); res_idx != num_unique; res_idx++, r++ ) {
+				if ( *r == p.resources[ i ] ) {
+					break;
+				}
+			}
+			if ( res_idx == num_unique ) {
+				frame.unique_handles[ res_idx ] = p.resources[ i ];
+				num_unique++;
+			}
+			if ( p.resources_access_flags[ i ] & 1 ) {
+				frame.task_reads[ pass_index ].set( res_idx );
+			} else {
+				frame.task_writes[ pass_index ].set( res_idx );
+			}
+		}
+	}
+
+	return num_unique;
+}
+
+// ----------------------------------------------------------------------
+// Resource states get tracked per frame, passes record commands which refer to resources,
+// and the backend walks the command stream.
+template <typename H>
+static uint64_t backend_process( Frame<H> &frame, FrameShape const &shape ) {
+
+	frame.sync_chain_table.clear();
+	frame.command_stream.clear();
+
+	uint32_t state = 0;
+
+	for ( auto &p : frame.passes ) {
+
+		for ( auto const &r : p.resources ) {
+			frame.sync_chain_table[ r ].push_back( state++ );
+		}
+
+		p.used_resources = p.resources;
+		std::sort( p.used_resources.begin(), p.used_resources.end(), []( H const &lhs, H const &rhs ) {
+			return lhs.handle.as_data < rhs.handle.as_data;
+		} );
+		p.used_resources.erase( std::unique( p.used_resources.begin(), p.used_resources.end() ), p.used_resources.end() );
+
+		for ( uint32_t i = 0; i != shape.commands_per_pass; i++ ) {
+			CommandBindBuffer<H> cmd{};
+			cmd.type          = 1;
+			cmd.size          = sizeof( cmd );
+			cmd.binding_count = 1;
+			cmd.buffer        = p.used_resources[ i % p.used_resources.size() ];
+			cmd.offset        = i;
+			size_t offset     = frame.command_stream.size();
+			frame.command_stream.resize( offset + sizeof( cmd ) );
+			memcpy( frame.command_stream.data() + offset, &cmd, sizeof( cmd ) );
+		}
+	}
+
+	uint64_t checksum = 0;
+
+	for ( size_t offset = 0; offset < frame.command_stream.size(); ) {
+		CommandBindBuffer<H> cmd;
+		memcpy( &cmd, frame.command_stream.data() + offset, sizeof( cmd ) );
+		checksum += frame.sync_chain_table[ cmd.buffer ].size() + cmd.offset;
+		offset += cmd.size;
+	}
+
+	return checksum + frame.sync_chain_table.size();
+}
+
+// ----------------------------------------------------------------------
+
+struct Timings {
+	double build_us;
+	double process_us;
+	size_t stream_bytes;
+};
+
+template <typename H>
+static Timings measure( FrameShape const &shape, uint32_t num_frames ) {
+
+	std::vector<H> handles;
+	for ( uint32_t i = 0; i != shape.num_unique_resources; i++ ) {
+		handles.push_back( make_handle<H>( i, ( i & 1 ) ? LeResourceType::eImage : LeResourceType::eBuffer ) );
+	}
+
+	auto     frame    = std::make_unique<Frame<H>>();
+	uint64_t checksum = 0;
+	double   build    = 0;
+	double   process  = 0;
+
+	for ( uint32_t f = 0; f != num_frames; f++ ) {
+		uint64_t rng = 0x2545f4914f6cdd1dull + f; // same frames for both handle types
+
+		auto t_0 = std::chrono::steady_clock::now();
+		checksum += rendergraph_build( *frame, shape, handles, rng );
+		auto t_1 = std::chrono::steady_clock::now();
+		checksum += backend_process( *frame, shape );
+		auto t_2 = std::chrono::steady_clock::now();
+
+		build += std::chrono::duration<double, std::micro>( t_1 - t_0 ).count();
+		process += std::chrono::duration<double, std::micro>( t_2 - t_1 ).count();
+	}
+
+	CHECK( checksum != 0 ); // keeps work from being optimised away
+
+	return { build / num_frames, process / num_frames, frame->command_stream.size() };
+}
+
+// ----------------------------------------------------------------------
+
+static void benchmark( FrameShape const &shape, uint32_t num_frames ) {
+
+	Timings before = measure<le_resource_handle_with_name_t>( shape, num_frames );
+	Timings after  = measure<le_resource_handle_t>( shape, num_frames );
+
+	printf( "%-28s %-8s %10.2f %10.2f %8.2fx\n", shape.label, "build", before.build_us, after.build_us, before.build_us / after.build_us );
+	printf( "%-28s %-8s %10.2f %10.2f %8.2fx\n", "", "process", before.process_us, after.process_us, before.process_us / after.process_us );
+	printf( "%-28s %-8s %10zu %10zu\n", "", "cmd bytes", before.stream_bytes, after.stream_bytes );
+}
+
+// ----------------------------------------------------------------------
+
+int main( int argc, char const *argv[] ) {
+
+	bool quick = ( argc > 1 && 0 == strcmp( argv[ 1 ], "--quick" ) );
+
+	uint32_t const num_frames = quick ? 100 : 10000;
+
+	printf( "resource handle: %zu bytes before, %zu bytes after\n", sizeof( le_resource_handle_with_name_t ), sizeof( le_resource_handle_t ) );
+	printf( "mean time per frame, us, over %u frames:\n", num_frames );
+	printf( "%-28s %-8s %10s %10s %9s\n", "", "", "before", "after", "speedup" );
+
+	FrameShape shapes[] = {
+	    { "8 passes, 64 resources", 8, 6, 64, 32 },
+	    { "32 passes, 256 resources", 32, 12, 256, 128 },
+	    { "128 passes, 1024 resources", 128, 16, 1024, 256 },
+	};
+
+	for ( auto const &shape : shapes ) {
+		benchmark( shape, num_frames );
+	}
+
+	return 0;
+}
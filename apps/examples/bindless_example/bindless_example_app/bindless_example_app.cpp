@@ -0,0 +1,253 @@
+#include "bindless_example_app.h"
+
+#include "le_window/le_window.h"
+#include "le_renderer/le_renderer.h"
+#include "le_pipeline_builder/le_pipeline_builder.h"
+
+#include <iostream>
+#include <vector>
+
+// This example shows how to use bindless mode: textures get registered once, and each
+// registered texture receives a stable index into the bindless set's array of textures.
+// Shaders then select textures by index - here, each tile in a grid selects its texture
+// via a material id - instead of the app binding one texture argument per draw.
+
+constexpr uint32_t NUM_TEXTURES = 4;
+constexpr uint32_t TEXTURE_SIZE = 64; // width and height of each texture, in texels
+constexpr uint32_t CHECKER_SIZE = 8;  // width and height of each checker square, in texels
+constexpr uint32_t GRID_SIZE    = 8;  // must match GRID_SIZE in tiles.vert
+constexpr uint32_t NUM_TILES    = GRID_SIZE * GRID_SIZE;
+
+static char const *TEXTURE_NAMES[ NUM_TEXTURES ] = {
+    "bindless_texture_0",
+    "bindless_texture_1",
+    "bindless_texture_2",
+    "bindless_texture_3",
+};
+
+static const le_resource_handle_t TEXTURE_IMG_HANDLES[ NUM_TEXTURES ] = {
+    LE_IMG_RESOURCE( TEXTURE_NAMES[ 0 ] ),
+    LE_IMG_RESOURCE( TEXTURE_NAMES[ 1 ] ),
+    LE_IMG_RESOURCE( TEXTURE_NAMES[ 2 ] ),
+    LE_IMG_RESOURCE( TEXTURE_NAMES[ 3 ] ),
+};
+
+struct bindless_example_app_o {
+	le::Window   window;
+	le::Renderer renderer;
+	uint64_t     frame_counter = 0;
+
+	le_texture_handle textures[ NUM_TEXTURES ];
+	uint32_t          texture_indices[ NUM_TEXTURES ]; // index of each texture in bindless set, as returned by registerBindlessTexture
+
+	std::vector<uint32_t> pixels[ NUM_TEXTURES ]; // rgba8 pixel data for each texture
+	bool                  textures_uploaded = false;
+
+	uint32_t material_ids[ NUM_TILES ]; // per tile: index into bindless set's textures array
+};
+
+// ----------------------------------------------------------------------
+
+static void app_initialize() {
+	le::Window::init();
+};
+
+// ----------------------------------------------------------------------
+
+static void app_terminate() {
+	le::Window::terminate();
+};
+
+// ----------------------------------------------------------------------
+// Fills `pixels` with a checkerboard pattern, alternating between `color` and black.
+static void generate_checkerboard( std::vector<uint32_t> &pixels, uint32_t color ) {
+	pixels.resize( TEXTURE_SIZE * TEXTURE_SIZE );
+	for ( uint32_t y = 0; y != TEXTURE_SIZE; y++ ) {
+		for ( uint32_t x = 0; x != TEXTURE_SIZE; x++ ) {
+			bool is_set                    = ( ( x / CHECKER_SIZE ) + ( y / CHECKER_SIZE ) ) & 1;
+			pixels[ y * TEXTURE_SIZE + x ] = is_set ? color : 0xff000000; // abgr
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
+static bindless_example_app_o *bindless_example_app_create() {
+	auto app = new ( bindless_example_app_o );
+
+	le::Window::Settings settings;
+	settings
+	    .setWidth( 640 )
+	    .setHeight( 640 )
+	    .setTitle( "Island // BindlessExampleApp" );
+
+	// create a new window
+	app->window.setup( settings );
+
+	// Bindless mode is opt-in - it must be enabled when the renderer gets set up.
+	app->renderer.setup( le::RendererInfoBuilder( app->window ).setBindlessDescriptors( true ).build() );
+
+	uint32_t const colors[ NUM_TEXTURES ] = {
+	    0xff3030ff, // red    (abgr)
+	    0xff30ff30, // green  (abgr)
+	    0xffff3030, // blue   (abgr)
+	    0xff30ffff, // yellow (abgr)
+	};
+
+	for ( uint32_t i = 0; i != NUM_TEXTURES; i++ ) {
+
+		generate_checkerboard( app->pixels[ i ], colors[ i ] );
+
+		app->textures[ i ] = le::Renderer::produceTextureHandle( TEXTURE_NAMES[ i ] );
+
+		// Registering a texture gives us its index in the bindless set - this index stays
+		// valid for as long as the renderer lives, so we only need to register once.
+		app->texture_indices[ i ] = app->renderer.registerBindlessTexture( app->textures[ i ] );
+
+		if ( app->texture_indices[ i ] == LE_BINDLESS_INDEX_INVALID ) {
+			std::cerr << "ERROR: Could not register texture " << i << " for bindless access." << std::endl
+			          << std::flush;
+			app->texture_indices[ i ] = 0;
+		}
+	}
+
+	// Assign a material to each tile - materials refer to textures via their bindless index.
+	for ( uint32_t i = 0; i != NUM_TILES; i++ ) {
+		uint32_t x             = i % GRID_SIZE;
+		uint32_t y             = i / GRID_SIZE;
+		app->material_ids[ i ] = app->texture_indices[ ( x * 3 + y * 5 + ( x * y ) ) % NUM_TEXTURES ];
+	}
+
+	return app;
+}
+
+// ----------------------------------------------------------------------
+
+static void pass_upload_exec( le_command_buffer_encoder_o *encoder_, void *user_data ) {
+	auto        app = static_cast<bindless_example_app_o *>( user_data );
+	le::Encoder encoder{ encoder_ };
+
+	// Upload texture data - but only once
+
+	if ( app->textures_uploaded ) {
+		return;
+	}
+
+	auto write_info = le::WriteToImageSettingsBuilder()
+	                      .setImageW( TEXTURE_SIZE )
+	                      .setImageH( TEXTURE_SIZE )
+	                      .build();
+
+	for ( uint32_t i = 0; i != NUM_TEXTURES; i++ ) {
+		encoder.writeToImage( TEXTURE_IMG_HANDLES[ i ], write_info, app->pixels[ i ].data(), app->pixels[ i ].size() * sizeof( uint32_t ) );
+	}
+
+	app->textures_uploaded = true;
+}
+
+// ----------------------------------------------------------------------
+
+static void pass_main_exec( le_command_buffer_encoder_o *encoder_, void *user_data ) {
+	auto        app = static_cast<bindless_example_app_o *>( user_data );
+	le::Encoder encoder{ encoder_ };
+
+	static auto shaderVert = app->renderer.createShaderModule( "./local_resources/shaders/tiles.vert", le::ShaderStage::eVertex );
+	static auto shaderFrag = app->renderer.createShaderModule( "./local_resources/shaders/tiles.frag", le::ShaderStage::eFragment );
+
+	static auto pipelineTiles =
+	    LeGraphicsPipelineBuilder( encoder.getPipelineManager() )
+	        .addShaderStage( shaderVert )
+	        .addShaderStage( shaderFrag )
+	        .build();
+
+	// Note that we don't set any texture arguments: the bindless set gets bound by the
+	// backend, and the shader picks textures by the material ids which we pass here.
+
+	encoder
+	    .bindGraphicsPipeline( pipelineTiles )
+	    .setArgumentData( LE_ARGUMENT_NAME( "Materials" ), app->material_ids, sizeof( app->material_ids ) )
+	    .draw( 6, NUM_TILES );
+}
+
+// ----------------------------------------------------------------------
+// This method gets updated once per frame
+static bool bindless_example_app_update( bindless_example_app_o *self ) {
+
+	// Polls events for all windows to see if we need to close window
+	le::Window::pollEvents();
+
+	if ( self->window.shouldClose() ) {
+		return false;
+	}
+
+	le::RenderModule mainModule{};
+
+	auto image_info =
+	    le::ImageInfoBuilder()
+	        .setExtent( TEXTURE_SIZE, TEXTURE_SIZE )
+	        .setUsageFlags( { LE_IMAGE_USAGE_TRANSFER_DST_BIT } )
+	        .setFormat( le::Format::eR8G8B8A8Unorm )
+	        .build();
+
+	le::RenderPass renderPassUpload{ "upload", LE_RENDER_PASS_TYPE_TRANSFER };
+
+	renderPassUpload.setExecuteCallback( self, pass_upload_exec );
+
+	for ( uint32_t i = 0; i != NUM_TEXTURES; i++ ) {
+		mainModule.declareResource( TEXTURE_IMG_HANDLES[ i ], image_info );
+		renderPassUpload.useImageResource( TEXTURE_IMG_HANDLES[ i ], { LE_IMAGE_USAGE_TRANSFER_DST_BIT } );
+	}
+
+	auto renderPassMain =
+	    le::RenderPass( "main" )
+	        .addColorAttachment( LE_SWAPCHAIN_IMAGE_HANDLE )
+	        .setExecuteCallback( self, pass_main_exec );
+
+	// Bindless textures must still be declared by any pass which samples them, so
+	// that they get synchronised, and so that the backend knows their image views.
+	for ( uint32_t i = 0; i != NUM_TEXTURES; i++ ) {
+		auto tex_info =
+		    le::ImageSamplerInfoBuilder()
+		        .withImageViewInfo()
+		        .setImage( TEXTURE_IMG_HANDLES[ i ] )
+		        .end()
+		        .withSamplerInfo()
+		        .setMagFilter( le::Filter::eNearest )
+		        .end()
+		        .build();
+
+		renderPassMain.sampleTexture( self->textures[ i ], tex_info );
+	}
+
+	mainModule
+	    .addRenderPass( renderPassUpload )
+	    .addRenderPass( renderPassMain );
+
+	self->renderer.update( mainModule );
+
+	self->frame_counter++;
+
+	return true; // keep app alive, false will quit app.
+}
+
+// ----------------------------------------------------------------------
+
+static void bindless_example_app_destroy( bindless_example_app_o *self ) {
+
+	delete ( self );
+}
+
+// ----------------------------------------------------------------------
+
+LE_MODULE_REGISTER_IMPL( bindless_example_app, api ) {
+
+	auto  bindless_example_app_api_i = static_cast<bindless_example_app_api *>( api );
+	auto &bindless_example_app_i     = bindless_example_app_api_i->bindless_example_app_i;
+
+	bindless_example_app_i.initialize = app_initialize;
+	bindless_example_app_i.terminate  = app_terminate;
+
+	bindless_example_app_i.create  = bindless_example_app_create;
+	bindless_example_app_i.destroy = bindless_example_app_destroy;
+	bindless_example_app_i.update  = bindless_example_app_update;
+}
@@ -0,0 +1,62 @@
+#ifndef GUARD_bindless_example_app_H
+#define GUARD_bindless_example_app_H
+#endif
+
+#include "le_core/le_core.h"
+
+// depends on le_backend_vk. le_backend_vk must be loaded before this class is used.
+
+struct bindless_example_app_o;
+
+// clang-format off
+struct bindless_example_app_api {
+
+	struct bindless_example_app_interface_t {
+		bindless_example_app_o * ( *create               )();
+		void         ( *destroy                  )( bindless_example_app_o *self );
+		bool         ( *update                   )( bindless_example_app_o *self );
+		void         ( *initialize               )(); // static methods
+		void         ( *terminate                )(); // static methods
+	};
+
+	bindless_example_app_interface_t bindless_example_app_i;
+};
+// clang-format on
+
+LE_MODULE( bindless_example_app );
+LE_MODULE_LOAD_DEFAULT( bindless_example_app );
+
+#ifdef __cplusplus
+
+namespace bindless_example_app {
+static const auto &api                 = bindless_example_app_api_i;
+static const auto &bindless_example_app_i = api -> bindless_example_app_i;
+} // namespace bindless_example_app
+
+class BindlessExampleApp : NoCopy, NoMove {
+
+	bindless_example_app_o *self;
+
+  public:
+	BindlessExampleApp()
+	    : self( bindless_example_app::bindless_example_app_i.create() ) {
+	}
+
+	bool update() {
+		return bindless_example_app::bindless_example_app_i.update( self );
+	}
+
+	~BindlessExampleApp() {
+		bindless_example_app::bindless_example_app_i.destroy( self );
+	}
+
+	static void initialize() {
+		bindless_example_app::bindless_example_app_i.initialize();
+	}
+
+	static void terminate() {
+		bindless_example_app::bindless_example_app_i.terminate();
+	}
+};
+
+#endif
@@ -0,0 +1,24 @@
+#version 450 core
+
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#extension GL_EXT_nonuniform_qualifier : require
+
+// inputs
+layout (location = 0) in vec2 inTexCoord;
+layout (location = 1) flat in uint inMaterialId;
+
+// Bindless set: a runtime-sized array of all textures which the app has registered
+// for bindless access. Any set which holds a runtime-sized array is laid out as the
+// bindless set - the backend binds it, we don't set it via arguments.
+layout (set = 0, binding = 0) uniform sampler2D textures[];
+
+// outputs
+layout (location = 0) out vec4 outFragColor;
+
+void main(){
+
+	// Material ids may differ between tiles drawn by the same draw call,
+	// which is why the index must be marked as non-uniform.
+	outFragColor = texture( textures[ nonuniformEXT( inMaterialId ) ], inTexCoord );
+}
@@ -0,0 +1,45 @@
+#version 450 core
+
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+// Draws a grid of tiles - one instance per tile, six vertices (two triangles) per tile.
+
+#define GRID_SIZE 8
+
+// inputs // Note: no inputs!
+
+// uniforms
+layout (set = 1, binding = 0) uniform Materials {
+	uvec4 material_ids[ GRID_SIZE * GRID_SIZE / 4 ]; // one material id per tile - material id is the index of the tile's texture in the bindless set
+};
+
+// outputs
+layout (location = 0) out vec2 outTexCoord;
+layout (location = 1) flat out uint outMaterialId;
+
+// Override the built-in fixed function outputs
+// to have more control over the SPIR-V code created.
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+const vec2 corners[ 6 ] = vec2[](
+	vec2( 0, 0 ), vec2( 1, 0 ), vec2( 0, 1 ),
+	vec2( 0, 1 ), vec2( 1, 0 ), vec2( 1, 1 )
+);
+
+void main()
+{
+	vec2 corner = corners[ gl_VertexIndex ];
+	vec2 tile   = vec2( gl_InstanceIndex % GRID_SIZE, gl_InstanceIndex / GRID_SIZE );
+
+	// leave a small gap between tiles
+	vec2 pos = ( tile + mix( vec2( 0.05 ), vec2( 0.95 ), corner ) ) / float( GRID_SIZE );
+
+	outTexCoord   = corner;
+	outMaterialId = material_ids[ gl_InstanceIndex / 4 ][ gl_InstanceIndex % 4 ];
+
+	gl_Position = vec4( pos * 2.0 - 1.0, 0.0, 1.0 );
+}
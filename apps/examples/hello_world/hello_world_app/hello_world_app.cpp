@@ -51,10 +51,10 @@ struct WorldGeometry {
 	bool                    wasLoaded            = false;
 };
 
-constexpr le_resource_handle_t imgEarthAlbedo  = LE_IMG_RESOURCE( "imgEarthAlbedo" );
-constexpr le_resource_handle_t imgEarthNight   = LE_IMG_RESOURCE( "imgEarthNight" );
-constexpr le_resource_handle_t imgEarthClouds  = LE_IMG_RESOURCE( "ImgEarthClouds" );
-constexpr le_resource_handle_t imgEarthNormals = LE_IMG_RESOURCE( "ImgEarthNormals" );
+static const le_resource_handle_t imgEarthAlbedo  = LE_IMG_RESOURCE( "imgEarthAlbedo" );
+static const le_resource_handle_t imgEarthNight   = LE_IMG_RESOURCE( "imgEarthNight" );
+static const le_resource_handle_t imgEarthClouds  = LE_IMG_RESOURCE( "ImgEarthClouds" );
+static const le_resource_handle_t imgEarthNormals = LE_IMG_RESOURCE( "ImgEarthNormals" );
 
 struct hello_world_app_o {
 	le::Window   window;
@@ -11,8 +11,8 @@
 #include <memory>
 #include <sstream>
 
-constexpr le_resource_handle_t SRC_IMG_HANDLE       = LE_IMG_RESOURCE( "src_image" );
-constexpr le_resource_handle_t COLOR_LUT_IMG_HANDLE = LE_IMG_RESOURCE( "color_lut_image" );
+static const le_resource_handle_t SRC_IMG_HANDLE       = LE_IMG_RESOURCE( "src_image" );
+static const le_resource_handle_t COLOR_LUT_IMG_HANDLE = LE_IMG_RESOURCE( "color_lut_image" );
 
 struct lut_grading_example_app_o {
 	le::Window   window;
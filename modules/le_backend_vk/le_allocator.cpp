@@ -5,57 +5,210 @@
 #include "le_renderer/private/le_renderer_types.h"
 #include "le_backend_vk/util/vk_mem_alloc/vk_mem_alloc.h"
 
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
 /*
 
 Linear sub-allocator
 
 	+ Hands out memory addresses which can be written to.
 
-	+ Memory must have been allocated and mapped before
+	+ Memory is allocated in blocks, each block is backed by its own buffer, and
+	persistently mapped. Blocks are allocated from the frame's VmaPool.
+
+	+ If the current block runs out of space, the allocator moves on to the next
+	block in its chain - and chains a new block if there is none left. Blocks
+	are kept across resets, so that a frame which needed more than one block
+	does not need to allocate again the next time around.
+
+	+ On reset, the allocator remembers how many bytes were used (its high-water
+	mark). If the first block is smaller than that, all blocks are replaced by
+	a single first block large enough to hold a frame's worth of allocations.
 
-	+ Memory must be associated to a buffer, but this association is done through
+	+ If a block can't be created, the allocator keeps the blocks which it already
+	has. An allocator may end up without any blocks: in that case allocations
+	fail - which callers must check for - until a block can be created.
+
+	+ Each block is associated with a buffer, but this association is done through
 	the resource-system, we only need to know the LE-api specific handle for the
-	buffer
+	buffer. The block index is stored in the upper byte of the handle's meta index,
+	the lower byte holds the index of the allocator.
 
 */
 
 struct le_allocator_o {
 
-	le_resource_handle_t resourceId = {}; // for transient allocators, this must contain index of transient allocator
+	struct Block {
+		VkBuffer          buffer     = nullptr;
+		VmaAllocation     allocation = nullptr;
+		VmaAllocationInfo allocationInfo{};
+	};
+
+	le_resource_handle_t resourceId = {}; // for transient allocators, this must contain index of transient allocator, and index of current block
 
-	uint8_t *bufferBaseMemoryAddress = nullptr; // mapped memory address
+	uint8_t *bufferBaseMemoryAddress = nullptr; // mapped memory address of current block
 	uint64_t bufferBaseOffsetInBytes = 0;       // offset into buffer for first address belonging to this allocator
-	uint64_t capacity                = 0;
-	uint64_t alignment               = 256; // 1<<8== 256, minimum allocation chunk size (should proabbly be VkPhysicalDeviceLimits::minTexelBufferOffsetAlignment - see bufferView offset "valid use" in Spec: 11.2 )
+	uint64_t capacity                = 0;       // capacity of current block
+	uint64_t alignment               = 256;     // 1<<8== 256, minimum allocation chunk size (should proabbly be VkPhysicalDeviceLimits::minTexelBufferOffsetAlignment - see bufferView offset "valid use" in Spec: 11.2 )
 
 	uint8_t *pData               = bufferBaseMemoryAddress; // address of last allocation, initially: (bufferBaseMemoryAddress + bufferBaseOffsetInBytes)
 	uint64_t bufferOffsetInBytes = bufferBaseOffsetInBytes;
+
+	VmaAllocator       vmaAllocator     = nullptr; // non-owning
+	VmaPool            pool             = nullptr; // non-owning, blocks are allocated from this pool
+	uint32_t           queueFamilyIndex = 0;       // | referenced by bufferCreateInfo
+	VkBufferCreateInfo bufferCreateInfo{};         // template for creating blocks, .size is ignored
+	uint64_t           maxBlockSize = 0;           // blocks must not be larger than the pool's block size
+
+	std::vector<Block> blocks;                // owning, blocks[0] is the first block
+	size_t             currentBlock      = 0; // index of block which currently serves allocations
+	uint64_t           bytesUsedInBlocks = 0; // bytes used in blocks before currentBlock since last reset
+	uint64_t           highWaterMark     = 0; // largest number of bytes used in between resets
 };
 
 // ----------------------------------------------------------------------
+// Creates a new block with capacity of at least numBytes, and chains it to the allocator.
+static bool allocator_create_block( le_allocator_o *self, uint64_t numBytes ) {
+
+	if ( self->blocks.size() > 0xff ) {
+		// we can't store more than 256 block indices in a resource handle.
+		return false;
+	}
+
+	VmaAllocationCreateInfo createInfo{};
+	createInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+	createInfo.pool  = self->pool; // Since we're allocating from a pool all fields but .flags will be taken from the pool
+
+	VkBufferCreateInfo bufferCreateInfo  = self->bufferCreateInfo;
+	bufferCreateInfo.size                = numBytes;
+	bufferCreateInfo.pQueueFamilyIndices = &self->queueFamilyIndex;
+
+	le_allocator_o::Block block{};
+
+	auto result = vmaCreateBuffer( self->vmaAllocator, &bufferCreateInfo, &createInfo, &block.buffer, &block.allocation, &block.allocationInfo );
+
+	if ( result != VK_SUCCESS ) {
+		return false;
+	}
+
+	self->blocks.emplace_back( block );
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+static void allocator_destroy_blocks( le_allocator_o *self ) {
+	for ( auto &b : self->blocks ) {
+		vmaDestroyBuffer( self->vmaAllocator, b.buffer, b.allocation ); // implicitly calls vmaFreeMemory()
+	}
+	self->blocks.clear();
+}
+
+// ----------------------------------------------------------------------
+// Makes block at index the current block - all further allocations will be served from this block.
+// If the allocator has no blocks, index must be 0, and the allocator is left without capacity.
+static void allocator_set_current_block( le_allocator_o *self, size_t index ) {
+
+	self->currentBlock = index;
+
+	if ( self->blocks.empty() ) {
+		assert( index == 0 && "allocator without blocks can only be set to block 0" );
+		self->bufferBaseMemoryAddress = nullptr;
+		self->bufferBaseOffsetInBytes = 0;
+		self->capacity                = 0;
+		self->pData                   = nullptr;
+		self->bufferOffsetInBytes     = 0;
+		return;
+	}
+
+	// ----------| invariant: block at index exists
+
+	auto const &block = self->blocks[ index ];
+
+	// Note that a block's buffer starts at the allocation's mapped address - allocationInfo.offset
+	// is the allocation's offset within device memory, which must not be applied to buffer offsets.
+	self->bufferBaseMemoryAddress = static_cast<uint8_t *>( block.allocationInfo.pMappedData );
+	self->bufferBaseOffsetInBytes = 0;
+	self->capacity                = block.allocationInfo.size;
 
-static void allocator_reset( le_allocator_o *self ) {
-	self->bufferOffsetInBytes = self->bufferBaseOffsetInBytes;
 	self->pData               = self->bufferBaseMemoryAddress + self->bufferBaseOffsetInBytes;
+	self->bufferOffsetInBytes = self->bufferBaseOffsetInBytes;
+
+	self->resourceId.handle.as_handle.meta.as_meta.index =
+	    uint16_t( ( self->resourceId.getIndex() & 0xff ) | ( index << 8 ) );
 }
 
 // ----------------------------------------------------------------------
+// Returns true if blocks were re-allocated - any buffers previously handed out are invalid in that case.
+static bool allocator_reset( le_allocator_o *self ) {
 
-static le_allocator_o *allocator_create( VmaAllocationInfo const *info, uint16_t alignment ) {
-	auto self = new le_allocator_o{};
+	uint64_t bytesUsed  = self->bytesUsedInBlocks + ( self->bufferOffsetInBytes - self->bufferBaseOffsetInBytes );
+	self->highWaterMark = std::max( self->highWaterMark, bytesUsed );
 
-	self->bufferBaseMemoryAddress = static_cast<uint8_t *>( info->pMappedData );
+	bool blocks_changed = false;
 
-	self->bufferBaseOffsetInBytes = info->offset;
-	self->capacity                = info->size;
-	self->alignment               = alignment;
+	// If the first block can't hold what we used, but could be made large enough, replace all
+	// blocks with a single first block of sufficient size - this means that the next frame
+	// won't have to chain blocks.
 
-	// -- Fetch resource handle of underlying buffer from VmaAllocation info
-	memcpy( &self->resourceId, &info->pUserData, sizeof( void * ) ); // note we copy pUserData as a value
+	uint64_t firstBlockCapacity = self->blocks.empty() ? 0 : self->blocks[ 0 ].allocationInfo.size;
 
-	self->resourceId = *reinterpret_cast<le_resource_handle_t const *>( info->pUserData );
+	if ( firstBlockCapacity < std::min( self->highWaterMark, self->maxBlockSize ) ) {
 
-	allocator_reset( self );
+		uint64_t blockSize = std::max<uint64_t>( firstBlockCapacity, 1 );
+		while ( blockSize < self->highWaterMark && blockSize < self->maxBlockSize ) {
+			blockSize *= 2;
+		}
+		blockSize = std::min( blockSize, self->maxBlockSize );
+
+		// We create the new block before we release any blocks - if it can't be created,
+		// we keep the blocks which we already have, so that allocations can still be served.
+
+		if ( allocator_create_block( self, blockSize ) ) {
+			le_allocator_o::Block block = self->blocks.back();
+			self->blocks.pop_back();
+			allocator_destroy_blocks( self );
+			self->blocks.emplace_back( block );
+			blocks_changed = true;
+		} else {
+			std::cout << "WARNING: Could not grow first block of linear allocator to " << blockSize << " Bytes - keeping previous blocks." << std::endl
+			          << std::flush;
+		}
+	}
+
+	self->bytesUsedInBlocks = 0;
+	allocator_set_current_block( self, 0 );
+
+	return blocks_changed;
+}
+
+// ----------------------------------------------------------------------
+
+static le_allocator_o *allocator_create( VmaAllocator vmaAlloc, VmaPool pool, VkBufferCreateInfo const *bufferInfo, le_resource_handle_t const &resource_id, uint64_t max_block_size, uint16_t alignment ) {
+	auto self = new le_allocator_o{};
+
+	self->vmaAllocator     = vmaAlloc;
+	self->pool             = pool;
+	self->bufferCreateInfo = *bufferInfo;
+	self->maxBlockSize     = max_block_size;
+	self->alignment        = alignment;
+	self->resourceId       = resource_id;
+
+	if ( bufferInfo->queueFamilyIndexCount == 1 && bufferInfo->pQueueFamilyIndices ) {
+		self->queueFamilyIndex = bufferInfo->pQueueFamilyIndices[ 0 ];
+	}
+
+	if ( !allocator_create_block( self, std::min( bufferInfo->size, max_block_size ) ) ) {
+		// We still return a valid allocator: until a block can be created on demand,
+		// allocations from this allocator will fail, which the encoder checks for.
+		std::cerr << "ERROR: Could not allocate first block for linear allocator." << std::endl
+		          << std::flush;
+	}
+
+	allocator_set_current_block( self, 0 );
 
 	return self;
 }
@@ -63,6 +216,7 @@ static le_allocator_o *allocator_create( VmaAllocationInfo const *info, uint16_t
 // ----------------------------------------------------------------------
 
 static void allocator_destroy( le_allocator_o *self ) {
+	allocator_destroy_blocks( self );
 	delete self;
 }
 
@@ -74,10 +228,32 @@ static bool allocator_allocate( le_allocator_o *self, uint64_t numBytes, void **
 
 	auto allocationSizeInBytes = self->alignment * ( ( numBytes + ( self->alignment - 1 ) ) / self->alignment );
 
-	auto addressAfterAllocation = self->pData + allocationSizeInBytes;
+	if ( self->blocks.empty() || self->bufferOffsetInBytes + allocationSizeInBytes > self->bufferBaseOffsetInBytes + self->capacity ) {
 
-	if ( ( addressAfterAllocation ) > ( self->bufferBaseMemoryAddress + self->bufferBaseOffsetInBytes + self->capacity ) ) {
-		return false;
+		// Current block has run out of space - move on to the next block in the chain
+		// which is large enough, and chain a new block if there is no such block.
+
+		if ( allocationSizeInBytes > self->maxBlockSize ) {
+			return false;
+		}
+
+		size_t nextBlock = self->blocks.empty() ? 0 : self->currentBlock + 1;
+
+		while ( nextBlock < self->blocks.size() && self->blocks[ nextBlock ].allocationInfo.size < allocationSizeInBytes ) {
+			nextBlock++;
+		}
+
+		if ( nextBlock == self->blocks.size() ) {
+			uint64_t firstBlockCapacity = self->blocks.empty() ? self->bufferCreateInfo.size : self->blocks[ 0 ].allocationInfo.size;
+			uint64_t blockSize          = std::min( std::max( allocationSizeInBytes, firstBlockCapacity ), self->maxBlockSize );
+			if ( !allocator_create_block( self, blockSize ) ) {
+				return false;
+			}
+		}
+
+		self->bytesUsedInBlocks += self->bufferOffsetInBytes - self->bufferBaseOffsetInBytes;
+
+		allocator_set_current_block( self, nextBlock );
 	}
 
 	// ----------| invariant: enough capacity to accomodate numBytes
@@ -85,7 +261,7 @@ static bool allocator_allocate( le_allocator_o *self, uint64_t numBytes, void **
 	*pData        = self->pData; // point to next free memory address
 	*bufferOffset = self->bufferOffsetInBytes;
 
-	self->pData = addressAfterAllocation;
+	self->pData += allocationSizeInBytes;
 
 	self->bufferOffsetInBytes += allocationSizeInBytes;
 
@@ -100,6 +276,60 @@ static le_resource_handle_t allocator_get_le_resource_id( le_allocator_o *self )
 
 // ----------------------------------------------------------------------
 
+static VkBuffer allocator_get_vk_buffer( le_allocator_o *self, uint8_t block_index ) {
+	assert( block_index < self->blocks.size() && "block index out of bounds" );
+	return self->blocks[ block_index ].buffer;
+}
+
+// ----------------------------------------------------------------------
+
+static void allocator_get_stats( le_allocator_o *self, le_allocator_linear_stats_t *stats ) {
+	stats->bytes_used           = self->bytesUsedInBlocks + ( self->bufferOffsetInBytes - self->bufferBaseOffsetInBytes );
+	stats->bytes_capacity       = 0;
+	stats->high_water_mark      = self->highWaterMark;
+	stats->first_block_capacity = self->blocks.empty() ? 0 : self->blocks[ 0 ].allocationInfo.size;
+	stats->num_blocks           = uint32_t( self->blocks.size() );
+
+	for ( auto const &b : self->blocks ) {
+		stats->bytes_capacity += b.allocationInfo.size;
+	}
+}
+
+// ----------------------------------------------------------------------
+// Returns address of first allocation, and number of bytes allocated since the last reset.
+// Fails if allocations have spilled over into any blocks but the first block.
+static bool allocator_get_used_data( le_allocator_o *self, void const **pData, uint64_t *numBytes ) {
+	if ( self->currentBlock != 0 ) {
+		return false;
+	}
+	*pData    = self->bufferBaseMemoryAddress + self->bufferBaseOffsetInBytes;
+	*numBytes = self->bufferOffsetInBytes - self->bufferBaseOffsetInBytes;
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Replaces allocator contents with numBytes of data - as if data had been
+// allocated and written in one go, immediately after a reset.
+static bool allocator_restore_used_data( le_allocator_o *self, void const *data, uint64_t numBytes ) {
+
+	if ( self->blocks.empty() || numBytes > self->blocks[ 0 ].allocationInfo.size ) {
+		return false;
+	}
+
+	// ----------| invariant: enough capacity to accomodate numBytes
+
+	self->bytesUsedInBlocks = 0;
+	allocator_set_current_block( self, 0 );
+	memcpy( self->pData, data, numBytes );
+
+	self->pData += numBytes;
+	self->bufferOffsetInBytes += numBytes;
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
 void register_le_allocator_linear_api( void *api_ ) {
 
 	auto  le_backend_vk_api_i   = static_cast<le_backend_vk_api *>( api_ );
@@ -108,6 +338,10 @@ void register_le_allocator_linear_api( void *api_ ) {
 	le_allocator_linear_i.create             = allocator_create;
 	le_allocator_linear_i.destroy            = allocator_destroy;
 	le_allocator_linear_i.get_le_resource_id = allocator_get_le_resource_id;
+	le_allocator_linear_i.get_vk_buffer      = allocator_get_vk_buffer;
+	le_allocator_linear_i.get_stats          = allocator_get_stats;
+	le_allocator_linear_i.get_used_data      = allocator_get_used_data;
+	le_allocator_linear_i.restore_used_data  = allocator_restore_used_data;
 	le_allocator_linear_i.allocate           = allocator_allocate;
 	le_allocator_linear_i.reset              = allocator_reset;
 }
@@ -12,6 +12,14 @@
 constexpr uint8_t VK_MAX_BOUND_DESCRIPTOR_SETS = 8;
 constexpr uint8_t VK_MAX_COLOR_ATTACHMENTS     = 16; // maximum number of color attachments to a renderpass
 
+// Bindless descriptor set: any descriptor set in which a shader declares runtime-sized arrays gets laid out
+// as the bindless set - textures at binding 0, storage buffers at binding 1, indexed by the array indices
+// which the backend hands out when textures and buffers get registered.
+constexpr uint32_t LE_BINDLESS_TEXTURE_BINDING = 0;
+constexpr uint32_t LE_BINDLESS_BUFFER_BINDING  = 1;
+constexpr uint32_t LE_BINDLESS_MAX_TEXTURES    = 4096; // number of array elements in bindless texture binding
+constexpr uint32_t LE_BINDLESS_MAX_BUFFERS     = 1024; // number of array elements in bindless storage buffer binding
+
 // ----------------------------------------------------------------------
 // Preprocessor Macro utilities
 //
@@ -55,17 +63,29 @@ struct le_graphics_pipeline_builder_data {
 	std::array<vk::PipelineColorBlendAttachmentState, VK_MAX_COLOR_ATTACHMENTS> blendAttachmentStates{};
 };
 
+// Specialization constants for a pipeline. These apply to all shader stages of the pipeline -
+// a shader stage ignores any constant ids which it does not declare.
+struct le_specialization_constants_t {
+	std::vector<vk::SpecializationMapEntry> entries; // sorted by constantID, offsets refer into data
+	std::vector<uint8_t>                    data;    // constant values, laid out in order of entries
+
+	static_assert( std::has_unique_object_representations_v<vk::SpecializationMapEntry>,
+	               "specialization map entry must be tightly packed, so that it may be hashed." );
+};
+
 struct graphics_pipeline_state_o {
 	le_graphics_pipeline_builder_data data{};
 
-	std::vector<le_shader_module_o *> shaderStages; // non-owning; refers opaquely to shader modules (or not)
+	std::vector<le_shader_module_o *> shaderStages;            // non-owning; refers opaquely to shader modules (or not)
+	le_specialization_constants_t     specializationConstants; // only used if contains values
 
 	std::vector<le_vertex_input_attribute_description> explicitVertexAttributeDescriptions;    // only used if contains values, otherwise use from vertex shader reflection
 	std::vector<le_vertex_input_binding_description>   explicitVertexInputBindingDescriptions; // only used if contains values, otherwise use from vertex shader reflection
 };
 
 struct compute_pipeline_state_o {
-	le_shader_module_o *shaderStage; // non-owning; refers opaquely to a compute shader module (or not)
+	le_shader_module_o *          shaderStage;             // non-owning; refers opaquely to a compute shader module (or not)
+	le_specialization_constants_t specializationConstants; // only used if contains values - may be used to set workgroup size
 };
 
 struct rtx_pipeline_state_o {
@@ -215,6 +235,7 @@ struct LeRenderPass {
 	uint16_t       numDepthStencilAttachments;              // 0..1
 
 	LeRenderPassType type;
+	uint64_t         id; // renderpass id (hash of renderpass name), as used by the renderer
 
 	vk::Framebuffer         framebuffer;
 	vk::RenderPass          renderPass;
@@ -232,6 +253,7 @@ struct LeRenderPass {
 		uint32_t             active;
 	};
 
-	std::string                 debugName;         // Debug name for renderpass
-	std::vector<ExplicitSyncOp> explicit_sync_ops; // explicit sync operations for renderpass, these execute before renderpass begins.
+	std::string                       debugName;         // Debug name for renderpass
+	std::vector<ExplicitSyncOp>       explicit_sync_ops; // explicit sync operations for renderpass, these execute before renderpass begins.
+	std::vector<le_resource_handle_t> used_resources;    // resources declared by this pass, sorted by handle value
 };
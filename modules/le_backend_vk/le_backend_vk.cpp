@@ -4,6 +4,7 @@
 #include "util/vk_mem_alloc/vk_mem_alloc.h" // for allocation
 
 #include "le_backend_vk/le_backend_types_internal.h" // includes vulkan.hpp
+#include "le_backend_vk/le_staging_ring.h"           // lock-free sub-allocation from staging ring
 
 #include "le_swapchain_vk/le_swapchain_vk.h"
 #include "le_window/le_window.h"
@@ -21,13 +22,24 @@
 #include <set>
 #include <atomic>
 #include <mutex>
+#include <fstream>
 
 #include <memory>
+#include <algorithm>
+#include <stdexcept>
 
 #ifdef _WIN32
 #	define __PRETTY_FUNCTION__ __FUNCSIG__
 #endif //
 
+#ifndef LE_MT
+#	define LE_MT 0
+#endif
+
+#if ( LE_MT > 0 )
+#	include "le_jobs/le_jobs.h"
+#endif
+
 #ifndef PRINT_DEBUG_MESSAGES
 #	define PRINT_DEBUG_MESSAGES false
 #endif
@@ -48,9 +60,26 @@
 		return vk::enum_name( rhs );                                          \
 	}
 
-constexpr size_t LE_FRAME_DATA_POOL_BLOCK_SIZE  = 1u << 24; // 16.77 MB
-constexpr size_t LE_FRAME_DATA_POOL_BLOCK_COUNT = 1;
-constexpr size_t LE_LINEAR_ALLOCATOR_SIZE       = 1u << 24;
+constexpr size_t   LE_FRAME_DATA_POOL_BLOCK_SIZE  = 1u << 24; // 16.77 MB
+constexpr size_t   LE_FRAME_DATA_POOL_BLOCK_COUNT = 1;
+constexpr size_t   LE_LINEAR_ALLOCATOR_SIZE       = 1u << 20; // initial size of first block, blocks grow up to LE_FRAME_DATA_POOL_BLOCK_SIZE
+constexpr size_t   LE_STAGING_RING_SIZE           = 1u << 22; // initial size of per-frame staging ring
+constexpr size_t   LE_STAGING_RING_MAX_SIZE       = 1u << 26; // staging ring may grow up to this size, larger uploads use dedicated allocations
+constexpr size_t   LE_STAGING_ALIGNMENT           = 96;       // alignment for staging sub-allocations, see below
+constexpr uint32_t LE_MAX_TIMESTAMP_QUERIES       = 256; // per frame; we use two timestamp queries per renderpass
+
+// vkCmdCopyBufferToImage requires bufferOffset to be a multiple of 4, and of the texel block size
+// of the image's format. Texel block sizes are 1, 2, 3, 4, 6, 8, 12, 16, 24, or 32 bytes for
+// uncompressed formats, and 8 or 16 bytes for block-compressed formats: 96 is the least common
+// multiple of 4 and all of these. We can't align per format, as whoever maps staging memory
+// does not know the format of the image which it will be copied to.
+static_assert( LE_STAGING_ALIGNMENT % 4 == 0 && LE_STAGING_ALIGNMENT % 3 == 0 && LE_STAGING_ALIGNMENT % 32 == 0,
+               "staging alignment must be a multiple of 4, and of any texel block size" );
+
+// Strict weak ordering for resource handles - used to keep sorted lists of resources.
+static inline bool resource_handle_less( le_resource_handle_t const &lhs, le_resource_handle_t const &rhs ) noexcept {
+	return lhs.handle.as_data < rhs.handle.as_data;
+}
 
 struct LeRtxBlasCreateInfo {
 	le_rtx_blas_info_handle handle;
@@ -405,9 +434,21 @@ struct le_staging_allocator_o {
 	VmaAllocator                   allocator;      // non-owning, refers to backend allocator object
 	VkDevice                       device;         // non-owning, refers to vulkan device object
 	std::mutex                     mtx;            // protects all staging* elements
-	std::vector<vk::Buffer>        buffers;        // 0..n staging buffers used with the current frame (freed on frame clear)
+	std::vector<vk::Buffer>        buffers;        // buffers[0] is the staging ring, 1..n dedicated staging buffers used with the current frame (freed on frame clear)
 	std::vector<VmaAllocation>     allocations;    // SOA: counterpart to buffers[]
 	std::vector<VmaAllocationInfo> allocationInfo; // SOA: counterpart to buffers[]
+
+	// Staging ring - persistently mapped, sub-allocated without taking the mutex.
+	// Each frame owns its own staging allocator, which means that frames in flight
+	// each hold one segment of the ring, which gets recycled once the frame is cleared.
+	uint8_t *             ring_mapped_memory = nullptr; // | cached from allocationInfo[0], only changes on reset
+	uint64_t              ring_capacity      = 0;       // |
+	std::atomic<uint64_t> ring_offset{ 0 };             // next free byte in ring, never runs past ring_capacity
+
+	std::atomic<uint64_t> bytes_requested{ 0 };           // | stats for the current frame,
+	std::atomic<uint64_t> bytes_dedicated{ 0 };           // | published on reset
+	std::atomic<uint32_t> num_dedicated_allocations{ 0 }; // |
+	le_staging_allocator_stats_t last_stats{};            // stats for the frame which was most recently reset
 };
 
 // ------------------------------------------------------------
@@ -423,6 +464,330 @@ struct swapchain_state_t {
 	bool     acquire_successful = false;
 };
 
+// Descriptor sets which only reference buffers may be re-used across frames, as long as
+// none of the buffers which they reference has been destroyed in the meantime.
+//
+// Each frame owns one cache, which survives frame clears - the cache gets flushed as a whole
+// whenever its epoch is behind the backend's descriptor set cache epoch, or it has filled up.
+struct DescriptorSetCache {
+
+	static constexpr uint32_t MAX_SETS = 1024; // capacity of the cache's descriptor pool
+
+	struct Entry {
+		vk::DescriptorSetLayout     setLayout;
+		std::vector<DescriptorData> setData;
+		vk::DescriptorSet           descriptorSet;
+	};
+
+	std::mutex                          mtx;                 // protects pool, entries, num_allocated
+	vk::DescriptorPool                  pool = nullptr;      // owning: persistent, only reset when cache gets flushed
+	std::unordered_map<uint64_t, Entry> entries;             // hash of set layout and set data -> descriptor set
+	uint32_t                            num_allocated   = 0; // number of descriptor sets allocated from pool since last flush
+	uint64_t                            epoch           = 0; // backend descriptor set cache epoch at last flush
+	std::atomic<uint64_t>               hit_count{ 0 };      // descriptor sets re-used from cache this frame
+	std::atomic<uint64_t>               miss_count{ 0 };     // descriptor sets which had to be written this frame
+	uint64_t                            last_hit_count  = 0; // | published when frame gets cleared
+	uint64_t                            last_miss_count = 0; // |
+};
+
+// Image views which may be re-used across frames, keyed by image and view parameters.
+//
+// A cached image view stays alive until the image it references gets destroyed - whoever destroys
+// an image must first evict its views via `image_view_cache_evict_image`. This is safe with frames
+// in flight: an image only gets destroyed once no frame may reference it anymore, and the same
+// then holds for its views.
+struct ImageViewCache {
+
+	struct Key {
+		VkImage                 image;
+		VkImageViewCreateFlags  flags;
+		VkImageViewType         viewType;
+		VkFormat                format;
+		VkComponentMapping      components;
+		VkImageSubresourceRange subresourceRange;
+
+		bool operator==( Key const &rhs ) const noexcept {
+			return 0 == memcmp( this, &rhs, sizeof( Key ) );
+		}
+	};
+
+	static_assert( std::has_unique_object_representations_v<Key>, "image view cache key must not contain padding, as we hash and compare its bytes." );
+
+	struct KeyHash {
+		uint64_t operator()( Key const &key ) const noexcept {
+			return SpookyHash::Hash64( &key, sizeof( Key ), 0 );
+		}
+	};
+
+	std::mutex                                       mtx;            // protects entries
+	std::unordered_map<Key, vk::ImageView, KeyHash> entries;        // owning
+	std::atomic<uint64_t>                            evictions{ 0 }; // incremented whenever image views get destroyed - bindless sets may still reference them
+};
+
+// Samplers which may be re-used across frames, keyed by sampler create info.
+// Samplers don't reference any resources, which is why they stay alive until the backend gets destroyed.
+struct SamplerCache {
+
+	struct InfoHash {
+		uint64_t operator()( vk::SamplerCreateInfo const &info ) const noexcept {
+			// All members from flags onwards are tightly packed 32 bit values - we hash these,
+			// and skip sType and pNext.
+			constexpr size_t offset = offsetof( VkSamplerCreateInfo, flags );
+			return SpookyHash::Hash64( reinterpret_cast<char const *>( &info ) + offset, sizeof( VkSamplerCreateInfo ) - offset, 0 );
+		}
+	};
+
+	std::mutex                                                   mtx;     // protects entries
+	std::unordered_map<vk::SamplerCreateInfo, vk::Sampler, InfoHash> entries; // owning
+};
+
+// ----------------------------------------------------------------------
+// Returns cached image view matching `info` - creates a new image view and adds it to the cache if needed.
+static vk::ImageView image_view_cache_get( vk::Device const &device, ImageViewCache *cache, vk::ImageViewCreateInfo const &info ) {
+
+	assert( info.pNext == nullptr && "image view cache does not consider pNext" );
+
+	ImageViewCache::Key key{};
+	key.image            = VkImage( info.image );
+	key.flags            = VkImageViewCreateFlags( info.flags );
+	key.viewType         = VkImageViewType( info.viewType );
+	key.format           = VkFormat( info.format );
+	key.components       = VkComponentMapping( info.components );
+	key.subresourceRange = VkImageSubresourceRange( info.subresourceRange );
+
+	std::scoped_lock lock( cache->mtx );
+
+	auto it = cache->entries.find( key );
+
+	if ( it == cache->entries.end() ) {
+		it = cache->entries.emplace( key, device.createImageView( info ) ).first;
+	}
+
+	return it->second;
+}
+
+// ----------------------------------------------------------------------
+// Destroys any cached image views which reference `image` - must be called before `image` gets destroyed.
+static void image_view_cache_evict_image( vk::Device const &device, ImageViewCache *cache, vk::Image const &image ) {
+	std::scoped_lock lock( cache->mtx );
+
+	for ( auto it = cache->entries.begin(); it != cache->entries.end(); ) {
+		if ( it->first.image == VkImage( image ) ) {
+			device.destroyImageView( it->second );
+			it = cache->entries.erase( it );
+			cache->evictions++;
+		} else {
+			it++;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
+static void image_view_cache_clear( vk::Device const &device, ImageViewCache *cache ) {
+	std::scoped_lock lock( cache->mtx );
+
+	for ( auto &e : cache->entries ) {
+		device.destroyImageView( e.second );
+	}
+	cache->entries.clear();
+	cache->evictions++;
+}
+
+// ----------------------------------------------------------------------
+// Returns cached sampler matching `info` - creates a new sampler and adds it to the cache if needed.
+static vk::Sampler sampler_cache_get( vk::Device const &device, SamplerCache *cache, vk::SamplerCreateInfo const &info ) {
+
+	assert( info.pNext == nullptr && "sampler cache does not consider pNext" );
+
+	std::scoped_lock lock( cache->mtx );
+
+	auto it = cache->entries.find( info );
+
+	if ( it == cache->entries.end() ) {
+		it = cache->entries.emplace( info, device.createSampler( info ) ).first;
+	}
+
+	return it->second;
+}
+
+// ----------------------------------------------------------------------
+
+static void sampler_cache_clear( vk::Device const &device, SamplerCache *cache ) {
+	std::scoped_lock lock( cache->mtx );
+
+	for ( auto &e : cache->entries ) {
+		device.destroySampler( e.second );
+	}
+	cache->entries.clear();
+}
+
+// ----------------------------------------------------------------------
+
+// Map from resource handle to T, for tables which get rebuilt from scratch every frame.
+//
+// Entries are stored densely, in insertion order - the position of an entry is the resource's
+// index for the current frame (see `index_of`), and iteration visits entries in that order.
+// Lookups go through an open-addressing table of entry indices, which makes them O(1) without
+// touching any per-entry heap nodes.
+//
+// `clear()` keeps all storage: once a frame has seen its working set of resources, rebuilding
+// the map does not allocate. Recycled values are reset instead of destroyed, so that vectors
+// keep their capacity.
+template <typename T>
+class FrameResourceMap {
+  public:
+	typedef std::pair<le_resource_handle_t, T> value_type;
+	typedef value_type *                       iterator;
+	typedef value_type const *                 const_iterator;
+
+	static constexpr uint32_t npos = uint32_t( ~0 );
+
+	iterator begin() noexcept {
+		return entries.data();
+	}
+	iterator end() noexcept {
+		return entries.data() + count;
+	}
+	const_iterator begin() const noexcept {
+		return entries.data();
+	}
+	const_iterator end() const noexcept {
+		return entries.data() + count;
+	}
+	size_t size() const noexcept {
+		return count;
+	}
+	bool empty() const noexcept {
+		return count == 0;
+	}
+
+	// Returns frame-local index of resource, or npos if resource is not in map.
+	uint32_t index_of( le_resource_handle_t const &key ) const noexcept {
+		if ( slots.empty() ) {
+			return npos;
+		}
+		size_t const mask = slots.size() - 1;
+		for ( size_t i = slot_for( key ); slots[ i ] != 0; i = ( i + 1 ) & mask ) {
+			if ( entries[ slots[ i ] - 1 ].first == key ) {
+				return slots[ i ] - 1;
+			}
+		}
+		return npos;
+	}
+
+	iterator find( le_resource_handle_t const &key ) noexcept {
+		uint32_t index = index_of( key );
+		return index == npos ? end() : begin() + index;
+	}
+
+	const_iterator find( le_resource_handle_t const &key ) const noexcept {
+		uint32_t index = index_of( key );
+		return index == npos ? end() : begin() + index;
+	}
+
+	T &at( le_resource_handle_t const &key ) {
+		uint32_t index = index_of( key );
+		if ( index == npos ) {
+			throw std::out_of_range( "FrameResourceMap::at" );
+		}
+		return entries[ index ].second;
+	}
+
+	T const &at( le_resource_handle_t const &key ) const {
+		uint32_t index = index_of( key );
+		if ( index == npos ) {
+			throw std::out_of_range( "FrameResourceMap::at" );
+		}
+		return entries[ index ].second;
+	}
+
+	// Returns value for key, inserts default value if key was not yet in map.
+	T &operator[]( le_resource_handle_t const &key ) {
+		return entries[ acquire_index( key ).first ].second;
+	}
+
+	// Inserts value only if key was not yet in map.
+	std::pair<iterator, bool> try_emplace( le_resource_handle_t const &key, T const &value ) {
+		auto result = acquire_index( key );
+		if ( result.second ) {
+			entries[ result.first ].second = value;
+		}
+		return { begin() + result.first, result.second };
+	}
+
+	std::pair<iterator, bool> insert_or_assign( le_resource_handle_t const &key, T const &value ) {
+		auto result                    = acquire_index( key );
+		entries[ result.first ].second = value;
+		return { begin() + result.first, result.second };
+	}
+
+	void clear() noexcept {
+		count = 0;
+		std::fill( slots.begin(), slots.end(), 0 );
+	}
+
+  private:
+	std::vector<value_type> entries;           // entries [0..count) are live, anything beyond is retained for re-use
+	std::vector<uint32_t>   slots;             // entry index + 1, 0 means empty slot; size is a power of two
+	uint32_t                count         = 0; // number of live entries
+	uint32_t                slots_log2    = 0; // log2 of slots.size()
+	static constexpr size_t MIN_SLOTS_LOG2 = 6;
+
+	size_t slot_for( le_resource_handle_t const &key ) const noexcept {
+		// fibonacci hashing - spreads handles which only differ in their meta bits
+		return size_t( ( uint64_t( key ) * 11400714819323198485ull ) >> ( 64 - slots_log2 ) );
+	}
+
+	template <typename U>
+	static void reset_value( U &value ) {
+		value = U{};
+	}
+
+	template <typename U>
+	static void reset_value( std::vector<U> &value ) {
+		value.clear(); // keep capacity
+	}
+
+	void grow() {
+		slots_log2 = slots.empty() ? MIN_SLOTS_LOG2 : slots_log2 + 1;
+		slots.assign( size_t( 1 ) << slots_log2, 0 );
+		size_t const mask = slots.size() - 1;
+		for ( uint32_t e = 0; e != count; e++ ) {
+			size_t i = slot_for( entries[ e ].first );
+			while ( slots[ i ] != 0 ) {
+				i = ( i + 1 ) & mask;
+			}
+			slots[ i ] = e + 1;
+		}
+	}
+
+	// Returns index of entry for key, and whether the entry was newly inserted.
+	std::pair<uint32_t, bool> acquire_index( le_resource_handle_t const &key ) {
+		if ( size_t( count + 1 ) * 2 > slots.size() ) {
+			grow(); // keep load factor at or below 50%
+		}
+		size_t const mask = slots.size() - 1;
+		size_t       i    = slot_for( key );
+		for ( ; slots[ i ] != 0; i = ( i + 1 ) & mask ) {
+			if ( entries[ slots[ i ] - 1 ].first == key ) {
+				return { slots[ i ] - 1, false };
+			}
+		}
+
+		// ----------| invariant: key is not in map, and slot i is empty.
+
+		if ( count == entries.size() ) {
+			entries.emplace_back( key, T{} );
+		} else {
+			entries[ count ].first = key;
+			reset_value( entries[ count ].second );
+		}
+		slots[ i ] = ++count;
+		return { count - 1, true };
+	}
+};
+
 // Herein goes all data which is associated with the current frame.
 // Backend keeps track of multiple frames, exactly one per renderer::FrameData frame.
 //
@@ -430,11 +795,17 @@ struct swapchain_state_t {
 // frame only operates only on its own memory, it will never see contention
 // with other threads processing other frames concurrently.
 struct BackendFrameData {
-	vk::Fence       frameFence  = nullptr; // protects the frame - cpu waits on gpu to pass fence before deleting/recycling frame
-	vk::CommandPool commandPool = nullptr;
+	uint64_t timelineValue = 0; // protects the frame - cpu waits on gpu to signal this value on backend frame timeline before deleting/recycling frame
+
+	struct CommandPool {
+		vk::CommandPool                pool = nullptr;
+		std::vector<vk::CommandBuffer> allocated; // command buffers allocated from this pool, freed when frame gets cleared
+	};
+
+	std::vector<CommandPool> commandPools; // one per worker thread, so that passes may be processed concurrently
 
 	std::vector<swapchain_state_t> swapchain_state;
-	std::vector<vk::CommandBuffer> commandBuffers;
+	std::vector<vk::CommandBuffer> commandBuffers; // in pass order, ready for submission
 
 	struct Texture {
 		vk::Sampler   sampler;
@@ -443,21 +814,16 @@ struct BackendFrameData {
 
 	using texture_map_t = std::unordered_map<le_texture_handle, Texture>;
 
-	std::unordered_map<le_resource_handle_t, vk::ImageView, LeResourceHandleIdentity> imageViews; // non-owning, references to frame-local textures, cleared on frame fence.
+	FrameResourceMap<vk::ImageView> imageViews; // non-owning, references to frame-local textures, cleared on frame fence.
 
 	// With `syncChainTable` and image_attachment_info_o.syncState, we should
 	// be able to create renderpasses. Each resource has a sync chain, and each attachment_info
 	// has a struct which holds indices into the sync chain telling us where to look
 	// up the sync state for a resource at different stages of renderpass construction.
-	std::unordered_map<le_resource_handle_t, std::vector<ResourceState>, LeResourceHandleIdentity> syncChainTable;
+	FrameResourceMap<std::vector<ResourceState>> syncChainTable;
 
 	static_assert( sizeof( VkBuffer ) == sizeof( VkImageView ) && sizeof( VkBuffer ) == sizeof( VkImage ), "size of AbstractPhysicalResource components must be identical" );
 
-	// Map from renderer resource id to physical resources - only contains resources this frame uses.
-	// Q: Does this table actually own the resources?
-	// A: It must not: as it is used to map external resources as well.
-	std::unordered_map<le_resource_handle_t, AbstractPhysicalResource, LeResourceHandleIdentity> physicalResources;
-
 	/// \brief vk resources retained and destroyed with BackendFrameData
 	std::forward_list<AbstractPhysicalResource> ownedResources;
 
@@ -469,7 +835,8 @@ struct BackendFrameData {
 	std::vector<LeRenderPass>  passes;
 	std::vector<texture_map_t> textures_per_pass; // non-owning, references to frame-local textures, cleared on frame fence.
 
-	std::vector<vk::DescriptorPool> descriptorPools; // one descriptor pool per pass
+	std::vector<vk::DescriptorPool>     descriptorPools;    // one descriptor pool per pass
+	std::unique_ptr<DescriptorSetCache> descriptorSetCache; // owning: descriptor sets which may be re-used across frames
 
 	/*
 
@@ -481,19 +848,31 @@ struct BackendFrameData {
 
 	 */
 
-	typedef std::unordered_map<le_resource_handle_t, AllocatedResourceVk, LeResourceHandleIdentity> ResourceMap_T;
+	typedef FrameResourceMap<AllocatedResourceVk> ResourceMap_T;
 
 	ResourceMap_T availableResources; // resources this frame may use
 	ResourceMap_T binnedResources;    // resources to delete when this frame comes round to clear()
 
 	VmaPool allocationPool; // pool from which allocations for this frame come from
 
-	std::vector<le_allocator_o *>  allocators;       // owning; typically one per `le_worker_thread`.
-	std::vector<vk::Buffer>        allocatorBuffers; // per allocator: one vkBuffer
-	std::vector<VmaAllocation>     allocations;      // per allocator: one allocation
-	std::vector<VmaAllocationInfo> allocationInfos;  // per allocator: one allocationInfo
+	std::vector<le_allocator_o *> allocators;              // owning; typically one per `le_worker_thread`. each allocator owns its blocks of memory
+	le_allocator_linear_stats_t   transientAllocatorStats; // summed over all allocators, updated on clear_frame
+
+	le_staging_allocator_o *     stagingAllocator;      // owning: allocator for large objects to GPU memory
+	le_staging_allocator_stats_t stagingAllocatorStats; // updated on clear_frame
+
+	vk::QueryPool         timestampQueryPool  = nullptr; // owning: two timestamps per pass - at start, and at end of pass command buffer
+	uint32_t              timestampQueryCount = 0;       // number of timestamp queries written by process_frame
+	std::vector<uint64_t> passGpuIds;                    // | pass ids for which gpu timings are available, updated on clear_frame
+	std::vector<uint64_t> passGpuDurations;              // | gpu time in nanoseconds per pass, in sync with passGpuIds
 
-	le_staging_allocator_o *stagingAllocator; // owning: allocator for large objects to GPU memory
+	// Bindless mode: this frame's view of all registered textures and buffers. Only array elements
+	// whose descriptors differ from what was written when this frame was last processed get updated.
+	vk::DescriptorSet       bindlessSet            = nullptr; // allocated from backend bindless pool, nullptr unless bindless mode is enabled
+	std::vector<Texture>    bindlessTextures;                 // | per array element: texture currently written to bindlessSet
+	std::vector<vk::Buffer> bindlessBuffers;                  // | per array element: buffer currently written to bindlessSet
+	uint64_t                bindlessImageViewEpoch = 0;       // image view cache evictions when bindlessTextures were last validated
+	uint64_t                bindlessBufferEpoch    = 0;       // descriptorSetCacheEpoch when bindlessBuffers were last validated
 };
 
 static const vk::BufferUsageFlags LE_BUFFER_USAGE_FLAGS_SCRATCH =
@@ -506,6 +885,35 @@ static const vk::BufferUsageFlags LE_BUFFER_USAGE_FLAGS_SCRATCH =
 #endif
     vk::BufferUsageFlagBits::eTransferSrc;
 
+// A frame capture holds the command streams for all passes of a frame, together with
+// the contents of the frame's transient allocators - which is where argument data,
+// and transient vertex and index data live.
+//
+// Command streams refer to pipelines, and textures via handles which are only valid
+// within the process which recorded them. This is why a capture may only be replayed
+// by the same process which wrote it.
+struct le_frame_capture_t {
+
+	struct pass_t {
+		uint64_t          id;           // renderpass id (hash of renderpass name)
+		LeRenderPassType  type;         //
+		uint64_t          num_commands; //
+		std::vector<char> commands;     // tightly packed - contains no eNextChunk commands
+
+		// Gathered from commands when a capture gets loaded - not part of the capture file.
+		std::vector<le_resource_handle_t> resources; // resources which commands refer to, sorted, unique - excludes transient buffers
+		std::vector<le_texture_handle>    textures;  // textures which commands refer to, sorted, unique
+	};
+
+	struct allocator_t {
+		le_resource_handle_t resource_id; // virtual buffer which backs allocator
+		std::vector<char>    data;        // allocator contents, starting with first allocation
+	};
+
+	std::vector<pass_t>      passes;
+	std::vector<allocator_t> allocators;
+};
+
 /// \brief backend data object
 struct le_backend_o {
 
@@ -529,9 +937,14 @@ struct le_backend_o {
 
 	vk::PhysicalDeviceRayTracingPropertiesKHR ray_tracing_props{};
 
+	float timestampPeriod = 0.f; // nanoseconds per timestamp tick, 0 if device does not support timestamps on graphics queue
+
 	// Siloed per-frame memory
 	std::vector<BackendFrameData> mFrames;
 
+	vk::Semaphore         frameTimeline = nullptr; // timeline semaphore - gpu signals a frame's timelineValue once it has finished processing the frame
+	std::atomic<uint64_t> frameTimelineValue{ 0 }; // most recent value submitted to be signalled on frameTimeline
+
 	le_pipeline_manager_o *pipelineCache = nullptr;
 
 	VmaAllocator mAllocator = nullptr;
@@ -542,6 +955,25 @@ struct le_backend_o {
 	KillList<le_rtx_blas_info_o> rtx_blas_info_kill_list; // used to keep track rtx_blas_infos.
 	KillList<le_rtx_tlas_info_o> rtx_tlas_info_kill_list; // used to keep track rtx_blas_infos.
 
+	std::atomic<uint64_t> descriptorSetCacheEpoch{ 1 }; // bumped whenever a buffer gets destroyed - invalidates all descriptor set caches
+
+	ImageViewCache imageViewCache; // image views which may be re-used across frames, evicted when their image gets destroyed
+	SamplerCache   samplerCache;   // samplers which may be re-used across frames
+
+	struct {
+		vk::DescriptorSetLayout                                                      setLayout = nullptr; // non-owning (owned by pipeline manager), nullptr unless bindless mode is enabled
+		vk::DescriptorPool                                                           pool      = nullptr; // owning, one bindless set per frame gets allocated from this pool
+		std::mutex                                                                   mtx;                 // protects texture_indices, buffer_indices
+		std::unordered_map<le_texture_handle, uint32_t>                              texture_indices;     // array element for each registered texture
+		std::unordered_map<le_resource_handle_t, uint32_t, LeResourceHandleIdentity> buffer_indices;      // array element for each registered buffer
+	} bindless;
+
+	struct {
+		std::mutex                                mtx;          // protects all frame_capture elements
+		std::string                               request_path; // capture next processed frame to this path, unless empty
+		std::shared_ptr<le_frame_capture_t const> replay;       // capture to replay, if any - shared, as a frame may still be processing while replay is unloaded
+	} frame_capture;
+
 	struct {
 		std::unordered_map<le_resource_handle_t, AllocatedResourceVk, LeResourceHandleIdentity> allocatedResources; // Allocated resources, indexed by resource name hash
 	} only_backend_allocate_resources_may_access;                                                                   // Only acquire_physical_resources may read/write
@@ -559,6 +991,9 @@ struct ArgumentState {
 	std::array<vk::DescriptorUpdateTemplate, 8> updateTemplates; // update templates for currently bound descriptor sets
 	std::array<vk::DescriptorSetLayout, 8>      layouts;         // layouts for currently bound descriptor sets
 	std::vector<le_shader_binding_info>         binding_infos;
+
+	vk::DescriptorSetLayout bindlessSetLayout = nullptr; // layout of bindless set, nullptr unless bindless mode is enabled
+	vk::DescriptorSet       bindlessSet       = nullptr; // current frame's bindless set - bound as-is, never updated via setData
 };
 
 struct DescriptorSetState {
@@ -654,6 +1089,10 @@ static void backend_destroy( le_backend_o *self ) {
 
 	vk::Device device = self->device->getVkDevice(); // may be nullptr if device was not created
 
+	// Cached image views must go before the images which they reference.
+	image_view_cache_clear( device, &self->imageViewCache );
+	sampler_cache_clear( device, &self->samplerCache );
+
 	// We must destroy the swapchain before self->mAllocator, as
 	// the swapchain might have allocated memory using the backend's allocator,
 	// and the allocator must still be alive for the swapchain to free objects
@@ -665,45 +1104,47 @@ static void backend_destroy( le_backend_o *self ) {
 	}
 	self->swapchains.clear();
 
+	if ( self->bindless.pool ) {
+		// Frees all per-frame bindless sets - the bindless set layout is owned by the pipeline manager.
+		device.destroyDescriptorPool( self->bindless.pool );
+		self->bindless.pool = nullptr;
+	}
+
 	for ( auto &frameData : self->mFrames ) {
 
 		using namespace le_backend_vk;
 
 		// -- destroy per-frame data
 
-		device.destroyFence( frameData.frameFence );
-
 		for ( auto &swapchain_state : frameData.swapchain_state ) {
 			device.destroySemaphore( swapchain_state.presentComplete );
 			device.destroySemaphore( swapchain_state.renderComplete );
 		}
 		frameData.swapchain_state.clear();
 
-		device.destroyCommandPool( frameData.commandPool );
+		for ( auto &p : frameData.commandPools ) {
+			device.destroyCommandPool( p.pool );
+		}
+		frameData.commandPools.clear();
+
+		if ( frameData.timestampQueryPool ) {
+			device.destroyQueryPool( frameData.timestampQueryPool );
+		}
 
 		for ( auto &d : frameData.descriptorPools ) {
 			device.destroyDescriptorPool( d );
 		}
 
-		{
-			// Destroy linear allocators, and the buffers allocated for them.
-			assert( frameData.allocatorBuffers.size() == frameData.allocators.size() &&
-			        frameData.allocatorBuffers.size() == frameData.allocations.size() &&
-			        frameData.allocatorBuffers.size() == frameData.allocationInfos.size() );
-
-			vk::Buffer *   buffer     = frameData.allocatorBuffers.data();
-			VmaAllocation *allocation = frameData.allocations.data();
-
-			for ( auto allocator = frameData.allocators.begin(); allocator != frameData.allocators.end(); allocator++, buffer++, allocation++ ) {
-				le_allocator_linear_i.destroy( *allocator );
-				vmaDestroyBuffer( self->mAllocator, *buffer, *allocation );
-			}
+		if ( frameData.descriptorSetCache ) {
+			device.destroyDescriptorPool( frameData.descriptorSetCache->pool );
+			frameData.descriptorSetCache.reset();
+		}
 
-			frameData.allocators.clear();
-			frameData.allocatorBuffers.clear();
-			frameData.allocations.clear();
-			frameData.allocationInfos.clear();
+		// Destroy linear allocators, and the buffers allocated for them.
+		for ( auto &allocator : frameData.allocators ) {
+			le_allocator_linear_i.destroy( allocator );
 		}
+		frameData.allocators.clear();
 
 		vmaDestroyPool( self->mAllocator, frameData.allocationPool );
 
@@ -726,6 +1167,11 @@ static void backend_destroy( le_backend_o *self ) {
 
 	self->mFrames.clear();
 
+	if ( self->frameTimeline ) {
+		device.destroySemaphore( self->frameTimeline );
+		self->frameTimeline = nullptr;
+	}
+
 	// Remove any resources still alive in the backend.
 	// At this point we're running single-threaded, so we can ignore the
 	// ownership claim on allocatedResources.
@@ -864,6 +1310,15 @@ static void backend_reset_swapchain( le_backend_o *self, uint32_t index ) {
 
 	assert( index < self->swapchains.size() );
 
+	{
+		// Resetting the swapchain destroys its images - we must evict any cached views for these first.
+		vk::Device device = self->device->getVkDevice();
+
+		for ( uint32_t i = 0, num_images = uint32_t( swapchain_i.get_images_count( self->swapchains[ index ] ) ); i != num_images; i++ ) {
+			image_view_cache_evict_image( device, &self->imageViewCache, swapchain_i.get_image( self->swapchains[ index ], i ) );
+		}
+	}
+
 	swapchain_i.reset( self->swapchains[ index ], nullptr );
 
 	std::cout << "NOTICE: Resetting swapchain with index: " << index << std::flush << std::endl;
@@ -1063,11 +1518,13 @@ static std::vector<char const *> collect_requested_device_extensions( le_backend
 
 // ----------------------------------------------------------------------
 
-static void backend_initialise( le_backend_o *self, std::vector<char const *> requested_instance_extensions, std::vector<char const *> requested_device_extensions ) {
+// Bindless mode gets passed explicitly to device and pipeline manager - the device enables
+// descriptor indexing features for it, and the pipeline manager lays out the bindless set.
+static void backend_initialise( le_backend_o *self, std::vector<char const *> requested_instance_extensions, std::vector<char const *> requested_device_extensions, bool bindless_descriptors ) {
 	using namespace le_backend_vk;
 	self->instance      = vk_instance_i.create( requested_instance_extensions.data(), uint32_t( requested_instance_extensions.size() ) );
-	self->device        = std::make_unique<le::Device>( self->instance, requested_device_extensions.data(), uint32_t( requested_device_extensions.size() ) );
-	self->pipelineCache = le_pipeline_manager_i.create( *self->device );
+	self->device        = std::make_unique<le::Device>( self->instance, requested_device_extensions.data(), uint32_t( requested_device_extensions.size() ), bindless_descriptors );
+	self->pipelineCache = le_pipeline_manager_i.create( *self->device, bindless_descriptors );
 }
 // ----------------------------------------------------------------------
 
@@ -1090,6 +1547,50 @@ static void backend_create_main_allocator( VkInstance instance, VkPhysicalDevice
 
 // ----------------------------------------------------------------------
 
+// Creates one bindless descriptor set per frame. Bindless sets are allocated from a pool
+// of their own, as they must be allocated from a pool which allows update-after-bind.
+static void backend_create_bindless_sets( le_backend_o *self ) {
+
+	using namespace le_backend_vk;
+
+	vk::Device device = self->device->getVkDevice();
+
+	uint64_t set_layout_key  = le_pipeline_manager_i.produce_bindless_set_layout( self->pipelineCache );
+	self->bindless.setLayout = le_pipeline_manager_i.get_descriptor_set_layout( self->pipelineCache, set_layout_key )->vk_descriptor_set_layout;
+
+	uint32_t const numFrames = uint32_t( self->mFrames.size() );
+
+	std::array<vk::DescriptorPoolSize, 2> descriptorPoolSizes{ {
+	    { vk::DescriptorType::eCombinedImageSampler, LE_BINDLESS_MAX_TEXTURES * numFrames },
+	    { vk::DescriptorType::eStorageBuffer, LE_BINDLESS_MAX_BUFFERS * numFrames },
+	} };
+
+	vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo;
+	descriptorPoolCreateInfo
+	    .setFlags( vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind )
+	    .setMaxSets( numFrames )
+	    .setPoolSizeCount( uint32_t( descriptorPoolSizes.size() ) )
+	    .setPPoolSizes( descriptorPoolSizes.data() );
+
+	self->bindless.pool = device.createDescriptorPool( descriptorPoolCreateInfo );
+
+	for ( auto &frame : self->mFrames ) {
+		vk::DescriptorSetAllocateInfo allocateInfo;
+		allocateInfo.setDescriptorPool( self->bindless.pool )
+		    .setDescriptorSetCount( 1 )
+		    .setPSetLayouts( &self->bindless.setLayout );
+
+		auto result = device.allocateDescriptorSets( &allocateInfo, &frame.bindlessSet );
+
+		assert( result == vk::Result::eSuccess && "failed to allocate bindless descriptor set" );
+
+		frame.bindlessTextures.resize( LE_BINDLESS_MAX_TEXTURES );
+		frame.bindlessBuffers.resize( LE_BINDLESS_MAX_BUFFERS );
+	}
+}
+
+// ----------------------------------------------------------------------
+
 static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *settings ) {
 
 	using namespace le_backend_vk;
@@ -1103,7 +1604,7 @@ static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *setting
 
 	// -- initialise backend
 
-	backend_initialise( self, collect_requested_instance_extensions( settings ), collect_requested_device_extensions( settings ) );
+	backend_initialise( self, collect_requested_instance_extensions( settings ), collect_requested_device_extensions( settings ), settings->bindlessDescriptors );
 
 	vk::Device         vkDevice         = self->device->getVkDevice();
 	vk::PhysicalDevice vkPhysicalDevice = self->device->getVkPhysicalDevice();
@@ -1112,6 +1613,12 @@ static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *setting
 	// -- query rtx properties, and store them with backend
 	self->device->getRaytracingProperties( &static_cast<VkPhysicalDeviceRayTracingPropertiesKHR &>( self->ray_tracing_props ) );
 
+	{
+		// -- query whether we can measure gpu time per pass via timestamps
+		auto const &limits    = vk_device_i.get_vk_physical_device_properties( *self->device ).limits;
+		self->timestampPeriod = limits.timestampComputeAndGraphics ? limits.timestampPeriod : 0.f;
+	}
+
 	// -- Create allocator for backend vulkan memory
 	// we do this here, because swapchain might want to already use the allocator.
 
@@ -1147,6 +1654,17 @@ static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *setting
 		assert( self->swapchain_resources[ 0 ] == LE_SWAPCHAIN_IMAGE_HANDLE && "constexpr resource handle and generated resource handle must match. check whether printf pattern above matches LE_SWAPCHAIN_IMAGE_HANDLE" );
 	}
 
+	{
+		// -- create timeline semaphore which tracks frame completion for all frames
+		vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo> semaphoreInfo{};
+		semaphoreInfo.get<vk::SemaphoreTypeCreateInfo>()
+		    .setSemaphoreType( vk::SemaphoreType::eTimeline )
+		    .setInitialValue( 0 );
+
+		self->frameTimeline      = vkDevice.createSemaphore( semaphoreInfo.get<vk::SemaphoreCreateInfo>() );
+		self->frameTimelineValue = 0;
+	}
+
 	for ( size_t i = 0; i != frameCount; ++i ) {
 
 		// -- Set up per-frame resources
@@ -1162,8 +1680,14 @@ static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *setting
 			}
 		}
 
-		frameData.frameFence  = vkDevice.createFence( {} ); // fence starts out as "signalled"
-		frameData.commandPool = vkDevice.createCommandPool( { vk::CommandPoolCreateFlagBits::eTransient, self->device->getDefaultGraphicsQueueFamilyIndex() } );
+		frameData.timelineValue = 0; // frame starts out as complete, as the frame timeline starts out at 0
+
+		// Command pools must be externally synchronised - we give each worker thread its own pool.
+		frameData.commandPools.resize( std::max<size_t>( 1, settings->concurrency_count ) );
+
+		for ( auto &p : frameData.commandPools ) {
+			p.pool = vkDevice.createCommandPool( { vk::CommandPoolCreateFlagBits::eTransient, self->device->getDefaultGraphicsQueueFamilyIndex() } );
+		}
 
 		{
 			// -- set up an allocation pool for each frame
@@ -1183,9 +1707,40 @@ static void backend_setup( le_backend_o *self, le_backend_vk_settings_t *setting
 		using namespace le_backend_vk;
 		frameData.stagingAllocator = le_staging_allocator_i.create( self->mAllocator, vkDevice );
 
+		if ( self->timestampPeriod > 0.f ) {
+			frameData.timestampQueryPool = vkDevice.createQueryPool( { {}, vk::QueryType::eTimestamp, LE_MAX_TIMESTAMP_QUERIES } );
+		}
+
+		{
+			// -- set up a descriptor set cache for this frame - cached descriptor
+			// sets only ever reference buffers, so that's all we need to allocate for.
+
+			frameData.descriptorSetCache        = std::make_unique<DescriptorSetCache>();
+			frameData.descriptorSetCache->epoch = self->descriptorSetCacheEpoch;
+
+			std::array<vk::DescriptorPoolSize, 4> descriptorPoolSizes{ {
+			    { vk::DescriptorType::eUniformBuffer, DescriptorSetCache::MAX_SETS },
+			    { vk::DescriptorType::eStorageBuffer, DescriptorSetCache::MAX_SETS },
+			    { vk::DescriptorType::eUniformBufferDynamic, DescriptorSetCache::MAX_SETS },
+			    { vk::DescriptorType::eStorageBufferDynamic, DescriptorSetCache::MAX_SETS },
+			} };
+
+			::vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo;
+			descriptorPoolCreateInfo
+			    .setMaxSets( DescriptorSetCache::MAX_SETS )
+			    .setPoolSizeCount( uint32_t( descriptorPoolSizes.size() ) )
+			    .setPPoolSizes( descriptorPoolSizes.data() );
+
+			frameData.descriptorSetCache->pool = vkDevice.createDescriptorPool( descriptorPoolCreateInfo );
+		}
+
 		self->mFrames.emplace_back( std::move( frameData ) );
 	}
 
+	if ( settings->bindlessDescriptors ) {
+		backend_create_bindless_sets( self );
+	}
+
 	{
 		// We want to make sure to have at least one allocator.
 		size_t num_allocators = std::max<size_t>( 1, settings->concurrency_count );
@@ -1513,6 +2068,7 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 		LeRenderPass currentPass{};
 
 		currentPass.type      = renderpass_i.get_type( *pass );
+		currentPass.id        = renderpass_i.get_id( *pass );
 		currentPass.debugName = renderpass_i.get_debug_name( *pass );
 
 		currentPass.width       = renderpass_i.get_width( *pass );
@@ -1528,6 +2084,9 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 			size_t                      resources_count = 0;
 			renderpass_i.get_used_resources( *pass, &resources, &resources_usage, &resources_count );
 
+			currentPass.used_resources.assign( resources, resources + resources_count );
+			std::sort( currentPass.used_resources.begin(), currentPass.used_resources.end(), resource_handle_less );
+
 			for ( size_t i = 0; i != resources_count; ++i ) {
 				auto const &resource = resources[ i ];
 				auto const &usage    = resources_usage[ i ];
@@ -1600,8 +2159,8 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 		auto const &sampleCount = renderpass_i.get_sample_count( *pass );
 		le_renderpass_add_attachments( *pass, currentPass, frame, sampleCount );
 
-		// Note that we "steal" the encoder from the renderer pass -
-		// it becomes now our (the backend's) job to destroy it.
+		// Note that we "steal" the encoder from the renderer pass - the encoder
+		// remains valid until this frame gets cleared.
 		currentPass.encoder = renderpass_i.steal_encoder( *pass );
 
 		frame.passes.emplace_back( std::move( currentPass ) );
@@ -1638,13 +2197,15 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 	//
 	// Note that only resources of type image may be implicitly synced.
 
-	typedef std::unordered_map<le_resource_handle_t, uint32_t, LeResourceHandleIdentity> SyncChainMap;
+	// Maximum sync chain index per resource, indexed by the resource's frame-local index in the
+	// sync chain table - every resource referenced by a pass has a sync chain at this point.
+	// Offset 0 holds the initial state of a sync chain, which no barrier may target, so we
+	// may use 0 to mean "no index recorded yet".
+	std::vector<uint32_t> max_sync_index( syncChainTable.size(), 0 );
 
-	SyncChainMap max_sync_index;
-
-	auto insert_if_greater = [ &max_sync_index ]( le_resource_handle_t const &key, uint32_t value ) {
-		// Updates map entry to highest value
-		auto &element = max_sync_index[ key ];
+	auto insert_if_greater = [ &max_sync_index, &syncChainTable ]( le_resource_handle_t const &key, uint32_t value ) {
+		// Updates entry to highest value
+		auto &element = max_sync_index[ syncChainTable.index_of( key ) ];
 		element       = std::max( element, value );
 	};
 
@@ -1670,15 +2231,15 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 			// We can skip checks for buffer barriers, as we assume they are
 			// all needed.
 
-			auto found_it = max_sync_index.find( op.resource_id );
-			if ( found_it != max_sync_index.end() && found_it->second >= op.sync_chain_offset_final ) {
-				// found an element, and current index is already higher than barrier index.
+			auto &max_index = max_sync_index[ syncChainTable.index_of( op.resource_id ) ];
+			if ( max_index >= op.sync_chain_offset_final ) {
+				// current index is already higher than barrier index.
 				op.active = false;
 			} else {
-				// no element found, or max index is smaller.
+				// no index recorded, or max index is smaller.
 				op.active = true;
 				// store the current max index, then.
-				max_sync_index[ op.resource_id ] = op.sync_chain_offset_final;
+				max_index = op.sync_chain_offset_final;
 			}
 		}
 
@@ -1698,21 +2259,42 @@ static void frame_track_resource_state( BackendFrameData &frame, le_renderpass_o
 // ----------------------------------------------------------------------
 
 /// \brief polls frame fence, returns true if fence has been crossed, false otherwise.
+/// \note  Non-blocking: the frame fence is the frame's value on the backend frame timeline.
 static bool backend_poll_frame_fence( le_backend_o *self, size_t frameIndex ) {
 	auto &     frame  = self->mFrames[ frameIndex ];
 	vk::Device device = self->device->getVkDevice();
 
-	// Non-blocking, polling
-	// auto result = device.getFenceStatus( {frame.frameFence} );
+	return device.getSemaphoreCounterValue( self->frameTimeline ) >= frame.timelineValue;
+}
+
+// ----------------------------------------------------------------------
+/// \brief waits until frame fence has been crossed, or timeout (in nanoseconds) has passed.
+/// \returns true if fence has been crossed, false if we timed out.
+static bool backend_wait_frame_fence( le_backend_o *self, size_t frameIndex, uint64_t timeout_ns ) {
+	auto &     frame  = self->mFrames[ frameIndex ];
+	vk::Device device = self->device->getVkDevice();
+
+	vk::SemaphoreWaitInfo waitInfo;
+	waitInfo
+	    .setSemaphoreCount( 1 )
+	    .setPSemaphores( &self->frameTimeline )
+	    .setPValues( &frame.timelineValue );
 
 	// NOTE: this may block.
-	auto result = device.waitForFences( { frame.frameFence }, true, 1000'000'000 );
+	auto result = device.waitSemaphores( waitInfo, timeout_ns );
 
-	if ( result != vk::Result::eSuccess ) {
-		return false;
-	} else {
-		return true;
-	}
+	return result == vk::Result::eSuccess;
+}
+
+// ----------------------------------------------------------------------
+/// \brief returns the number of frames which have been submitted to the gpu, but which the gpu has not yet completed.
+static uint32_t backend_get_gpu_frames_in_flight( le_backend_o *self ) {
+	vk::Device device = self->device->getVkDevice();
+
+	uint64_t completed = device.getSemaphoreCounterValue( self->frameTimeline );
+	uint64_t submitted = self->frameTimelineValue;
+
+	return submitted > completed ? uint32_t( submitted - completed ) : 0;
 }
 
 // ----------------------------------------------------------------------
@@ -1725,24 +2307,30 @@ static bool backend_clear_frame( le_backend_o *self, size_t frameIndex ) {
 	auto &     frame  = self->mFrames[ frameIndex ];
 	vk::Device device = self->device->getVkDevice();
 
-	//	auto result = device.waitForFences( {frame.frameFence}, true, 100'000'000 );
-
-	//	if ( result != vk::Result::eSuccess ) {
-	//		return false;
-	//	}
-
 	// -------- Invariant: fence has been crossed, all resources protected by fence
 	//          can now be claimed back.
 
-	device.resetFences( { frame.frameFence } );
+	// -- reset all frame-local sub-allocators, but first record how much memory the frame used
+	frame.transientAllocatorStats = {};
 
-	// -- reset all frame-local sub-allocators
 	for ( auto &alloc : frame.allocators ) {
-		le_allocator_linear_i.reset( alloc );
+		le_allocator_linear_stats_t stats;
+		le_allocator_linear_i.get_stats( alloc, &stats );
+
+		frame.transientAllocatorStats.bytes_used += stats.bytes_used;
+		frame.transientAllocatorStats.bytes_capacity += stats.bytes_capacity;
+		frame.transientAllocatorStats.high_water_mark += stats.high_water_mark;
+		frame.transientAllocatorStats.first_block_capacity += stats.first_block_capacity;
+		frame.transientAllocatorStats.num_blocks += stats.num_blocks;
+
+		if ( le_allocator_linear_i.reset( alloc ) ) {
+			self->descriptorSetCacheEpoch++; // allocator re-allocated its buffers, cached descriptor sets might reference these
+		}
 	}
 
 	// -- reset frame-local staging allocator
 	le_staging_allocator_i.reset( frame.stagingAllocator );
+	le_staging_allocator_i.get_stats( frame.stagingAllocator, &frame.stagingAllocatorStats );
 
 	// -- remove any texture references
 	frame.textures_per_pass.clear();
@@ -1763,6 +2351,7 @@ static bool backend_clear_frame( le_backend_o *self, size_t frameIndex ) {
 			switch ( r.type ) {
 			case AbstractPhysicalResource::eBuffer:
 				device.destroyBuffer( r.asBuffer );
+				self->descriptorSetCacheEpoch++; // cached descriptor sets might reference this buffer
 				break;
 			case AbstractPhysicalResource::eFramebuffer:
 				device.destroyFramebuffer( r.asFramebuffer );
@@ -1788,22 +2377,51 @@ static bool backend_clear_frame( le_backend_o *self, size_t frameIndex ) {
 		frame.ownedResources.clear();
 	}
 
-	device.freeCommandBuffers( frame.commandPool, frame.commandBuffers );
+	// -- publish descriptor set cache stats, and flush the cache if it went stale
+	descriptor_set_cache_clear_frame( device, frame.descriptorSetCache.get(), self->descriptorSetCacheEpoch );
+
+	for ( auto &p : frame.commandPools ) {
+		if ( !p.allocated.empty() ) {
+			device.freeCommandBuffers( p.pool, p.allocated );
+			p.allocated.clear();
+		}
+	}
 	frame.commandBuffers.clear();
 
-	frame.physicalResources.clear();
 	frame.syncChainTable.clear();
 
-	for ( auto &f : frame.passes ) {
-		if ( f.encoder ) {
-			using namespace le_renderer;
-			encoder_i.destroy( f.encoder );
-			f.encoder = nullptr;
+	{
+		// -- read back gpu timestamps for passes - these remain available until the next clear.
+
+		frame.passGpuIds.clear();
+		frame.passGpuDurations.clear();
+
+		if ( frame.timestampQueryCount ) {
+
+			std::array<uint64_t, LE_MAX_TIMESTAMP_QUERIES> timestamps;
+
+			auto result = device.getQueryPoolResults( frame.timestampQueryPool, 0, frame.timestampQueryCount,
+			                                          sizeof( uint64_t ) * frame.timestampQueryCount, timestamps.data(),
+			                                          sizeof( uint64_t ), vk::QueryResultFlagBits::e64 );
+
+			if ( result == vk::Result::eSuccess ) {
+				for ( uint32_t i = 0; i + 1 < frame.timestampQueryCount && i / 2 < frame.passes.size(); i += 2 ) {
+					frame.passGpuIds.push_back( frame.passes[ i / 2 ].id );
+					frame.passGpuDurations.push_back( uint64_t( double( timestamps[ i + 1 ] - timestamps[ i ] ) * self->timestampPeriod ) );
+				}
+			}
+
+			frame.timestampQueryCount = 0;
 		}
 	}
+
+	// Note: we don't destroy encoders, as they are owned by the renderer's
+	// per-frame encoder pool, which gets reset once this frame has been cleared.
 	frame.passes.clear();
 
-	device.resetCommandPool( frame.commandPool, vk::CommandPoolResetFlagBits::eReleaseResources );
+	for ( auto &p : frame.commandPools ) {
+		device.resetCommandPool( p.pool, vk::CommandPoolResetFlagBits::eReleaseResources );
+	}
 
 	return true;
 };
@@ -1906,7 +2524,7 @@ static void backend_create_renderpasses( BackendFrameData &frame, vk::Device &de
 
 			if ( PRINT_DEBUG_MESSAGES ) {
 
-				std::cout << std::setw( 30 ) << attachment->resource_id.debug_name << "(s:" << attachment->resource_id.getNumSamples() << ")"
+				std::cout << std::setw( 30 ) << attachment->resource_id.getDebugName() << "(s:" << attachment->resource_id.getNumSamples() << ")"
 				          << " : " << std::setw( 30 ) << vk::to_string( syncInitial.layout )
 				          << " : " << std::setw( 30 ) << vk::to_string( syncSubpass.layout )
 				          << " : " << std::setw( 30 ) << vk::to_string( syncFinal.layout )
@@ -2118,7 +2736,7 @@ static void backend_create_renderpasses( BackendFrameData &frame, vk::Device &de
 // ----------------------------------------------------------------------
 
 /// \brief fetch vk::Buffer from frame local storage based on resource handle flags
-/// - allocatorBuffers[index] if transient,
+/// - buffer of allocator[index & 0xff], block[index >> 8] if transient,
 /// - stagingAllocator.buffers[index] if staging,
 /// otherwise, fetch from frame available resources based on an id lookup.
 static inline vk::Buffer frame_data_get_buffer_from_le_resource_id( const BackendFrameData &frame, const le_resource_handle_t &resource ) {
@@ -2126,7 +2744,8 @@ static inline vk::Buffer frame_data_get_buffer_from_le_resource_id( const Backen
 	assert( resource.getResourceType() == LeResourceType::eBuffer ); // resource type must be buffer
 
 	if ( resource.getFlags() == le_resource_handle_t::FlagBits::eIsVirtual ) {
-		return frame.allocatorBuffers[ resource.getIndex() ];
+		using namespace le_backend_vk; // for le_allocator_linear_i
+		return le_allocator_linear_i.get_vk_buffer( frame.allocators[ resource.getIndex() & 0xff ], uint8_t( resource.getIndex() >> 8 ) );
 	} else if ( resource.getFlags() == le_resource_handle_t::FlagBits::eIsStaging ) {
 		return frame.stagingAllocator->buffers[ resource.getIndex() ];
 	} else {
@@ -2185,8 +2804,8 @@ vk::ImageAspectFlags get_aspect_flags_from_format( vk::Format const &format ) {
 
 // ----------------------------------------------------------------------
 // input: Pass
-// output: framebuffer, append newly created imageViews to retained resources list.
-static void backend_create_frame_buffers( BackendFrameData &frame, vk::Device &device ) {
+// output: framebuffer, attachment image views are taken from the backend's image view cache.
+static void backend_create_frame_buffers( BackendFrameData &frame, vk::Device &device, ImageViewCache *imageViewCache ) {
 
 	for ( auto &pass : frame.passes ) {
 
@@ -2220,20 +2839,7 @@ static void backend_create_frame_buffers( BackendFrameData &frame, vk::Device &d
 			    .setComponents( {} ) // default-constructor '{}' means identity
 			    .setSubresourceRange( subresourceRange );
 
-			auto imageView = device.createImageView( imageViewCreateInfo );
-
-			framebufferAttachments.push_back( imageView );
-
-			{
-				// Retain imageviews in owned resources - they will be released
-				// once not needed anymore.
-
-				AbstractPhysicalResource iv;
-				iv.type        = AbstractPhysicalResource::eImageView;
-				iv.asImageView = imageView;
-
-				frame.ownedResources.emplace_front( std::move( iv ) );
-			}
+			framebufferAttachments.push_back( image_view_cache_get( device, imageViewCache, imageViewCreateInfo ) );
 		}
 
 		vk::FramebufferCreateInfo framebufferCreateInfo;
@@ -2563,32 +3169,9 @@ static inline AllocatedResourceVk allocate_resource_vk( const VmaAllocator &allo
 
 // ----------------------------------------------------------------------
 
-// Creates a new staging allocator
-// Typically, there is one staging allocator associated to each frame.
-static le_staging_allocator_o *staging_allocator_create( VmaAllocator const vmaAlloc, VkDevice const device ) {
-	auto self       = new le_staging_allocator_o{};
-	self->allocator = vmaAlloc;
-	self->device    = device;
-	return self;
-}
-
-// ----------------------------------------------------------------------
-
-// Allocates a chunk of memory from the vulkan free store via vmaAlloc, and maps it
-// for writing at *pData.
-//
-// If successful, `resource_handle` receives a valid `le_resource_handle` referring to
-// this particular chunk of staging memory.
-//
-// Returns false on error, true on success.
-//
-// Staging memory is only allowed to be used for staging, that is, only
-// TRANSFER_SRC are set for usage flags.
-//
-// Staging memory is typically cache coherent, ie. does not need to be flushed.
-static bool staging_allocator_map( le_staging_allocator_o *self, uint64_t numBytes, void **pData, le_resource_handle_t *resource_handle ) {
-
-	auto lock = std::scoped_lock( self->mtx );
+// Creates a persistently mapped buffer to be used for staging, and appends it to
+// the staging allocator's buffers. Mutex must be held, or access must be exclusive.
+static bool staging_allocator_create_buffer( le_staging_allocator_o *self, uint64_t numBytes ) {
 
 	VmaAllocation     allocation; // handle to allocation
 	VkBuffer          buffer;     // handle to buffer (returned from vmaMemAlloc)
@@ -2617,65 +3200,182 @@ static bool staging_allocator_map( le_staging_allocator_o *self, uint64_t numByt
 		return false;
 	}
 
-	{
-		// -- Now store our allocation in the allocations vectors.
-		//
-		// We need to lock the mutex as we are updating all vectors
-		// and this might lead to re-allocations.
-		//
-		// Other encoders might also want to map memory, and
-		// they will have to wait for whichever operation in
-		// process to finish.
+	self->allocations.push_back( allocation );
+	self->allocationInfo.push_back( allocationInfo );
+	self->buffers.push_back( buffer );
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+// Sets up staging ring from buffers[0].
+static void staging_allocator_update_ring( le_staging_allocator_o *self ) {
+	self->ring_mapped_memory = static_cast<uint8_t *>( self->allocationInfo[ 0 ].pMappedData );
+	self->ring_capacity      = self->allocationInfo[ 0 ].size;
+	self->ring_offset        = 0;
+}
+
+// ----------------------------------------------------------------------
+
+// Creates a new staging allocator
+// Typically, there is one staging allocator associated to each frame.
+static le_staging_allocator_o *staging_allocator_create( VmaAllocator const vmaAlloc, VkDevice const device ) {
+	auto self       = new le_staging_allocator_o{};
+	self->allocator = vmaAlloc;
+	self->device    = device;
+
+	bool result = staging_allocator_create_buffer( self, LE_STAGING_RING_SIZE );
+	assert( result && "could not allocate staging ring" );
+
+	if ( result ) {
+		staging_allocator_update_ring( self );
+	}
+
+	return self;
+}
+
+// ----------------------------------------------------------------------
+
+// Hands out a chunk of mapped memory for writing at *pData.
+//
+// Allocations are sub-allocated from the staging ring without locking, as long as
+// the ring has space. If an upload does not fit into the ring, we fall back to a
+// dedicated allocation from the vulkan free store via vmaAlloc.
+//
+// If successful, `resource_handle` receives a valid `le_resource_handle` referring to
+// the buffer which holds this particular chunk of staging memory, and `offset`
+// receives the offset of the chunk into this buffer.
+//
+// Returns false on error, true on success.
+//
+// Staging memory is only allowed to be used for staging, that is, only
+// TRANSFER_SRC are set for usage flags.
+//
+// Staging memory is typically cache coherent, ie. does not need to be flushed.
+static bool staging_allocator_map( le_staging_allocator_o *self, uint64_t numBytes, void **pData, le_resource_handle_t *resource_handle, uint64_t *offset ) {
+
+	// Virtual resources all share the same id,
+	// but their meta data is different.
+	auto resource = LE_BUF_RESOURCE( "Le-Staging-Buffer" );
+	resource.handle.as_handle.meta.as_meta.flags = le_resource_handle_t::FlagBits::eIsStaging;
 
-		size_t allocationIndex = self->allocations.size();
+	self->bytes_requested += numBytes;
+
+	// -- Try to sub-allocate from the staging ring first.
+	//
+	// Note that we align allocations so that any offset is valid as a buffer offset
+	// for buffer-to-image copies, whatever the format of the target image. Since the
+	// ring starts at offset 0, and all allocation sizes are rounded up to multiples of
+	// LE_STAGING_ALIGNMENT, all offsets handed out are multiples of LE_STAGING_ALIGNMENT.
+	//
+	// A reservation which does not fit fails without consuming any ring space - one
+	// oversized upload must not push all later uploads onto the slow path below.
 
-		self->allocations.push_back( allocation );
-		self->allocationInfo.push_back( allocationInfo );
-		self->buffers.push_back( buffer );
+	uint64_t allocationSizeInBytes = LE_STAGING_ALIGNMENT * ( ( numBytes + ( LE_STAGING_ALIGNMENT - 1 ) ) / LE_STAGING_ALIGNMENT );
+	uint64_t ringOffset            = 0;
 
-		// Virtual resources all share the same id,
-		// but their meta data is different.
-		auto resource = LE_BUF_RESOURCE( "Le-Staging-Buffer" );
+	if ( le_staging_ring_reserve( self->ring_offset, self->ring_capacity, allocationSizeInBytes, &ringOffset ) ) {
 
-		// We store the allocation index in the resource handle meta data
-		// so that the correct buffer for this handle can be retrieved later.
-		resource.handle.as_handle.meta.as_meta.index = uint16_t( allocationIndex );
-		resource.handle.as_handle.meta.as_meta.flags = le_resource_handle_t::FlagBits::eIsStaging;
+		// The staging ring is held in buffers[0]
+		resource.handle.as_handle.meta.as_meta.index = 0;
 
-		// Store the handle for this resource so that the caller
-		// may receive it.
+		*pData           = self->ring_mapped_memory + ringOffset;
+		*offset          = ringOffset;
 		*resource_handle = resource;
+
+		return true;
+	}
+
+	// ----------| invariant: ring is full, or allocation is larger than ring: we must fall back to a dedicated allocation
+
+	auto lock = std::scoped_lock( self->mtx );
+
+	if ( false == staging_allocator_create_buffer( self, numBytes ) ) {
+		return false;
 	}
 
-	// Map memory so that it may be written to
-	vmaMapMemory( self->allocator, allocation, pData );
+	self->bytes_dedicated += numBytes;
+	self->num_dedicated_allocations++;
+
+	// We store the allocation index in the resource handle meta data
+	// so that the correct buffer for this handle can be retrieved later.
+	resource.handle.as_handle.meta.as_meta.index = uint16_t( self->buffers.size() - 1 );
+
+	*pData           = self->allocationInfo.back().pMappedData;
+	*offset          = 0;
+	*resource_handle = resource;
 
 	return true;
 };
 
 // ----------------------------------------------------------------------
 
-/// Frees all allocations held by the staging allocator given in `self`
+/// Frees all dedicated allocations held by the staging allocator given in `self`, and recycles
+/// the staging ring. If the last frame needed more staging memory than the staging ring could
+/// hold, the ring gets re-allocated, so that next time it can hold a frame's worth of uploads.
 static void staging_allocator_reset( le_staging_allocator_o *self ) {
-	auto lock   = std::scoped_lock( self->mtx );
-	auto device = vk::Device{ self->device };
+	auto lock = std::scoped_lock( self->mtx );
 
 	assert( self->buffers.size() == self->allocations.size() && self->buffers.size() == self->allocationInfo.size() &&
 	        "buffers, allocations, and allocationInfos sizes must match." );
 
+	self->last_stats.bytes_requested           = self->bytes_requested.exchange( 0 );
+	self->last_stats.bytes_dedicated           = self->bytes_dedicated.exchange( 0 );
+	self->last_stats.num_dedicated_allocations = self->num_dedicated_allocations.exchange( 0 );
+	self->last_stats.ring_capacity             = self->ring_capacity;
+
+	if ( self->buffers.empty() ) {
+		return;
+	}
+
+	// Work out whether the staging ring should grow - we only grow the ring if the
+	// last frame overflowed the ring, and we never grow it beyond LE_STAGING_RING_MAX_SIZE.
+
+	uint64_t ringCapacity = self->ring_capacity;
+
+	while ( ringCapacity < self->last_stats.bytes_requested && ringCapacity < LE_STAGING_RING_MAX_SIZE ) {
+		ringCapacity *= 2;
+	}
+
+	ringCapacity = std::min<uint64_t>( ringCapacity, LE_STAGING_RING_MAX_SIZE );
+
 	// Since buffers were allocated using the VMA allocator,
 	// we cannot delete them directly using the device. We must delete them using the allocator,
 	// so that the allocator can track current allocations.
+	//
+	// Note that we keep the staging ring (buffers[0]), unless it must grow.
+
+	size_t first_buffer_to_destroy = ( ringCapacity > self->ring_capacity ) ? 0 : 1;
+
+	for ( size_t i = first_buffer_to_destroy; i < self->buffers.size(); i++ ) {
+		vmaDestroyBuffer( self->allocator, self->buffers[ i ], self->allocations[ i ] ); // implicitly calls vmaFreeMemory()
+	}
 
-	auto allocation = self->allocations.begin();
-	for ( auto b = self->buffers.begin(); b != self->buffers.end(); b++, allocation++ ) {
-		vmaUnmapMemory( self->allocator, *allocation );
-		vmaDestroyBuffer( self->allocator, *b, *allocation ); // implicitly calls vmaFreeMemory()
+	self->buffers.resize( first_buffer_to_destroy );
+	self->allocations.resize( first_buffer_to_destroy );
+	self->allocationInfo.resize( first_buffer_to_destroy );
+
+	if ( self->buffers.empty() ) {
+		bool result = staging_allocator_create_buffer( self, ringCapacity ) ||
+		              staging_allocator_create_buffer( self, LE_STAGING_RING_SIZE );
+		assert( result && "could not allocate staging ring" );
+		if ( !result ) {
+			self->ring_mapped_memory = nullptr;
+			self->ring_capacity      = 0;
+			self->ring_offset        = 0;
+			return;
+		}
 	}
 
-	self->buffers.clear();
-	self->allocations.clear();
-	self->allocationInfo.clear();
+	staging_allocator_update_ring( self );
+}
+
+// ----------------------------------------------------------------------
+
+static void staging_allocator_get_stats( le_staging_allocator_o *self, le_staging_allocator_stats_t *stats ) {
+	auto lock = std::scoped_lock( self->mtx );
+	*stats    = self->last_stats;
 }
 
 // ----------------------------------------------------------------------
@@ -2683,8 +3383,17 @@ static void staging_allocator_reset( le_staging_allocator_o *self ) {
 // Destroys a staging allocator (and implicitly all of its derived objects)
 static void staging_allocator_destroy( le_staging_allocator_o *self ) {
 
-	// Reset the object first so that dependent objects (vmaAllocations, vulkan objects) are cleaned up.
-	staging_allocator_reset( self );
+	{
+		auto lock = std::scoped_lock( self->mtx );
+
+		for ( size_t i = 0; i != self->buffers.size(); i++ ) {
+			vmaDestroyBuffer( self->allocator, self->buffers[ i ], self->allocations[ i ] ); // implicitly calls vmaFreeMemory()
+		}
+
+		self->buffers.clear();
+		self->allocations.clear();
+		self->allocationInfo.clear();
+	}
 
 	delete self;
 }
@@ -2692,15 +3401,20 @@ static void staging_allocator_destroy( le_staging_allocator_o *self ) {
 // ----------------------------------------------------------------------
 
 // Frees any resources which are marked for being recycled in the current frame.
-inline void frame_release_binned_resources( BackendFrameData &frame, vk::Device device, VmaAllocator &allocator ) {
+// Returns true if any buffers were freed.
+inline bool frame_release_binned_resources( BackendFrameData &frame, vk::Device device, VmaAllocator &allocator, ImageViewCache *imageViewCache ) {
+	bool released_buffers = false;
 	for ( auto &a : frame.binnedResources ) {
 		if ( a.second.info.isBuffer() ) {
 			vmaDestroyBuffer( allocator, a.second.as.buffer, a.second.allocation );
+			released_buffers = true;
 		} else {
+			image_view_cache_evict_image( device, imageViewCache, a.second.as.image );
 			vmaDestroyImage( allocator, a.second.as.image, a.second.allocation );
 		}
 	}
 	frame.binnedResources.clear();
+	return released_buffers;
 }
 
 // ----------------------------------------------------------------------
@@ -3041,10 +3755,7 @@ static void insert_msaa_versions(
 // ----------------------------------------------------------------------
 
 static void printResourceInfo( le_resource_handle_t const &handle, ResourceCreateInfo const &info ) {
-	// when printing debug name we test whether the first glyph might be an utf-8 ellispis, in which
-	// case we must add two spaces to make up for the shorter length (in terms of glyphs) of the utf-8
-	// printout.
-	std::cout << ( handle.debug_name[ 0 ] == char( 0xe2 ) ? "  " : "" ) << std::setw( 32 ) << handle.debug_name;
+	std::cout << std::setw( 32 ) << handle.getDebugName();
 	if ( info.isBuffer() ) {
 		std::cout
 		    << " : " << std::dec << std::setw( 11 ) << ( info.bufferInfo.size )
@@ -3084,7 +3795,7 @@ static bool inferImageFormat( le_backend_o *self, le_resource_handle_t const &re
 	auto inferred_format = infer_image_format_from_le_image_usage_flags( self, usageFlags );
 
 	if ( inferred_format == le::Format::eUndefined ) {
-		std::cerr << "FATAL: Cannot infer image format, resource underspecified: '" << resource.debug_name << "'" << std::endl
+		std::cerr << "FATAL: Cannot infer image format, resource underspecified: '" << resource.getDebugName() << "'" << std::endl
 		          << "Specify usage, or provide explicit format option for resource to fix this error. " << std::endl
 		          << "Consider using le::RenderModule::declareResource()" << std::endl
 		          << std::flush;
@@ -3128,7 +3839,7 @@ static void frame_resources_set_debug_names( le_backend_vk_instance_o *instance,
 
 		vk::DebugUtilsObjectNameInfoEXT nameInfo;
 
-		nameInfo.setPObjectName( r.first.debug_name );
+		nameInfo.setPObjectName( r.first.getDebugName() );
 
 		switch ( r.first.getResourceType() ) {
 		case LeResourceType::eImage:
@@ -3187,7 +3898,9 @@ static void backend_allocate_resources( le_backend_o *self, BackendFrameData &fr
 	// It's possible that this was more than two frames ago,
 	// depending on how many swapchain images there are.
 	//
-	frame_release_binned_resources( frame, self->device->getVkDevice(), self->mAllocator );
+	if ( frame_release_binned_resources( frame, self->device->getVkDevice(), self->mAllocator, &self->imageViewCache ) ) {
+		self->descriptorSetCacheEpoch++; // cached descriptor sets might reference released buffers
+	}
 
 	// Iterate over all resource declarations in all passes so that we can collect all resources,
 	// and their usage information. Later, we will consolidate their usages so that resources can
@@ -3292,7 +4005,7 @@ static void backend_allocate_resources( le_backend_o *self, BackendFrameData &fr
 				// -- found info is either equal or a superset
 
 				// Add a copy of this resource allocation to the current frame.
-				frame.availableResources.emplace( resourceId, foundIt->second );
+				frame.availableResources.try_emplace( resourceId, foundIt->second );
 
 			} else {
 
@@ -3401,11 +4114,11 @@ static void backend_allocate_resources( le_backend_o *self, BackendFrameData &fr
 		for ( auto const &r : frame.availableResources ) {
 			if ( r.second.info.isBuffer() ) {
 				std::cout << std::setw( 10 ) << "Buffer"
-				          << " : " << std::setw( 30 ) << r.first.debug_name
+				          << " : " << std::setw( 30 ) << r.first.getDebugName()
 				          << " : " << std::setw( 30 ) << r.second.as.buffer << std::endl;
 			} else {
 				std::cout << std::setw( 10 ) << "Image"
-				          << " : " << std::setw( 30 ) << r.first.debug_name << "(s:" << r.first.handle.as_handle.meta.as_meta.num_samples << ")"
+				          << " : " << std::setw( 30 ) << r.first.getDebugName() << "(s:" << r.first.handle.as_handle.meta.as_meta.num_samples << ")"
 				          << " : " << std::setw( 30 ) << r.second.as.image << std::endl;
 			}
 		}
@@ -3419,9 +4132,10 @@ static void backend_allocate_resources( le_backend_o *self, BackendFrameData &fr
 
 // ----------------------------------------------------------------------
 
-// Allocates ImageViews, Samplers and Textures requested by individual passes
-// these are tied to the lifetime of the frame, and will be re-created
-static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Device const &device, le_renderpass_o **passes, size_t numRenderPasses ) {
+// Collects ImageViews, Samplers and Textures requested by individual passes.
+// ImageViews and Samplers are taken from backend-wide caches, so that they may be re-used across
+// frames - only the frame's tables which reference them are tied to the lifetime of the frame.
+static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Device const &device, ImageViewCache *imageViewCache, SamplerCache *samplerCache, le_renderpass_o **passes, size_t numRenderPasses ) {
 
 	using namespace le_renderer;
 
@@ -3466,7 +4180,7 @@ static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Dev
 				// If the format is still undefined at this point, we can only throw our hands up in the air...
 				//
 				if ( imageFormat == vk::Format::eUndefined ) {
-					std::cout << "WARNING: Cannot create default view for image '" << r.debug_name << "', as format is undefined" << std::endl
+					std::cout << "WARNING: Cannot create default view for image '" << r.getDebugName() << "', as format is undefined" << std::endl
 					          << std::flush;
 					continue;
 				}
@@ -3488,17 +4202,9 @@ static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Dev
 				    .setComponents( {} ) // default component mapping
 				    .setSubresourceRange( subresourceRange );
 
-				auto imageView = device.createImageView( imageViewCreateInfo );
-
 				// Store image view object with frame, indexed by image resource id,
 				// so that it can be found quickly if need be.
-				frame.imageViews[ r ] = imageView;
-
-				AbstractPhysicalResource imgView{};
-				imgView.type        = AbstractPhysicalResource::Type::eImageView;
-				imgView.asImageView = imageView;
-
-				frame.ownedResources.emplace_front( std::move( imgView ) );
+				frame.imageViews[ r ] = image_view_cache_get( device, imageViewCache, imageViewCreateInfo );
 			}
 		}
 	}
@@ -3559,21 +4265,12 @@ static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Dev
 					    .setComponents( {} )      // default component mapping
 					    .setSubresourceRange( subresourceRange );
 
-					imageView = device.createImageView( imageViewCreateInfo );
-
-					// Store vk object references with frame-owned resources, so that
-					// the vk objects can be destroyed when frame crosses the fence.
-
-					AbstractPhysicalResource res;
-					res.asImageView = imageView;
-					res.type        = AbstractPhysicalResource::Type::eImageView;
-
-					frame.ownedResources.emplace_front( std::move( res ) );
+					imageView = image_view_cache_get( device, imageViewCache, imageViewCreateInfo );
 				}
 
 				vk::Sampler sampler{};
 				{
-					// Create VkSampler object on device.
+					// Fetch VkSampler from cache - sampler gets created on device if not yet cached.
 
 					vk::SamplerCreateInfo samplerCreateInfo{};
 					samplerCreateInfo
@@ -3594,16 +4291,7 @@ static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Dev
 					    .setBorderColor( le_border_color_to_vk( texInfo.sampler.borderColor ) )
 					    .setUnnormalizedCoordinates( texInfo.sampler.unnormalizedCoordinates );
 
-					sampler = device.createSampler( samplerCreateInfo );
-
-					// Now store vk object references with frame-owned resources, so that
-					// the vk objects can be destroyed when frame crosses the fence.
-
-					AbstractPhysicalResource res;
-
-					res.asSampler = sampler;
-					res.type      = AbstractPhysicalResource::Type::eSampler;
-					frame.ownedResources.emplace_front( std::move( res ) );
+					sampler = sampler_cache_get( device, samplerCache, samplerCreateInfo );
 				}
 
 				// -- Store Texture with frame so that decoder can find references
@@ -3620,6 +4308,125 @@ static void frame_allocate_transient_resources( BackendFrameData &frame, vk::Dev
 	}     // end for all passes
 }
 
+// ----------------------------------------------------------------------
+// Writes descriptors for all registered textures and buffers which this frame uses into
+// the frame's bindless set. We only write array elements whose descriptors differ from
+// what we wrote when this frame was last processed - in steady state, this writes nothing.
+//
+// Writing is safe without update-after-bind hazards, as the frame's bindless set is not in
+// use by the gpu while the frame acquires its resources.
+static void frame_update_bindless_set( le_backend_o *self, BackendFrameData &frame, vk::Device const &device ) {
+
+	if ( nullptr == frame.bindlessSet ) {
+		return;
+	}
+
+	// ----------| invariant: bindless mode is enabled
+
+	// If image views or buffers have been destroyed since we last validated our bindless set, what we
+	// remember having written may refer to handles which have since been re-used by new objects:
+	// we must not trust it, and must write these descriptors again.
+
+	uint64_t imageViewEpoch = self->imageViewCache.evictions;
+	if ( frame.bindlessImageViewEpoch != imageViewEpoch ) {
+		std::fill( frame.bindlessTextures.begin(), frame.bindlessTextures.end(), BackendFrameData::Texture{} );
+		frame.bindlessImageViewEpoch = imageViewEpoch;
+	}
+
+	uint64_t bufferEpoch = self->descriptorSetCacheEpoch;
+	if ( frame.bindlessBufferEpoch != bufferEpoch ) {
+		std::fill( frame.bindlessBuffers.begin(), frame.bindlessBuffers.end(), vk::Buffer{} );
+		frame.bindlessBufferEpoch = bufferEpoch;
+	}
+
+	// We collect descriptor infos first, and only then build write descriptors which point into
+	// them, so that pointers to infos don't get invalidated when vectors grow.
+
+	std::vector<std::pair<uint32_t, vk::DescriptorImageInfo>>  imageInfos;
+	std::vector<std::pair<uint32_t, vk::DescriptorBufferInfo>> bufferInfos;
+
+	{
+		std::scoped_lock lock( self->bindless.mtx );
+
+		if ( !self->bindless.texture_indices.empty() ) {
+			for ( auto const &textures : frame.textures_per_pass ) {
+				for ( auto const &t : textures ) {
+
+					auto found = self->bindless.texture_indices.find( t.first );
+
+					if ( found == self->bindless.texture_indices.end() ) {
+						continue;
+					}
+
+					auto &written = frame.bindlessTextures[ found->second ];
+
+					if ( written.imageView == t.second.imageView && written.sampler == t.second.sampler ) {
+						continue;
+					}
+
+					written = t.second;
+					imageInfos.push_back( { found->second, { t.second.sampler, t.second.imageView, vk::ImageLayout::eShaderReadOnlyOptimal } } );
+				}
+			}
+		}
+
+		if ( !self->bindless.buffer_indices.empty() ) {
+			for ( auto const &r : frame.availableResources ) {
+
+				if ( r.first.getResourceType() != LeResourceType::eBuffer ) {
+					continue;
+				}
+
+				auto found = self->bindless.buffer_indices.find( r.first );
+
+				if ( found == self->bindless.buffer_indices.end() ) {
+					continue;
+				}
+
+				auto &written = frame.bindlessBuffers[ found->second ];
+
+				if ( written == vk::Buffer( r.second.as.buffer ) ) {
+					continue;
+				}
+
+				written = r.second.as.buffer;
+				bufferInfos.push_back( { found->second, { r.second.as.buffer, 0, VK_WHOLE_SIZE } } );
+			}
+		}
+	}
+
+	if ( imageInfos.empty() && bufferInfos.empty() ) {
+		return;
+	}
+
+	// ----------| invariant: there are descriptors to write
+
+	std::vector<vk::WriteDescriptorSet> writes;
+	writes.reserve( imageInfos.size() + bufferInfos.size() );
+
+	for ( auto const &i : imageInfos ) {
+		writes.emplace_back( vk::WriteDescriptorSet()
+		                         .setDstSet( frame.bindlessSet )
+		                         .setDstBinding( LE_BINDLESS_TEXTURE_BINDING )
+		                         .setDstArrayElement( i.first )
+		                         .setDescriptorCount( 1 )
+		                         .setDescriptorType( vk::DescriptorType::eCombinedImageSampler )
+		                         .setPImageInfo( &i.second ) );
+	}
+
+	for ( auto const &b : bufferInfos ) {
+		writes.emplace_back( vk::WriteDescriptorSet()
+		                         .setDstSet( frame.bindlessSet )
+		                         .setDstBinding( LE_BINDLESS_BUFFER_BINDING )
+		                         .setDstArrayElement( b.first )
+		                         .setDescriptorCount( 1 )
+		                         .setDescriptorType( vk::DescriptorType::eStorageBuffer )
+		                         .setPBufferInfo( &b.second ) );
+	}
+
+	device.updateDescriptorSets( uint32_t( writes.size() ), writes.data(), 0, nullptr );
+}
+
 // ----------------------------------------------------------------------
 // This is one of the most important methods of backend -
 // where we associate virtual with physical resources, allocate physical
@@ -3710,7 +4517,7 @@ static bool backend_acquire_physical_resources( le_backend_o *              self
 	// from current entry in frame.availableResources resource map.
 	frame.syncChainTable.clear();
 	for ( auto const &res : frame.availableResources ) {
-		frame.syncChainTable.insert( { res.first, { res.second.state } } );
+		frame.syncChainTable[ res.first ].emplace_back( res.second.state );
 	}
 
 	// -- build sync chain for each resource, create explicit sync barrier requests for resources
@@ -3756,8 +4563,11 @@ static bool backend_acquire_physical_resources( le_backend_o *              self
 
 	vk::Device device = self->device->getVkDevice();
 
-	// -- allocate any transient vk objects such as image samplers, and image views
-	frame_allocate_transient_resources( frame, device, passes, numRenderPasses );
+	// -- fetch any transient vk objects such as image samplers, and image views
+	frame_allocate_transient_resources( frame, device, &self->imageViewCache, &self->samplerCache, passes, numRenderPasses );
+
+	// -- write any changed descriptors for registered textures and buffers into the frame's bindless set
+	frame_update_bindless_set( self, frame, device );
 
 	// create renderpasses - use sync chain to apply implicit syncing for image attachment resources
 	backend_create_renderpasses( frame, device );
@@ -3768,7 +4578,7 @@ static bool backend_acquire_physical_resources( le_backend_o *              self
 	// patch and retain physical resources in bulk here, so that
 	// each pass may be processed independently
 
-	backend_create_frame_buffers( frame, device );
+	backend_create_frame_buffers( frame, device, &self->imageViewCache );
 
 	return true;
 };
@@ -3789,18 +4599,8 @@ static le_allocator_o **backend_create_transient_allocators( le_backend_o *self,
 
 		assert( numAllocators < 256 ); // must not have more than 255 allocators, otherwise we cannot store index in LeResourceHandleMeta.
 
-		VkBuffer          buffer = nullptr;
-		VmaAllocation     allocation;
-		VmaAllocationInfo allocationInfo;
-
-		VmaAllocationCreateInfo createInfo{};
-		createInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
-		createInfo.pool  = frame.allocationPool; // Since we're allocating from a pool all fields but .flags will be taken from the pool
-
 		le_resource_handle_t res = declare_resource_virtual_buffer( uint8_t( i ) );
 
-		createInfo.pUserData = &res;
-
 		VkBufferCreateInfo bufferCreateInfo;
 		{
 			// we use the cpp proxy because it's more ergonomic to fill the values.
@@ -3815,17 +4615,11 @@ static le_allocator_o **backend_create_transient_allocators( le_backend_o *self,
 			bufferCreateInfo = bufferInfoProxy;
 		}
 
-		auto result = vmaCreateBuffer( self->mAllocator, &bufferCreateInfo, &createInfo, &buffer, &allocation, &allocationInfo );
-
-		assert( result == VK_SUCCESS ); // todo: deal with failed allocation
-
-		// Create a new allocator - note that we assume an alignment of 256 bytes
-		le_allocator_o *allocator = le_allocator_linear_i.create( &allocationInfo, 256 );
+		// Create a new allocator - note that we assume an alignment of 256 bytes.
+		// The allocator allocates its blocks from the frame's pool - blocks can't be larger than the pool's blocks.
+		le_allocator_o *allocator = le_allocator_linear_i.create( self->mAllocator, frame.allocationPool, &bufferCreateInfo, res, LE_FRAME_DATA_POOL_BLOCK_SIZE, 256 );
 
 		frame.allocators.emplace_back( allocator );
-		frame.allocatorBuffers.emplace_back( std::move( buffer ) );
-		frame.allocations.emplace_back( std::move( allocation ) );
-		frame.allocationInfos.emplace_back( std::move( allocationInfo ) );
 	}
 
 	return frame.allocators.data();
@@ -3850,8 +4644,123 @@ static bool is_equal( le_pipeline_and_layout_info_t const &lhs, le_pipeline_and_
 	       0 == memcmp( lhs.layout_info.set_layout_keys, rhs.layout_info.set_layout_keys, sizeof( uint64_t ) * lhs.layout_info.set_layout_count );
 }
 
+// ----------------------------------------------------------------------
+// Only descriptor sets which exclusively reference buffers may be cached: cached descriptor sets
+// are invalidated via descriptorSetCacheEpoch, which gets bumped whenever a buffer is destroyed.
+// Image views live in the image view cache, and get evicted (destroyed) together with their
+// image without bumping descriptorSetCacheEpoch - a cached descriptor set could therefore keep
+// referencing a destroyed image view. The descriptor set cache's pool is sized for buffer
+// descriptors only, for the same reason.
+static bool descriptor_set_data_is_cacheable( std::vector<DescriptorData> const &setData ) {
+	for ( auto const &d : setData ) {
+		switch ( d.type ) {
+		case vk::DescriptorType::eUniformBuffer:
+		case vk::DescriptorType::eStorageBuffer:
+		case vk::DescriptorType::eUniformBufferDynamic:
+		case vk::DescriptorType::eStorageBufferDynamic:
+			break;
+		default:
+			return false;
+		}
+	}
+	return !setData.empty();
+}
+
+// ----------------------------------------------------------------------
+
+static uint64_t descriptor_set_data_calculate_hash( vk::DescriptorSetLayout const &setLayout, std::vector<DescriptorData> const &setData ) {
+	uint64_t hash = SpookyHash::Hash64( &setLayout, sizeof( vk::DescriptorSetLayout ), 0 );
+	for ( auto const &d : setData ) {
+		// Note that we hash fields individually, so that we don't pick up any padding bytes.
+		hash = SpookyHash::Hash64( &d.type, sizeof( d.type ), hash );
+		hash = SpookyHash::Hash64( &d.bindingNumber, sizeof( d.bindingNumber ), hash );
+		hash = SpookyHash::Hash64( &d.arrayIndex, sizeof( d.arrayIndex ), hash );
+		hash = SpookyHash::Hash64( d.data, sizeof( d.data ), hash );
+	}
+	return hash;
+}
+
+// ----------------------------------------------------------------------
+// Returns true and sets `descriptorSet` if the cache holds a descriptor set matching layout and data.
+static bool descriptor_set_cache_try_find( DescriptorSetCache *cache, uint64_t hash, vk::DescriptorSetLayout const &setLayout, std::vector<DescriptorData> const &setData, vk::DescriptorSet *descriptorSet ) {
+	std::scoped_lock lock( cache->mtx );
+
+	auto it = cache->entries.find( hash );
+
+	if ( it == cache->entries.end() ||
+	     it->second.setLayout != setLayout ||
+	     it->second.setData != setData ) {
+		return false;
+	}
+
+	*descriptorSet = it->second.descriptorSet;
+	cache->hit_count++;
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Allocates a descriptor set from the cache's pool - returns false if the cache has no more space,
+// in which case the caller must allocate from a frame-local pool instead.
+static bool descriptor_set_cache_allocate( vk::Device const &device, DescriptorSetCache *cache, vk::DescriptorSetLayout const &setLayout, vk::DescriptorSet *descriptorSet ) {
+	std::scoped_lock lock( cache->mtx );
+
+	if ( cache->num_allocated >= DescriptorSetCache::MAX_SETS ) {
+		return false;
+	}
+
+	vk::DescriptorSetAllocateInfo allocateInfo;
+	allocateInfo.setDescriptorPool( cache->pool )
+	    .setDescriptorSetCount( 1 )
+	    .setPSetLayouts( &setLayout );
+
+	auto result = device.allocateDescriptorSets( &allocateInfo, descriptorSet );
+
+	if ( result != vk::Result::eSuccess ) {
+		// Pool has run out of descriptors of some type - mark the cache as full, so that it gets flushed.
+		cache->num_allocated = DescriptorSetCache::MAX_SETS;
+		return false;
+	}
+
+	cache->num_allocated++;
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Descriptor set must have been allocated from the cache pool, and must have been fully written.
+// If another pass has inserted an equivalent descriptor set first, theirs wins, and ours remains
+// unused until the cache gets flushed.
+static void descriptor_set_cache_insert( DescriptorSetCache *cache, uint64_t hash, vk::DescriptorSetLayout const &setLayout, std::vector<DescriptorData> const &setData, vk::DescriptorSet const &descriptorSet ) {
+	std::scoped_lock lock( cache->mtx );
+	cache->entries.try_emplace( hash, DescriptorSetCache::Entry{ setLayout, setData, descriptorSet } );
+}
+
+// ----------------------------------------------------------------------
+// Flushes the cache if it is stale or full, and publishes hit/miss counts for the frame which
+// just got cleared. Must only be called while no pass for this frame is being processed.
+static void descriptor_set_cache_clear_frame( vk::Device const &device, DescriptorSetCache *cache, uint64_t current_epoch ) {
+
+	cache->last_hit_count  = cache->hit_count.exchange( 0 );
+	cache->last_miss_count = cache->miss_count.exchange( 0 );
+
+	if ( cache->epoch == current_epoch && cache->num_allocated < DescriptorSetCache::MAX_SETS ) {
+		return;
+	}
+
+	// ----------| invariant: cache is stale or full - flush it.
+
+	device.resetDescriptorPool( cache->pool );
+	cache->entries.clear();
+	cache->num_allocated = 0;
+	cache->epoch         = current_epoch;
+}
+
+// ----------------------------------------------------------------------
+
 static bool updateArguments( const vk::Device &                 device,
                              const vk::DescriptorPool &         descriptorPool_,
+                             DescriptorSetCache *               descriptorSetCache, // optional: if set, cacheable descriptor sets may be re-used across frames
                              const ArgumentState &              argumentState,
                              std::array<DescriptorSetState, 8> &previousSetData,
                              vk::DescriptorSet *                descriptorSets ) {
@@ -3881,6 +4790,15 @@ static bool updateArguments( const vk::Device &                 device,
 	// -- write data from descriptorSetData into freshly allocated DescriptorSets
 	for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
 
+		if ( argumentState.bindlessSet && argumentState.layouts[ setId ] == argumentState.bindlessSetLayout ) {
+			// The bindless set has been written when the frame acquired its resources - we bind it as it is.
+			// We reset previous set state, as the descriptor set bound at this slot is not a set which
+			// could be re-used for regular arguments.
+			descriptorSets[ setId ]  = argumentState.bindlessSet;
+			previousSetData[ setId ] = {};
+			continue;
+		}
+
 		// If argumentState contains invalid information (for example if an uniform has not been set yet)
 		// this will lead to SEGFAULT. You must ensure that argumentState contains valid information.
 		//
@@ -3966,83 +4884,118 @@ static bool updateArguments( const vk::Device &                 device,
 			     previousSetData[ setId ].setData != argumentState.setData[ setId ] ||
 			     previousSetData[ setId ].setLayout != argumentState.layouts[ setId ] ) {
 
-				vk::DescriptorSetAllocateInfo allocateInfo;
-				allocateInfo.setDescriptorPool( descriptorPool_ )
-				    .setDescriptorSetCount( 1 )
-				    .setPSetLayouts( &argumentState.layouts[ setId ] );
+				// -- Look up the frame's descriptor set cache - if it holds a descriptor set with
+				// identical layout and descriptors, we may use that descriptor set as it is.
 
-				// -- allocate descriptorSets based on current layout
-				// and place them in the correct position
-				auto result = device.allocateDescriptorSets( &allocateInfo, &descriptorSets[ setId ] );
+				bool     is_cacheable = descriptorSetCache && descriptor_set_data_is_cacheable( argumentState.setData[ setId ] );
+				uint64_t set_hash     = 0;
+				bool     needs_write  = true;
 
-				assert( result == vk::Result::eSuccess && "failed to allocate descriptor set" );
+				if ( is_cacheable ) {
+					set_hash    = descriptor_set_data_calculate_hash( argumentState.layouts[ setId ], argumentState.setData[ setId ] );
+					needs_write = !descriptor_set_cache_try_find( descriptorSetCache, set_hash, argumentState.layouts[ setId ], argumentState.setData[ setId ], &descriptorSets[ setId ] );
+				}
 
-				if ( /* DISABLES CODE */ ( false ) ) {
-					// I wish that this would work - but it appears that accelerator decriptors cannot be updated using templates.
-					device.updateDescriptorSetWithTemplate( descriptorSets[ setId ], argumentState.updateTemplates[ setId ], argumentState.setData[ setId ].data() );
-				} else {
+				if ( needs_write ) {
 
-					std::vector<vk::WriteDescriptorSet> write_descriptor_sets;
+					if ( descriptorSetCache ) {
+						descriptorSetCache->miss_count++;
+					}
 
-					// We deliberately allocate write descriptor set acceleration structure objects on the heap,
-					// so that the pointer to the object will not change if and when the vector grows.
+					// -- allocate descriptorSets based on current layout
+					// and place them in the correct position
 					//
-					// This means that we can hand out copies of pointers from this vector without fear from
-					// within the current scope, but also that we must clean up the contents of the vector
-					// manually before leaving the current scope or else we will leak these objects.
-					std::vector<vk::WriteDescriptorSetAccelerationStructureKHR *> write_acceleration_structures;
-
-					write_descriptor_sets.reserve( argumentState.setData[ setId ].size() );
-
-					for ( auto &a : argumentState.setData[ setId ] ) {
-						vk::WriteDescriptorSet w{};
-
-						w
-						    .setDstSet( descriptorSets[ setId ] )
-						    .setDstBinding( a.bindingNumber )
-						    .setDstArrayElement( a.arrayIndex )
-						    .setDescriptorCount( 1 )
-						    .setDescriptorType( a.type ) //
-						    ;
+					// Cacheable descriptor sets are allocated from the cache's pool, as they may
+					// outlive the current frame - all other descriptor sets come from the pass' pool.
+					bool is_allocated_from_cache =
+					    is_cacheable &&
+					    descriptor_set_cache_allocate( device, descriptorSetCache, argumentState.layouts[ setId ], &descriptorSets[ setId ] );
+
+					if ( !is_allocated_from_cache ) {
+						vk::DescriptorSetAllocateInfo allocateInfo;
+						allocateInfo.setDescriptorPool( descriptorPool_ )
+						    .setDescriptorSetCount( 1 )
+						    .setPSetLayouts( &argumentState.layouts[ setId ] );
+
+						auto result = device.allocateDescriptorSets( &allocateInfo, &descriptorSets[ setId ] );
+
+						assert( result == vk::Result::eSuccess && "failed to allocate descriptor set" );
+					}
+
+					if ( /* DISABLES CODE */ ( false ) ) {
+						// I wish that this would work - but it appears that accelerator decriptors cannot be updated using templates.
+						device.updateDescriptorSetWithTemplate( descriptorSets[ setId ], argumentState.updateTemplates[ setId ], argumentState.setData[ setId ].data() );
+					} else {
+
+						std::vector<vk::WriteDescriptorSet> write_descriptor_sets;
+
+						// We deliberately allocate write descriptor set acceleration structure objects on the heap,
+						// so that the pointer to the object will not change if and when the vector grows.
+						//
+						// This means that we can hand out copies of pointers from this vector without fear from
+						// within the current scope, but also that we must clean up the contents of the vector
+						// manually before leaving the current scope or else we will leak these objects.
+						std::vector<vk::WriteDescriptorSetAccelerationStructureKHR *> write_acceleration_structures;
+
+						write_descriptor_sets.reserve( argumentState.setData[ setId ].size() );
+
+						for ( auto &a : argumentState.setData[ setId ] ) {
+							vk::WriteDescriptorSet w{};
+
+							w
+							    .setDstSet( descriptorSets[ setId ] )
+							    .setDstBinding( a.bindingNumber )
+							    .setDstArrayElement( a.arrayIndex )
+							    .setDescriptorCount( 1 )
+							    .setDescriptorType( a.type ) //
+							    ;
+
+							switch ( a.type ) {
+							case vk::DescriptorType::eSampler:
+							case vk::DescriptorType::eCombinedImageSampler:
+							case vk::DescriptorType::eSampledImage:
+							case vk::DescriptorType::eStorageImage:
+							case vk::DescriptorType::eInputAttachment:
+								w.setPImageInfo( reinterpret_cast<vk::DescriptorImageInfo const *>( &a.imageInfo ) );
+								break;
+							case vk::DescriptorType::eUniformTexelBuffer:
+							case vk::DescriptorType::eStorageTexelBuffer:
+								w.setPTexelBufferView( reinterpret_cast<vk::BufferView const *>( &a.texelBufferInfo ) );
+								break;
+							case vk::DescriptorType::eUniformBuffer:
+							case vk::DescriptorType::eStorageBuffer:
+							case vk::DescriptorType::eUniformBufferDynamic:
+							case vk::DescriptorType::eStorageBufferDynamic:
+								w.setPBufferInfo( reinterpret_cast<vk::DescriptorBufferInfo const *>( &a.bufferInfo ) );
+								break;
+							case vk::DescriptorType::eInlineUniformBlockEXT:
+								assert( false && "inline uniform blocks are not yet supported" );
+								break;
+							case vk::DescriptorType::eAccelerationStructureKHR:
+								auto wd                        = new vk::WriteDescriptorSetAccelerationStructureKHR{};
+								wd->accelerationStructureCount = 1;
+								wd->pAccelerationStructures    = &a.accelerationStructureInfo.accelerationStructure;
+								w.setPNext( wd );
+								break;
+							}
 
-						switch ( a.type ) {
-						case vk::DescriptorType::eSampler:
-						case vk::DescriptorType::eCombinedImageSampler:
-						case vk::DescriptorType::eSampledImage:
-						case vk::DescriptorType::eStorageImage:
-						case vk::DescriptorType::eInputAttachment:
-							w.setPImageInfo( reinterpret_cast<vk::DescriptorImageInfo const *>( &a.imageInfo ) );
-							break;
-						case vk::DescriptorType::eUniformTexelBuffer:
-						case vk::DescriptorType::eStorageTexelBuffer:
-							w.setPTexelBufferView( reinterpret_cast<vk::BufferView const *>( &a.texelBufferInfo ) );
-							break;
-						case vk::DescriptorType::eUniformBuffer:
-						case vk::DescriptorType::eStorageBuffer:
-						case vk::DescriptorType::eUniformBufferDynamic:
-						case vk::DescriptorType::eStorageBufferDynamic:
-							w.setPBufferInfo( reinterpret_cast<vk::DescriptorBufferInfo const *>( &a.bufferInfo ) );
-							break;
-						case vk::DescriptorType::eInlineUniformBlockEXT:
-							assert( false && "inline uniform blocks are not yet supported" );
-							break;
-						case vk::DescriptorType::eAccelerationStructureKHR:
-							auto wd                        = new vk::WriteDescriptorSetAccelerationStructureKHR{};
-							wd->accelerationStructureCount = 1;
-							wd->pAccelerationStructures    = &a.accelerationStructureInfo.accelerationStructure;
-							w.setPNext( wd );
-							break;
+							write_descriptor_sets.emplace_back( w );
 						}
+						device.updateDescriptorSets( uint32_t( write_descriptor_sets.size() ), write_descriptor_sets.data(), 0, nullptr );
 
-						write_descriptor_sets.emplace_back( w );
+						// We must manually delete any WriteDescriptorSetAccelerationStructureKHR objects
+						for ( auto &w : write_acceleration_structures ) {
+							delete ( w );
+						}
 					}
-					device.updateDescriptorSets( uint32_t( write_descriptor_sets.size() ), write_descriptor_sets.data(), 0, nullptr );
 
-					// We must manually delete any WriteDescriptorSetAccelerationStructureKHR objects
-					for ( auto &w : write_acceleration_structures ) {
-						delete ( w );
+					if ( is_allocated_from_cache ) {
+						// Only insert once the descriptor set has been written: other passes may
+						// pick up the descriptor set from the cache as soon as it has been inserted.
+						descriptor_set_cache_insert( descriptorSetCache, set_hash, argumentState.layouts[ setId ], argumentState.setData[ setId ], descriptorSets[ setId ] );
 					}
 				}
+
 				previousSetData[ setId ].setData   = argumentState.setData[ setId ];
 				previousSetData[ setId ].setLayout = argumentState.layouts[ setId ];
 			}
@@ -4085,6 +5038,7 @@ static void debug_print_command( void *&cmd ) {
                 case(le::CommandType::eDrawMeshTasks): std::cout << "eDrawMeshTasks"; break;
                 case(le::CommandType::eTraceRays): std::cout << "eTraceRays"; break;
                 case(le::CommandType::eSetArgumentTlas): std::cout << "eSetArgumentTlas"; break;
+                case(le::CommandType::eNextChunk): std::cout << "eNextChunk"; break;
 			}
 	// clang-format on
 
@@ -4098,1374 +5052,1946 @@ static void debug_print_command( void *&cmd ) {
 };
 
 // ----------------------------------------------------------------------
-// Decode commandStream for each pass (may happen in parallel)
-// translate into vk specific commands.
-static void backend_process_frame( le_backend_o *self, size_t frameIndex ) {
-
-	if ( PRINT_DEBUG_MESSAGES ) {
-		std::cout << "** Process Frame #" << std::dec << std::setw( 8 ) << frameIndex << " **" << std::endl
-		          << std::flush;
-	}
+// Frame capture file layout - all values are stored in native byte order:
+//
+//   header        : magic, version, sizeof( le_resource_handle_t ), pass count, allocator count, reserved
+//   allocators [] : resource id, number of bytes, bytes
+//   passes     [] : pass id, pass type, number of commands, number of bytes, bytes
 
-	using namespace le_renderer;   // for encoder
-	using namespace le_backend_vk; // for device
+constexpr uint32_t LE_FRAME_CAPTURE_MAGIC   = 0x4643454c; // 'LECF'
+constexpr uint32_t LE_FRAME_CAPTURE_VERSION = 1;
 
-	auto &frame = self->mFrames[ frameIndex ];
+// ----------------------------------------------------------------------
+// Copies a (possibly chunked) command stream into a tightly packed array.
+static void frame_capture_flatten_command_stream( void *commandStream, size_t numCommands, std::vector<char> &result ) {
 
-	vk::Device device = self->device->getVkDevice();
+	void *dataIt = commandStream;
 
-	static_assert( sizeof( vk::Viewport ) == sizeof( le::Viewport ), "Viewport data size must be same in vk and le" );
-	static_assert( sizeof( vk::Rect2D ) == sizeof( le::Rect2D ), "Rect2D data size must be same in vk and le" );
+	for ( size_t commandIndex = 0; commandIndex != numCommands; ) {
 
-	static auto maxVertexInputBindings = vk_device_i.get_vk_physical_device_properties( *self->device ).limits.maxVertexInputBindings;
+		auto header = static_cast<le::CommandHeader *>( dataIt );
 
-	// TODO: (parallelize) when going wide, there needs to be a commandPool for each execution context so that
-	// command buffer generation may be free-threaded.
-	auto numCommandBuffers = uint32_t( frame.passes.size() );
-	auto cmdBufs           = device.allocateCommandBuffers( { frame.commandPool, vk::CommandBufferLevel::ePrimary, numCommandBuffers } );
+		if ( header->info.type == le::CommandType::eNextChunk ) {
+			dataIt = static_cast<le::CommandNextChunk *>( dataIt )->info.next_chunk;
+			continue;
+		}
 
-	std::array<vk::ClearValue, 16> clearValues{};
+		auto cmd_begin = static_cast<char const *>( dataIt );
+		result.insert( result.end(), cmd_begin, cmd_begin + header->info.size );
 
-	// TODO: (parallel for)
-	// note that access to any caches when creating pipelines and layouts and descriptorsets must be
-	// mutex-controlled when processing happens concurrently.
-	for ( size_t passIndex = 0; passIndex != frame.passes.size(); ++passIndex ) {
+		dataIt = static_cast<char *>( dataIt ) + header->info.size;
+		commandIndex++;
+	}
+}
 
-		auto &pass           = frame.passes[ passIndex ];
-		auto &cmd            = cmdBufs[ passIndex ];
-		auto &descriptorPool = frame.descriptorPools[ passIndex ];
+// ----------------------------------------------------------------------
+// Points payload pointers in captured commands to their payloads - these pointers
+// become invalid once a command has been copied. Gathers resources and textures
+// which the pass' commands refer to.
+//
+// Returns false if pass contains commands which refer to staging memory: staging
+// memory is not part of a capture, which means these passes can't be replayed.
+// Returns false as well if commands refer to transient allocators which are not
+// part of the capture.
+static bool frame_capture_fixup_pass( le_frame_capture_t::pass_t &pass, size_t allocator_count ) {
+
+	char *dataIt  = pass.commands.data();
+	char *dataEnd = dataIt + pass.commands.size();
+
+	pass.resources.clear();
+	pass.textures.clear();
+
+	bool refs_ok = true;
+
+	auto add_resource = [ & ]( le_resource_handle_t const &resource ) {
+		if ( resource.getFlags() == le_resource_handle_t::FlagBits::eIsVirtual ) {
+			// Transient buffers are backed by allocators - their contents are restored from the capture.
+			refs_ok &= ( ( resource.getIndex() & 0xff ) < allocator_count );
+		} else if ( resource.getFlags() == le_resource_handle_t::FlagBits::eIsStaging ) {
+			refs_ok = false;
+		} else {
+			pass.resources.push_back( resource );
+		}
+	};
 
-		// create frame buffer, based on swapchain and renderpass
+	for ( size_t commandIndex = 0; commandIndex != pass.num_commands; commandIndex++ ) {
 
-		cmd.begin( { ::vk::CommandBufferUsageFlagBits::eOneTimeSubmit } );
+		if ( dataIt + sizeof( le::CommandHeader ) > dataEnd ) {
+			return false;
+		}
 
-		{
+		auto header = reinterpret_cast<le::CommandHeader *>( dataIt );
 
-			if ( PRINT_DEBUG_MESSAGES ) {
-				std::cout << "Renderpass: '" << pass.debugName << "'" << std::endl
-				          << std::flush;
+		if ( header->info.size < sizeof( le::CommandHeader ) || dataIt + header->info.size > dataEnd ) {
+			return false;
+		}
+
+		switch ( header->info.type ) {
+		case le::CommandType::eBindVertexBuffers: {
+			auto le_cmd = reinterpret_cast<le::CommandBindVertexBuffers *>( dataIt );
+			if ( sizeof( *le_cmd ) + le_cmd->info.bindingCount * ( sizeof( le_resource_handle_t ) + sizeof( uint64_t ) ) > header->info.size ) {
+				return false;
+			}
+			le_cmd->info.pBuffers = reinterpret_cast<le_resource_handle_t *>( le_cmd + 1 );
+			le_cmd->info.pOffsets = reinterpret_cast<uint64_t *>( le_cmd->info.pBuffers + le_cmd->info.bindingCount );
+			for ( uint32_t i = 0; i != le_cmd->info.bindingCount; i++ ) {
+				add_resource( le_cmd->info.pBuffers[ i ] );
+			}
+		} break;
+		case le::CommandType::eBindIndexBuffer:
+			add_resource( reinterpret_cast<le::CommandBindIndexBuffer *>( dataIt )->info.buffer );
+			break;
+		case le::CommandType::eBindArgumentBuffer:
+			add_resource( reinterpret_cast<le::CommandBindArgumentBuffer *>( dataIt )->info.buffer_id );
+			break;
+		case le::CommandType::eSetArgumentTexture:
+			pass.textures.push_back( reinterpret_cast<le::CommandSetArgumentTexture *>( dataIt )->info.texture_id );
+			break;
+		case le::CommandType::eSetArgumentImage:
+			add_resource( reinterpret_cast<le::CommandSetArgumentImage *>( dataIt )->info.image_id );
+			break;
+		case le::CommandType::eSetArgumentTlas:
+			add_resource( reinterpret_cast<le::CommandSetArgumentTlas *>( dataIt )->info.tlas_id );
+			break;
+		case le::CommandType::eBindRtxPipeline:
+			add_resource( reinterpret_cast<le::CommandBindRtxPipeline *>( dataIt )->info.sbt_buffer );
+			break;
+		case le::CommandType::eBuildRtxBlas: {
+			auto le_cmd = reinterpret_cast<le::CommandBuildRtxBlas *>( dataIt );
+			if ( sizeof( *le_cmd ) + le_cmd->info.blas_handles_count * sizeof( le_resource_handle_t ) > header->info.size ) {
+				return false;
+			}
+			auto blas_handles = reinterpret_cast<le_resource_handle_t const *>( le_cmd + 1 );
+			for ( uint32_t i = 0; i != le_cmd->info.blas_handles_count; i++ ) {
+				add_resource( blas_handles[ i ] );
 			}
+		} break;
+		case le::CommandType::eWriteToBuffer: // fall-through
+		case le::CommandType::eWriteToImage:  // fall-through
+		case le::CommandType::eBuildRtxTlas:  // fall-through
+		case le::CommandType::eNextChunk:
+			return false;
+		default:
+			break;
+		}
 
-			// -- Issue sync barriers for all resources which require explicit sync.
-			//
-			// We must to this here, as the spec requires barriers to happen
-			// before renderpass begin.
-			//
-			for ( auto const &op : pass.explicit_sync_ops ) {
-				// fill in sync op
+		if ( !refs_ok ) {
+			return false;
+		}
 
-				if ( op.active == false ) {
-					continue;
-				}
+		dataIt += header->info.size;
+	}
 
-				// ---------| invariant: barrier is active.
+	std::sort( pass.resources.begin(), pass.resources.end(), resource_handle_less );
+	pass.resources.erase( std::unique( pass.resources.begin(), pass.resources.end() ), pass.resources.end() );
 
-				auto const &syncChain = frame.syncChainTable[ op.resource_id ];
+	std::sort( pass.textures.begin(), pass.textures.end() );
+	pass.textures.erase( std::unique( pass.textures.begin(), pass.textures.end() ), pass.textures.end() );
 
-				auto const &stateInitial = syncChain[ op.sync_chain_offset_initial ];
-				auto const &stateFinal   = syncChain[ op.sync_chain_offset_final ];
+	return true;
+}
 
-				if ( stateInitial != stateFinal ) {
-					// we must issue an image barrier
+// ----------------------------------------------------------------------
 
-					if ( PRINT_DEBUG_MESSAGES ) {
+static std::unique_ptr<le_frame_capture_t> frame_capture_create( BackendFrameData const &frame ) {
+	using namespace le_renderer;   // for encoder
+	using namespace le_backend_vk; // for le_allocator_linear_i
 
-						//
-						// --------| invariant: barrier is active.
+	auto capture = std::make_unique<le_frame_capture_t>();
+
+	for ( auto const &allocator : frame.allocators ) {
+		void const *data     = nullptr;
+		uint64_t    numBytes = 0;
+		if ( !le_allocator_linear_i.get_used_data( allocator, &data, &numBytes ) ) {
+			// Captured commands may only reference the first block of each allocator.
+			std::cout << "WARNING: Cannot capture frame: transient allocations did not fit into first block of allocator." << std::endl
+			          << std::flush;
+			return nullptr;
+		}
+
+		le_frame_capture_t::allocator_t a;
+		a.resource_id = le_allocator_linear_i.get_le_resource_id( allocator );
+		a.data.assign( static_cast<char const *>( data ), static_cast<char const *>( data ) + numBytes );
+		capture->allocators.emplace_back( std::move( a ) );
+	}
 
-						// print out sync chain for sampled image
-						std::cout << "\t Explicit Barrier for: " << op.resource_id.debug_name << "(s:" << op.resource_id.getNumSamples() << ")" << std::endl;
+	for ( auto const &pass : frame.passes ) {
+		le_frame_capture_t::pass_t p{};
+		p.id   = pass.id;
+		p.type = pass.type;
 
-						std::cout << "\t " << std::setw( 3 ) << "#"
-						          << " : " << std::setw( 30 ) << "visible_access"
-						          << " : " << std::setw( 30 ) << "write_stage"
-						          << " : "
-						          << "layout" << std::endl;
+		if ( pass.encoder ) {
+			void * commandStream = nullptr;
+			size_t dataSize      = 0;
+			size_t numCommands   = 0;
+			encoder_i.get_encoded_data( pass.encoder, &commandStream, &dataSize, &numCommands );
+			p.num_commands = numCommands;
+			p.commands.reserve( dataSize );
+			frame_capture_flatten_command_stream( commandStream, numCommands, p.commands );
+		}
 
-						auto const &syncChain = frame.syncChainTable.at( op.resource_id );
+		capture->passes.emplace_back( std::move( p ) );
+	}
 
-						for ( size_t i = op.sync_chain_offset_initial; i <= op.sync_chain_offset_final; i++ ) {
-							auto const &s = syncChain[ i ];
+	return capture;
+}
 
-							std::cout << "\t " << std::setw( 3 ) << std::dec << i
-							          << " : " << std::setw( 30 ) << to_string( s.visible_access )
-							          << " : " << std::setw( 30 ) << to_string( s.write_stage )
-							          << " : " << to_string( s.layout ) << std::endl;
-						}
+// ----------------------------------------------------------------------
 
-						std::cout << std::flush;
-					}
+static bool frame_capture_write( le_frame_capture_t const &capture, char const *file_path ) {
 
-					auto dstImage = frame_data_get_image_from_le_resource_id( frame, op.resource_id );
+	std::ofstream os( file_path, std::ios::out | std::ios::binary | std::ios::trunc );
 
-					vk::ImageSubresourceRange rangeAllMiplevels;
-					rangeAllMiplevels
-					    .setAspectMask( vk::ImageAspectFlagBits::eColor )
-					    .setBaseMipLevel( 0 )
-					    .setLevelCount( VK_REMAINING_MIP_LEVELS ) // we want all miplevels to be in transferDstOptimal.
-					    .setBaseArrayLayer( 0 )
-					    .setLayerCount( VK_REMAINING_ARRAY_LAYERS );
-
-					vk::ImageMemoryBarrier imageLayoutTransfer;
-					imageLayoutTransfer
-					    .setSrcAccessMask( stateInitial.visible_access ) // no prior access
-					    .setDstAccessMask( stateFinal.visible_access )   // ready image for transferwrite
-					    .setOldLayout( stateInitial.layout )             // from vk::ImageLayout::eUndefined
-					    .setNewLayout( stateFinal.layout )               // to transfer_dst_optimal
-					    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-					    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-					    .setImage( dstImage )
-					    .setSubresourceRange( rangeAllMiplevels );
+	if ( !os.is_open() ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not open file for writing: '" << file_path << "'" << std::endl
+		          << std::flush;
+		return false;
+	}
 
-					cmd.pipelineBarrier(
-					    uint32_t( stateInitial.write_stage ) == 0 ? vk::PipelineStageFlagBits::eTopOfPipe : stateInitial.write_stage, // srcStage, top of pipe if not set.
-					    stateFinal.write_stage,                                                                                       // dstStage
-					    {},
-					    {},
-					    {},                     // buffer: host write -> transfer read
-					    { imageLayoutTransfer } // image: transfer layout
-					);
-				}
-			} // end for all explicit sync ops.
+	// ---------| invariant: file is open for writing
+
+	auto write_value = [ &os ]( auto const &value ) {
+		os.write( reinterpret_cast<char const *>( &value ), sizeof( value ) );
+	};
+
+	write_value( LE_FRAME_CAPTURE_MAGIC );
+	write_value( LE_FRAME_CAPTURE_VERSION );
+	write_value( uint32_t( sizeof( le_resource_handle_t ) ) );
+	write_value( uint32_t( capture.passes.size() ) );
+	write_value( uint32_t( capture.allocators.size() ) );
+	write_value( uint32_t( 0 ) ); // reserved
+
+	for ( auto const &a : capture.allocators ) {
+		write_value( a.resource_id );
+		write_value( uint64_t( a.data.size() ) );
+		os.write( a.data.data(), std::streamsize( a.data.size() ) );
+	}
+
+	for ( auto const &p : capture.passes ) {
+		write_value( p.id );
+		write_value( uint32_t( p.type ) );
+		write_value( uint64_t( p.num_commands ) );
+		write_value( uint64_t( p.commands.size() ) );
+		os.write( p.commands.data(), std::streamsize( p.commands.size() ) );
+	}
+
+	return bool( os );
+}
+
+// ----------------------------------------------------------------------
+
+static std::shared_ptr<le_frame_capture_t> frame_capture_read( char const *file_path ) {
+
+	std::ifstream is( file_path, std::ios::in | std::ios::binary );
+
+	if ( !is.is_open() ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not open file for reading: '" << file_path << "'" << std::endl
+		          << std::flush;
+		return nullptr;
+	}
+
+	// ---------| invariant: file is open for reading
+
+	auto read_value = [ &is ]( auto &value ) -> bool {
+		return bool( is.read( reinterpret_cast<char *>( &value ), sizeof( value ) ) );
+	};
+
+	// Guard against corrupt files - no single block in a capture may be larger than this.
+	constexpr uint64_t max_block_size = uint64_t( 1 ) << 32;
+
+	auto read_block = [ &is ]( std::vector<char> &block, uint64_t num_bytes ) -> bool {
+		if ( num_bytes > max_block_size ) {
+			return false;
 		}
+		block.resize( num_bytes );
+		return bool( is.read( block.data(), std::streamsize( num_bytes ) ) );
+	};
 
-		// Draw passes must begin by opening a Renderpass context.
-		if ( pass.type == LE_RENDER_PASS_TYPE_DRAW && pass.renderPass ) {
+	uint32_t magic           = 0;
+	uint32_t version         = 0;
+	uint32_t handle_size     = 0;
+	uint32_t pass_count      = 0;
+	uint32_t allocator_count = 0;
+	uint32_t reserved        = 0;
+
+	if ( !read_value( magic ) || !read_value( version ) || !read_value( handle_size ) ||
+	     !read_value( pass_count ) || !read_value( allocator_count ) || !read_value( reserved ) ||
+	     magic != LE_FRAME_CAPTURE_MAGIC ||
+	     version != LE_FRAME_CAPTURE_VERSION ||
+	     handle_size != sizeof( le_resource_handle_t ) ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " not a compatible frame capture: '" << file_path << "'" << std::endl
+		          << std::flush;
+		return nullptr;
+	}
+
+	auto capture = std::make_shared<le_frame_capture_t>();
+
+	capture->allocators.resize( allocator_count );
+
+	for ( auto &a : capture->allocators ) {
+		uint64_t num_bytes = 0;
+		if ( !read_value( a.resource_id ) || !read_value( num_bytes ) || !read_block( a.data, num_bytes ) ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not read allocator data from frame capture: '" << file_path << "'" << std::endl
+			          << std::flush;
+			return nullptr;
+		}
+	}
+
+	capture->passes.resize( pass_count );
+
+	for ( auto &p : capture->passes ) {
+		uint32_t type      = 0;
+		uint64_t num_bytes = 0;
+		if ( !read_value( p.id ) || !read_value( type ) || !read_value( p.num_commands ) ||
+		     !read_value( num_bytes ) || !read_block( p.commands, num_bytes ) ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not read pass data from frame capture: '" << file_path << "'" << std::endl
+			          << std::flush;
+			return nullptr;
+		}
+		p.type = LeRenderPassType( type );
+
+		if ( !frame_capture_fixup_pass( p, capture->allocators.size() ) ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " frame capture contains pass which can't be replayed: '" << file_path << "'" << std::endl
+			          << std::flush;
+			return nullptr;
+		}
+	}
+
+	return capture;
+}
+
+// ----------------------------------------------------------------------
+// A capture may replace a frame's command streams only if the frame has the same
+// passes, in the same order, if each of the frame's passes declares all resources
+// and textures which the captured commands for that pass refer to, and if the
+// frame's transient allocators can hold the captured allocator data.
+static bool frame_capture_matches_frame( le_frame_capture_t const &capture, BackendFrameData const &frame ) {
+
+	if ( capture.passes.size() != frame.passes.size() ||
+	     capture.allocators.size() > frame.allocators.size() ) {
+		return false;
+	}
 
-			for ( size_t i = 0; i != ( pass.numColorAttachments + pass.numDepthStencilAttachments ); ++i ) {
-				clearValues[ i ] = pass.attachments[ i ].clearValue;
+	for ( size_t i = 0; i != capture.passes.size(); i++ ) {
+		auto const &c = capture.passes[ i ];
+		auto const &p = frame.passes[ i ];
+		if ( c.id != p.id ||
+		     c.type != p.type ||
+		     ( c.num_commands != 0 && p.encoder == nullptr ) ) {
+			return false;
+		}
+
+		// Captured commands must not refer to resources which this frame's pass does not declare -
+		// these would either not exist in this frame, or would not have been synchronised for this pass.
+		if ( !std::includes( p.used_resources.begin(), p.used_resources.end(), c.resources.begin(), c.resources.end(), resource_handle_less ) ) {
+			return false;
+		}
+
+		auto const &textures = frame.textures_per_pass[ i ];
+
+		for ( auto const &t : c.textures ) {
+			if ( textures.find( t ) == textures.end() ) {
+				return false;
 			}
+		}
+	}
+
+	for ( size_t i = 0; i != capture.allocators.size(); i++ ) {
+		auto const &a = capture.allocators[ i ];
+
+		le_allocator_linear_stats_t stats;
+		le_backend_vk::le_allocator_linear_i.get_stats( frame.allocators[ i ], &stats );
 
-			vk::RenderPassBeginInfo renderPassBeginInfo;
-			renderPassBeginInfo
-			    .setRenderPass( pass.renderPass )
-			    .setFramebuffer( pass.framebuffer )
-			    .setRenderArea( vk::Rect2D( { 0, 0 }, { pass.width, pass.height } ) )
-			    .setClearValueCount( pass.numColorAttachments + pass.numDepthStencilAttachments )
-			    .setPClearValues( clearValues.data() );
+		// Note that we compare the resource id for the allocator's first block - the capture
+		// was taken from first blocks only.
+		le_resource_handle_t resource_id = le_backend_vk::le_allocator_linear_i.get_le_resource_id( frame.allocators[ i ] );
+		resource_id.handle.as_handle.meta.as_meta.index &= 0xff;
 
-			cmd.beginRenderPass( renderPassBeginInfo, vk::SubpassContents::eInline );
+		if ( a.resource_id != resource_id ||
+		     a.data.size() > stats.first_block_capacity ) {
+			return false;
 		}
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+static void backend_request_frame_capture( le_backend_o *self, char const *file_path ) {
+	std::scoped_lock lock( self->frame_capture.mtx );
+	self->frame_capture.request_path = file_path ? file_path : "";
+}
+
+// ----------------------------------------------------------------------
 
-		// -- Translate intermediary command stream data to api-native instructions
+static bool backend_load_frame_capture( le_backend_o *self, char const *file_path ) {
 
-		void *   commandStream = nullptr;
-		size_t   dataSize      = 0;
-		size_t   numCommands   = 0;
-		size_t   commandIndex  = 0;
-		uint32_t subpassIndex  = 0;
+	std::shared_ptr<le_frame_capture_t const> capture;
+
+	if ( file_path ) {
+		capture = frame_capture_read( file_path );
+		if ( nullptr == capture ) {
+			return false;
+		}
+	}
+
+	std::scoped_lock lock( self->frame_capture.mtx );
+	self->frame_capture.replay = std::move( capture );
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Returns index of the worker thread on which we are currently running - each
+// worker records into command buffers allocated from its own command pool.
+static inline size_t fetch_worker_index() {
+#if ( LE_MT > 0 )
+	int result = le_jobs::get_current_worker_id();
+	assert( result >= 0 );
+	return size_t( result );
+#else
+	return 0;
+#endif
+}
+
+// ----------------------------------------------------------------------
+// Allocates a primary command buffer from the command pool of the current worker.
+static vk::CommandBuffer frame_allocate_command_buffer( vk::Device const &device, BackendFrameData &frame ) {
+	auto worker_index = fetch_worker_index();
+	assert( worker_index < frame.commandPools.size() && "there must be a command pool for each worker" );
+
+	auto &pool = frame.commandPools[ worker_index ];
+	auto  cmd  = device.allocateCommandBuffers( { pool.pool, vk::CommandBufferLevel::ePrimary, 1 } )[ 0 ];
+
+	pool.allocated.push_back( cmd );
+
+	return cmd;
+}
+
+// ----------------------------------------------------------------------
+// Translates the command stream of the pass at passIndex into vk specific commands,
+// and returns the command buffer into which these commands were recorded.
+//
+// Passes may be processed concurrently: we may only read from frame data which is
+// shared between passes, and caches which we write to must be internally synchronised.
+static vk::CommandBuffer backend_process_pass( le_backend_o *self, BackendFrameData &frame, size_t passIndex, le_frame_capture_t const *replay ) {
+
+	using namespace le_renderer;   // for encoder
+	using namespace le_backend_vk; // for device
+
+	vk::Device device = self->device->getVkDevice();
+
+	static_assert( sizeof( vk::Viewport ) == sizeof( le::Viewport ), "Viewport data size must be same in vk and le" );
+	static_assert( sizeof( vk::Rect2D ) == sizeof( le::Rect2D ), "Rect2D data size must be same in vk and le" );
+
+	static auto maxVertexInputBindings = vk_device_i.get_vk_physical_device_properties( *self->device ).limits.maxVertexInputBindings;
+
+	std::array<vk::ClearValue, 16> clearValues{};
+
+
+	auto &pass           = frame.passes[ passIndex ];
+	auto  cmd            = frame_allocate_command_buffer( device, frame );
+	auto &descriptorPool = frame.descriptorPools[ passIndex ];
+
+	// Bypass the descriptor set cache if any buffer has been destroyed since it was last flushed:
+	// cached descriptor sets might reference stale buffer handles.
+	DescriptorSetCache *descriptorSetCache =
+	    ( frame.descriptorSetCache->epoch == self->descriptorSetCacheEpoch ) ? frame.descriptorSetCache.get() : nullptr;
+
+	// create frame buffer, based on swapchain and renderpass
+
+	cmd.begin( { ::vk::CommandBufferUsageFlagBits::eOneTimeSubmit } );
+
+	const uint32_t timestampQueryIndex = uint32_t( passIndex * 2 );
+
+	if ( timestampQueryIndex + 1 < frame.timestampQueryCount ) {
+		// Queries must be reset outside of a renderpass, before they are written to.
+		cmd.resetQueryPool( frame.timestampQueryPool, timestampQueryIndex, 2 );
+		cmd.writeTimestamp( vk::PipelineStageFlagBits::eTopOfPipe, frame.timestampQueryPool, timestampQueryIndex );
+	}
+
+	{
 
-		vk::PipelineLayout currentPipelineLayout;
-		vk::DescriptorSet  descriptorSets[ VK_MAX_BOUND_DESCRIPTOR_SETS ] = {}; // currently bound descriptorSets (allocated from pool, therefore we must not worry about freeing, and may re-use freely)
+		if ( PRINT_DEBUG_MESSAGES ) {
+			std::cout << "Renderpass: '" << pass.debugName << "'" << std::endl
+			          << std::flush;
+		}
 
-		// We store currently bound descriptors so that we only allocate new DescriptorSets
-		// if the descriptors really change. With dynamic descriptors, it is very likely
-		// that we don't need to allocate new descriptors, as the same descriptors are used
-		// for different accessors, only with different dynamic binding offsets.
+		// -- Issue sync barriers for all resources which require explicit sync.
 		//
+		// We must to this here, as the spec requires barriers to happen
+		// before renderpass begin.
 		//
-		std::array<DescriptorSetState, 8> previousSetState; ///< currently bound descriptorSetLayout+Data for each set
-
-		ArgumentState argumentState{};
-
-		struct RtxState {
-			bool                 is_set;
-			le_resource_handle_t sbt_buffer; // shader binding table buffer
-			uint64_t             ray_gen_sbt_offset;
-			uint64_t             ray_gen_sbt_size;
-			uint64_t             miss_sbt_offset;
-			uint64_t             miss_sbt_stride;
-			uint64_t             miss_sbt_size;
-			uint64_t             hit_sbt_offset;
-			uint64_t             hit_sbt_stride;
-			uint64_t             hit_sbt_size;
-			uint64_t             callable_sbt_offset;
-			uint64_t             callable_sbt_stride;
-			uint64_t             callable_sbt_size;
-		};
-
-		RtxState rtx_state{}; // used to keep track of shader binding tables bound with rtx pipelines.
+		for ( auto const &op : pass.explicit_sync_ops ) {
+			// fill in sync op
 
-		if ( pass.encoder ) {
-			encoder_i.get_encoded_data( pass.encoder, &commandStream, &dataSize, &numCommands );
-		} else {
+			if ( op.active == false ) {
+				continue;
+			}
 
-			// This is legit behaviour for draw passes which are used only to clear attachments,
-			// in which case they don't need to include any draw commands.
+			// ---------| invariant: barrier is active.
 
-			// assert( false );
-			//std::cout << "WARNING: pass '" << pass.debugName << "' does not have valid encoder." << std::endl
-			//          << std::flush;
-		}
+			auto const &syncChain = frame.syncChainTable.at( op.resource_id );
 
-		if ( commandStream != nullptr && numCommands > 0 ) {
+			auto const &stateInitial = syncChain[ op.sync_chain_offset_initial ];
+			auto const &stateFinal   = syncChain[ op.sync_chain_offset_final ];
 
-			le_pipeline_manager_o *pipelineManager = encoder_i.get_pipeline_manager( pass.encoder );
+			if ( stateInitial != stateFinal ) {
+				// we must issue an image barrier
 
-			std::vector<vk::Buffer>       vertexInputBindings( maxVertexInputBindings, nullptr );
-			void *                        dataIt = commandStream;
-			le_pipeline_and_layout_info_t currentPipeline{};
+				if ( PRINT_DEBUG_MESSAGES ) {
 
-			while ( commandIndex != numCommands ) {
+					//
+					// --------| invariant: barrier is active.
 
-				auto header = static_cast<le::CommandHeader *>( dataIt );
+					// print out sync chain for sampled image
+					std::cout << "\t Explicit Barrier for: " << op.resource_id.getDebugName() << "(s:" << op.resource_id.getNumSamples() << ")" << std::endl;
 
-				if ( /* DISABLES CODE */ ( false ) ) {
-					// Print the command stream to stdout.
-					debug_print_command( dataIt );
-				}
+					std::cout << "\t " << std::setw( 3 ) << "#"
+					          << " : " << std::setw( 30 ) << "visible_access"
+					          << " : " << std::setw( 30 ) << "write_stage"
+					          << " : "
+					          << "layout" << std::endl;
 
-				switch ( header->info.type ) {
+					auto const &syncChain = frame.syncChainTable.at( op.resource_id );
 
-				case le::CommandType::eBindGraphicsPipeline: {
-					auto *le_cmd = static_cast<le::CommandBindGraphicsPipeline *>( dataIt );
+					for ( size_t i = op.sync_chain_offset_initial; i <= op.sync_chain_offset_final; i++ ) {
+						auto const &s = syncChain[ i ];
 
-					if ( pass.type == LE_RENDER_PASS_TYPE_DRAW ) {
-						// at this point, a valid renderpass must be bound
+						std::cout << "\t " << std::setw( 3 ) << std::dec << i
+						          << " : " << std::setw( 30 ) << to_string( s.visible_access )
+						          << " : " << std::setw( 30 ) << to_string( s.write_stage )
+						          << " : " << to_string( s.layout ) << std::endl;
+					}
 
-						using namespace le_backend_vk;
-						// -- potentially compile and create pipeline here, based on current pass and subpass
-						auto requestedPipeline = le_pipeline_manager_i.produce_graphics_pipeline( pipelineManager, le_cmd->info.gpsoHandle, pass, subpassIndex );
+					std::cout << std::flush;
+				}
 
-						if ( /* DISABLES CODE */ ( false ) ) {
+				auto dstImage = frame_data_get_image_from_le_resource_id( frame, op.resource_id );
 
-							// Print pipeline debug info when a new pipeline gets bound.
+				vk::ImageSubresourceRange rangeAllMiplevels;
+				rangeAllMiplevels
+				    .setAspectMask( vk::ImageAspectFlagBits::eColor )
+				    .setBaseMipLevel( 0 )
+				    .setLevelCount( VK_REMAINING_MIP_LEVELS ) // we want all miplevels to be in transferDstOptimal.
+				    .setBaseArrayLayer( 0 )
+				    .setLayerCount( VK_REMAINING_ARRAY_LAYERS );
+
+				vk::ImageMemoryBarrier imageLayoutTransfer;
+				imageLayoutTransfer
+				    .setSrcAccessMask( stateInitial.visible_access ) // no prior access
+				    .setDstAccessMask( stateFinal.visible_access )   // ready image for transferwrite
+				    .setOldLayout( stateInitial.layout )             // from vk::ImageLayout::eUndefined
+				    .setNewLayout( stateFinal.layout )               // to transfer_dst_optimal
+				    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+				    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+				    .setImage( dstImage )
+				    .setSubresourceRange( rangeAllMiplevels );
+
+				cmd.pipelineBarrier(
+				    uint32_t( stateInitial.write_stage ) == 0 ? vk::PipelineStageFlagBits::eTopOfPipe : stateInitial.write_stage, // srcStage, top of pipe if not set.
+				    stateFinal.write_stage,                                                                                       // dstStage
+				    {},
+				    {},
+				    {},                     // buffer: host write -> transfer read
+				    { imageLayoutTransfer } // image: transfer layout
+				);
+			}
+		} // end for all explicit sync ops.
+	}
 
-							std::cout << "Requested pipeline: " << std::hex << le_cmd->info.gpsoHandle << std::endl;
-							debug_print_le_pipeline_layout_info( &requestedPipeline.layout_info );
-							std::cout << std::flush;
-						}
+	// Draw passes must begin by opening a Renderpass context.
+	if ( pass.type == LE_RENDER_PASS_TYPE_DRAW && pass.renderPass ) {
 
-						if ( !is_equal( currentPipeline, requestedPipeline ) ) {
-							// update current pipeline
-							currentPipeline = requestedPipeline;
-							// -- grab current pipeline layout from cache
-							currentPipelineLayout = le_pipeline_manager_i.get_pipeline_layout( pipelineManager, currentPipeline.layout_info.pipeline_layout_key );
-							// -- update pipelineData - that's the data values for all descriptors which are currently bound
+		for ( size_t i = 0; i != ( pass.numColorAttachments + pass.numDepthStencilAttachments ); ++i ) {
+			clearValues[ i ] = pass.attachments[ i ].clearValue;
+		}
 
-							argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
-							argumentState.binding_infos.clear();
+		vk::RenderPassBeginInfo renderPassBeginInfo;
+		renderPassBeginInfo
+		    .setRenderPass( pass.renderPass )
+		    .setFramebuffer( pass.framebuffer )
+		    .setRenderArea( vk::Rect2D( { 0, 0 }, { pass.width, pass.height } ) )
+		    .setClearValueCount( pass.numColorAttachments + pass.numDepthStencilAttachments )
+		    .setPClearValues( clearValues.data() );
 
-							// -- reset dynamic offset count
-							argumentState.dynamicOffsetCount = 0;
+		cmd.beginRenderPass( renderPassBeginInfo, vk::SubpassContents::eInline );
+	}
 
-							// let's create descriptorData vector based on current bindings-
-							for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
+	// -- Translate intermediary command stream data to api-native instructions
 
-								// look up set layout info via set layout key
-								auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
+	void *   commandStream = nullptr;
+	size_t   dataSize      = 0;
+	size_t   numCommands   = 0;
+	size_t   commandIndex  = 0;
+	uint32_t subpassIndex  = 0;
 
-								auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
+	vk::PipelineLayout currentPipelineLayout;
+	vk::DescriptorSet  descriptorSets[ VK_MAX_BOUND_DESCRIPTOR_SETS ] = {}; // currently bound descriptorSets (allocated from pool, therefore we must not worry about freeing, and may re-use freely)
 
-								auto &setData = argumentState.setData[ setId ];
+	// We store currently bound descriptors so that we only allocate new DescriptorSets
+	// if the descriptors really change. With dynamic descriptors, it is very likely
+	// that we don't need to allocate new descriptors, as the same descriptors are used
+	// for different accessors, only with different dynamic binding offsets.
+	//
+	//
+	std::array<DescriptorSetState, 8> previousSetState; ///< currently bound descriptorSetLayout+Data for each set
+
+	ArgumentState argumentState{};
+	argumentState.bindlessSetLayout = self->bindless.setLayout;
+	argumentState.bindlessSet       = frame.bindlessSet;
+
+	struct RtxState {
+		bool                 is_set;
+		le_resource_handle_t sbt_buffer; // shader binding table buffer
+		uint64_t             ray_gen_sbt_offset;
+		uint64_t             ray_gen_sbt_size;
+		uint64_t             miss_sbt_offset;
+		uint64_t             miss_sbt_stride;
+		uint64_t             miss_sbt_size;
+		uint64_t             hit_sbt_offset;
+		uint64_t             hit_sbt_stride;
+		uint64_t             hit_sbt_size;
+		uint64_t             callable_sbt_offset;
+		uint64_t             callable_sbt_stride;
+		uint64_t             callable_sbt_size;
+	};
 
-								argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
-								argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
+	RtxState rtx_state{}; // used to keep track of shader binding tables bound with rtx pipelines.
 
-								setData.clear();
-								setData.reserve( setLayoutInfo->binding_info.size() );
+	if ( replay ) {
+		auto &captured_pass = replay->passes[ passIndex ];
+		commandStream       = const_cast<char *>( captured_pass.commands.data() );
+		dataSize            = captured_pass.commands.size();
+		numCommands         = captured_pass.num_commands;
+	} else if ( pass.encoder ) {
+		encoder_i.get_encoded_data( pass.encoder, &commandStream, &dataSize, &numCommands );
+	} else {
 
-								for ( auto b : setLayoutInfo->binding_info ) {
+		// This is legit behaviour for draw passes which are used only to clear attachments,
+		// in which case they don't need to include any draw commands.
 
-									// add an entry for each array element with this binding to setData
-									for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
-										DescriptorData descriptorData{};
+		// assert( false );
+		//std::cout << "WARNING: pass '" << pass.debugName << "' does not have valid encoder." << std::endl
+		//          << std::flush;
+	}
 
-										descriptorData.type          = vk::DescriptorType( b.type );
-										descriptorData.bindingNumber = uint32_t( b.binding );
-										descriptorData.arrayIndex    = uint32_t( arrayIndex );
+	if ( commandStream != nullptr && numCommands > 0 ) {
 
-										if ( b.type == vk::DescriptorType::eStorageBuffer ||
-										     b.type == vk::DescriptorType::eUniformBuffer ||
-										     b.type == vk::DescriptorType::eStorageBufferDynamic ||
-										     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
+		le_pipeline_manager_o *pipelineManager = encoder_i.get_pipeline_manager( pass.encoder );
 
-											descriptorData.bufferInfo.range = b.range;
-										}
+		std::vector<vk::Buffer>       vertexInputBindings( maxVertexInputBindings, nullptr );
+		void *                        dataIt = commandStream;
+		le_pipeline_and_layout_info_t currentPipeline{};
+		bool                          pipelinePending = false; // whether the most recently bound graphics pipeline is not available yet
 
-										setData.emplace_back( descriptorData );
-									}
+		while ( commandIndex != numCommands ) {
 
-									if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
-									     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
-										assert( b.count != 0 ); // count cannot be 0
+			auto header = static_cast<le::CommandHeader *>( dataIt );
 
-										// store dynamic offset index for this element
-										b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
+			if ( /* DISABLES CODE */ ( false ) ) {
+				// Print the command stream to stdout.
+				debug_print_command( dataIt );
+			}
 
-										// increase dynamic offset count by number of elements in this binding
-										argumentState.dynamicOffsetCount += b.count;
-									}
+			if ( header->info.type == le::CommandType::eNextChunk ) {
+				// Command stream continues in next chunk - this is not a command in itself,
+				// which is why we don't increase the command index.
+				dataIt = static_cast<le::CommandNextChunk *>( dataIt )->info.next_chunk;
+				continue;
+			}
 
-									// add this binding to list of current bindings
-									argumentState.binding_infos.push_back( b );
-								}
-							}
+			switch ( header->info.type ) {
 
-							cmd.bindPipeline( vk::PipelineBindPoint::eGraphics, currentPipeline.pipeline );
-						} else {
-							// Re-using previously bound pipeline. We may keep argumentState state as it is.
-						}
+			case le::CommandType::eBindGraphicsPipeline: {
+				auto *le_cmd = static_cast<le::CommandBindGraphicsPipeline *>( dataIt );
 
-						// -- Reset dynamic offsets in argumentState:
-						// we do this regardless of whether pipeline was already bound,
-						// because binding a pipeline should always reset parameters associated
-						// with the pipeline.
+				if ( pass.type == LE_RENDER_PASS_TYPE_DRAW ) {
+					// at this point, a valid renderpass must be bound
 
-						memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
+					using namespace le_backend_vk;
+					// -- potentially compile and create pipeline here, based on current pass and subpass
+					auto requestedPipeline = le_pipeline_manager_i.produce_graphics_pipeline( pipelineManager, le_cmd->info.gpsoHandle, pass, subpassIndex );
 
-					} else {
-						// -- TODO: warn that graphics pipelines may only be bound within
-						// draw passes.
+					// Pipeline may still be being created in the background, and have no fallback
+					// pipeline: in this case, we skip any draws until the next pipeline gets bound.
+					pipelinePending = ( nullptr == requestedPipeline.pipeline );
+
+					if ( pipelinePending ) {
+						currentPipeline                  = {};
+						argumentState.setCount           = 0;
+						argumentState.dynamicOffsetCount = 0;
+						argumentState.binding_infos.clear();
+						break;
 					}
-				} break;
 
-				case le::CommandType::eBindComputePipeline: {
-					auto *le_cmd = static_cast<le::CommandBindComputePipeline *>( dataIt );
-					if ( pass.type == LE_RENDER_PASS_TYPE_COMPUTE ) {
-						// at this point, a valid renderpass must be bound
+					if ( /* DISABLES CODE */ ( false ) ) {
 
-						using namespace le_backend_vk;
-						// -- potentially compile and create pipeline here, based on current pass and subpass
-						currentPipeline = le_pipeline_manager_i.produce_compute_pipeline( pipelineManager, le_cmd->info.cpsoHandle );
+						// Print pipeline debug info when a new pipeline gets bound.
 
+						std::cout << "Requested pipeline: " << std::hex << le_cmd->info.gpsoHandle << std::endl;
+						debug_print_le_pipeline_layout_info( &requestedPipeline.layout_info );
+						std::cout << std::flush;
+					}
+
+					if ( !is_equal( currentPipeline, requestedPipeline ) ) {
+						// update current pipeline
+						currentPipeline = requestedPipeline;
 						// -- grab current pipeline layout from cache
 						currentPipelineLayout = le_pipeline_manager_i.get_pipeline_layout( pipelineManager, currentPipeline.layout_info.pipeline_layout_key );
+						// -- update pipelineData - that's the data values for all descriptors which are currently bound
 
-						{
-							// -- update pipelineData - that's the data values for all descriptors which are currently bound
+						argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
+						argumentState.binding_infos.clear();
 
-							argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
-							argumentState.binding_infos.clear();
+						// -- reset dynamic offset count
+						argumentState.dynamicOffsetCount = 0;
 
-							// -- reset dynamic offset count
-							argumentState.dynamicOffsetCount = 0;
+						// let's create descriptorData vector based on current bindings-
+						for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
 
-							// let's create descriptorData vector based on current bindings-
-							for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
+							// look up set layout info via set layout key
+							auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
 
-								// look up set layout info via set layout key
-								auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
+							auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
 
-								auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
+							auto &setData = argumentState.setData[ setId ];
 
-								auto &setData = argumentState.setData[ setId ];
+							argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
+							argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
 
-								argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
-								argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
+							setData.clear();
+							setData.reserve( setLayoutInfo->binding_info.size() );
 
-								setData.clear();
-								setData.reserve( setLayoutInfo->binding_info.size() );
+							for ( auto b : setLayoutInfo->binding_info ) {
 
-								for ( auto b : setLayoutInfo->binding_info ) {
+								// add an entry for each array element with this binding to setData
+								for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
+									DescriptorData descriptorData{};
 
-									// add an entry for each array element with this binding to setData
-									for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
-										DescriptorData descriptorData{};
+									descriptorData.type          = vk::DescriptorType( b.type );
+									descriptorData.bindingNumber = uint32_t( b.binding );
+									descriptorData.arrayIndex    = uint32_t( arrayIndex );
 
-										descriptorData.type          = vk::DescriptorType( b.type );
-										descriptorData.bindingNumber = uint32_t( b.binding );
-										descriptorData.arrayIndex    = uint32_t( arrayIndex );
-
-										descriptorData.bufferInfo.range = VK_WHOLE_SIZE;
+									if ( b.type == vk::DescriptorType::eStorageBuffer ||
+									     b.type == vk::DescriptorType::eUniformBuffer ||
+									     b.type == vk::DescriptorType::eStorageBufferDynamic ||
+									     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
 
-										setData.emplace_back( std::move( descriptorData ) );
+										descriptorData.bufferInfo.range = b.range;
 									}
 
-									if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
-									     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
-										assert( b.count != 0 ); // count cannot be 0
+									setData.emplace_back( descriptorData );
+								}
 
-										// store dynamic offset index for this element
-										b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
+								if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
+								     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
+									assert( b.count != 0 ); // count cannot be 0
 
-										// increase dynamic offset count by number of elements in this binding
-										argumentState.dynamicOffsetCount += b.count;
-									}
+									// store dynamic offset index for this element
+									b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
 
-									// add this binding to list of current bindings
-									argumentState.binding_infos.emplace_back( std::move( b ) );
+									// increase dynamic offset count by number of elements in this binding
+									argumentState.dynamicOffsetCount += b.count;
 								}
+
+								// add this binding to list of current bindings
+								argumentState.binding_infos.push_back( b );
 							}
+						}
+
+						cmd.bindPipeline( vk::PipelineBindPoint::eGraphics, currentPipeline.pipeline );
+					} else {
+						// Re-using previously bound pipeline. We may keep argumentState state as it is.
+					}
+
+					// -- Reset dynamic offsets in argumentState:
+					// we do this regardless of whether pipeline was already bound,
+					// because binding a pipeline should always reset parameters associated
+					// with the pipeline.
+
+					memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
+
+				} else {
+					// -- TODO: warn that graphics pipelines may only be bound within
+					// draw passes.
+				}
+			} break;
+
+			case le::CommandType::eBindComputePipeline: {
+				auto *le_cmd = static_cast<le::CommandBindComputePipeline *>( dataIt );
+				if ( pass.type == LE_RENDER_PASS_TYPE_COMPUTE ) {
+					// at this point, a valid renderpass must be bound
+
+					using namespace le_backend_vk;
+					// -- potentially compile and create pipeline here, based on current pass and subpass
+					currentPipeline = le_pipeline_manager_i.produce_compute_pipeline( pipelineManager, le_cmd->info.cpsoHandle );
+
+					// -- grab current pipeline layout from cache
+					currentPipelineLayout = le_pipeline_manager_i.get_pipeline_layout( pipelineManager, currentPipeline.layout_info.pipeline_layout_key );
+
+					{
+						// -- update pipelineData - that's the data values for all descriptors which are currently bound
+
+						argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
+						argumentState.binding_infos.clear();
+
+						// -- reset dynamic offset count
+						argumentState.dynamicOffsetCount = 0;
+
+						// let's create descriptorData vector based on current bindings-
+						for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
+
+							// look up set layout info via set layout key
+							auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
+
+							auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
 
-							// -- reset dynamic offsets
-							memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
+							auto &setData = argumentState.setData[ setId ];
 
-							// we write directly into descriptorsetstate when we update descriptors.
-							// when we bind a pipeline, we update the descriptorsetstate based
-							// on what the pipeline requires.
+							argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
+							argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
+
+							setData.clear();
+							setData.reserve( setLayoutInfo->binding_info.size() );
+
+							for ( auto b : setLayoutInfo->binding_info ) {
+
+								// add an entry for each array element with this binding to setData
+								for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
+									DescriptorData descriptorData{};
+
+									descriptorData.type          = vk::DescriptorType( b.type );
+									descriptorData.bindingNumber = uint32_t( b.binding );
+									descriptorData.arrayIndex    = uint32_t( arrayIndex );
+
+									descriptorData.bufferInfo.range = VK_WHOLE_SIZE;
+
+									setData.emplace_back( std::move( descriptorData ) );
+								}
+
+								if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
+								     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
+									assert( b.count != 0 ); // count cannot be 0
+
+									// store dynamic offset index for this element
+									b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
+
+									// increase dynamic offset count by number of elements in this binding
+									argumentState.dynamicOffsetCount += b.count;
+								}
+
+								// add this binding to list of current bindings
+								argumentState.binding_infos.emplace_back( std::move( b ) );
+							}
 						}
 
-						cmd.bindPipeline( vk::PipelineBindPoint::eCompute, currentPipeline.pipeline );
+						// -- reset dynamic offsets
+						memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
 
-					} else {
-						// -- TODO: warn that compute pipelines may only be bound within
-						// compute passes.
+						// we write directly into descriptorsetstate when we update descriptors.
+						// when we bind a pipeline, we update the descriptorsetstate based
+						// on what the pipeline requires.
 					}
 
-				} break;
+					cmd.bindPipeline( vk::PipelineBindPoint::eCompute, currentPipeline.pipeline );
 
-				case le::CommandType::eBindRtxPipeline: {
-					auto *le_cmd = static_cast<le::CommandBindRtxPipeline *>( dataIt );
-					if ( pass.type == LE_RENDER_PASS_TYPE_COMPUTE ) {
-						// at this point, a valid renderpass must be bound
+				} else {
+					// -- TODO: warn that compute pipelines may only be bound within
+					// compute passes.
+				}
 
-						using namespace le_backend_vk;
+			} break;
 
-						// -- fetch pipeline from pipeline cache, also fetch shader group data, so that
-						// we can verify that the current pipeline state matches the pipeline state which
-						// was used to create the pipeline. The pipeline state may change if pipeline gets recompiled.
+			case le::CommandType::eBindRtxPipeline: {
+				auto *le_cmd = static_cast<le::CommandBindRtxPipeline *>( dataIt );
+				if ( pass.type == LE_RENDER_PASS_TYPE_COMPUTE ) {
+					// at this point, a valid renderpass must be bound
 
-						{
-							currentPipeline.pipeline                        = static_cast<VkPipeline>( le_cmd->info.pipeline_native_handle );
-							currentPipeline.layout_info.pipeline_layout_key = le_cmd->info.pipeline_layout_key;
+					using namespace le_backend_vk;
 
-							memcpy( currentPipeline.layout_info.set_layout_keys, le_cmd->info.descriptor_set_layout_keys, sizeof( currentPipeline.layout_info.set_layout_keys ) );
+					// -- fetch pipeline from pipeline cache, also fetch shader group data, so that
+					// we can verify that the current pipeline state matches the pipeline state which
+					// was used to create the pipeline. The pipeline state may change if pipeline gets recompiled.
 
-							currentPipeline.layout_info.set_layout_count = le_cmd->info.descriptor_set_layout_count;
-						}
+					{
+						currentPipeline.pipeline                        = static_cast<VkPipeline>( le_cmd->info.pipeline_native_handle );
+						currentPipeline.layout_info.pipeline_layout_key = le_cmd->info.pipeline_layout_key;
 
-						// -- grab current pipeline layout from cache
-						currentPipelineLayout = le_pipeline_manager_i.get_pipeline_layout( pipelineManager, currentPipeline.layout_info.pipeline_layout_key );
+						memcpy( currentPipeline.layout_info.set_layout_keys, le_cmd->info.descriptor_set_layout_keys, sizeof( currentPipeline.layout_info.set_layout_keys ) );
 
-						{
-							// -- update pipelineData - that's the data values for all descriptors which are currently bound
+						currentPipeline.layout_info.set_layout_count = le_cmd->info.descriptor_set_layout_count;
+					}
 
-							argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
-							argumentState.binding_infos.clear();
+					// -- grab current pipeline layout from cache
+					currentPipelineLayout = le_pipeline_manager_i.get_pipeline_layout( pipelineManager, currentPipeline.layout_info.pipeline_layout_key );
 
-							// -- reset dynamic offset count
-							argumentState.dynamicOffsetCount = 0;
+					{
+						// -- update pipelineData - that's the data values for all descriptors which are currently bound
+
+						argumentState.setCount = uint32_t( currentPipeline.layout_info.set_layout_count );
+						argumentState.binding_infos.clear();
 
-							// let's create descriptorData vector based on current bindings-
-							for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
+						// -- reset dynamic offset count
+						argumentState.dynamicOffsetCount = 0;
 
-								// look up set layout info via set layout key
-								auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
+						// let's create descriptorData vector based on current bindings-
+						for ( size_t setId = 0; setId != argumentState.setCount; ++setId ) {
 
-								auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
+							// look up set layout info via set layout key
+							auto const &set_layout_key = currentPipeline.layout_info.set_layout_keys[ setId ];
 
-								auto &setData = argumentState.setData[ setId ];
+							auto const setLayoutInfo = le_pipeline_manager_i.get_descriptor_set_layout( pipelineManager, set_layout_key );
 
-								argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
-								argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
+							auto &setData = argumentState.setData[ setId ];
 
-								setData.clear();
-								setData.reserve( setLayoutInfo->binding_info.size() );
+							argumentState.layouts[ setId ]         = setLayoutInfo->vk_descriptor_set_layout;
+							argumentState.updateTemplates[ setId ] = setLayoutInfo->vk_descriptor_update_template;
 
-								for ( auto b : setLayoutInfo->binding_info ) {
+							setData.clear();
+							setData.reserve( setLayoutInfo->binding_info.size() );
 
-									// add an entry for each array element with this binding to setData
-									for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
-										DescriptorData descriptorData{};
+							for ( auto b : setLayoutInfo->binding_info ) {
 
-										descriptorData.type          = vk::DescriptorType( b.type );
-										descriptorData.bindingNumber = uint32_t( b.binding );
-										descriptorData.arrayIndex    = uint32_t( arrayIndex );
+								// add an entry for each array element with this binding to setData
+								for ( size_t arrayIndex = 0; arrayIndex != b.count; arrayIndex++ ) {
+									DescriptorData descriptorData{};
 
-										if ( b.type == vk::DescriptorType::eStorageBuffer ||
-										     b.type == vk::DescriptorType::eUniformBuffer ||
-										     b.type == vk::DescriptorType::eStorageBufferDynamic ||
-										     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
+									descriptorData.type          = vk::DescriptorType( b.type );
+									descriptorData.bindingNumber = uint32_t( b.binding );
+									descriptorData.arrayIndex    = uint32_t( arrayIndex );
 
-											descriptorData.bufferInfo.range = b.range;
-										}
+									if ( b.type == vk::DescriptorType::eStorageBuffer ||
+									     b.type == vk::DescriptorType::eUniformBuffer ||
+									     b.type == vk::DescriptorType::eStorageBufferDynamic ||
+									     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
 
-										setData.emplace_back( std::move( descriptorData ) );
+										descriptorData.bufferInfo.range = b.range;
 									}
 
-									if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
-									     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
-										assert( b.count != 0 ); // count cannot be 0
+									setData.emplace_back( std::move( descriptorData ) );
+								}
 
-										// store dynamic offset index for this element
-										b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
+								if ( b.type == vk::DescriptorType::eStorageBufferDynamic ||
+								     b.type == vk::DescriptorType::eUniformBufferDynamic ) {
+									assert( b.count != 0 ); // count cannot be 0
 
-										// increase dynamic offset count by number of elements in this binding
-										argumentState.dynamicOffsetCount += b.count;
-									}
+									// store dynamic offset index for this element
+									b.dynamic_offset_idx = argumentState.dynamicOffsetCount;
 
-									// add this binding to list of current bindings
-									argumentState.binding_infos.emplace_back( std::move( b ) );
+									// increase dynamic offset count by number of elements in this binding
+									argumentState.dynamicOffsetCount += b.count;
 								}
-							}
 
-							// -- reset dynamic offsets
-							memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
+								// add this binding to list of current bindings
+								argumentState.binding_infos.emplace_back( std::move( b ) );
+							}
 						}
 
-						cmd.bindPipeline( vk::PipelineBindPoint::eRayTracingKHR, currentPipeline.pipeline );
+						// -- reset dynamic offsets
+						memset( argumentState.dynamicOffsets.data(), 0, sizeof( uint32_t ) * argumentState.dynamicOffsetCount );
+					}
 
-						// -- "bind" shader binding table state
+					cmd.bindPipeline( vk::PipelineBindPoint::eRayTracingKHR, currentPipeline.pipeline );
 
-						rtx_state.sbt_buffer          = le_cmd->info.sbt_buffer;
-						rtx_state.ray_gen_sbt_offset  = le_cmd->info.ray_gen_sbt_offset;
-						rtx_state.ray_gen_sbt_size    = le_cmd->info.ray_gen_sbt_size;
-						rtx_state.miss_sbt_offset     = le_cmd->info.miss_sbt_offset;
-						rtx_state.miss_sbt_stride     = le_cmd->info.miss_sbt_stride;
-						rtx_state.miss_sbt_size       = le_cmd->info.miss_sbt_size;
-						rtx_state.hit_sbt_offset      = le_cmd->info.hit_sbt_offset;
-						rtx_state.hit_sbt_stride      = le_cmd->info.hit_sbt_stride;
-						rtx_state.hit_sbt_size        = le_cmd->info.hit_sbt_size;
-						rtx_state.callable_sbt_offset = le_cmd->info.callable_sbt_offset;
-						rtx_state.callable_sbt_stride = le_cmd->info.callable_sbt_stride;
-						rtx_state.callable_sbt_size   = le_cmd->info.callable_sbt_size;
-						rtx_state.is_set              = true;
+					// -- "bind" shader binding table state
 
-					} else {
-						// -- TODO: warn that rtx pipelines may only be bound within
-						// compute passes.
-					}
+					rtx_state.sbt_buffer          = le_cmd->info.sbt_buffer;
+					rtx_state.ray_gen_sbt_offset  = le_cmd->info.ray_gen_sbt_offset;
+					rtx_state.ray_gen_sbt_size    = le_cmd->info.ray_gen_sbt_size;
+					rtx_state.miss_sbt_offset     = le_cmd->info.miss_sbt_offset;
+					rtx_state.miss_sbt_stride     = le_cmd->info.miss_sbt_stride;
+					rtx_state.miss_sbt_size       = le_cmd->info.miss_sbt_size;
+					rtx_state.hit_sbt_offset      = le_cmd->info.hit_sbt_offset;
+					rtx_state.hit_sbt_stride      = le_cmd->info.hit_sbt_stride;
+					rtx_state.hit_sbt_size        = le_cmd->info.hit_sbt_size;
+					rtx_state.callable_sbt_offset = le_cmd->info.callable_sbt_offset;
+					rtx_state.callable_sbt_stride = le_cmd->info.callable_sbt_stride;
+					rtx_state.callable_sbt_size   = le_cmd->info.callable_sbt_size;
+					rtx_state.is_set              = true;
 
-				} break;
+				} else {
+					// -- TODO: warn that rtx pipelines may only be bound within
+					// compute passes.
+				}
+
+			} break;
 #ifdef LE_FEATURE_RTX
-				case le::CommandType::eTraceRays: {
-					auto *le_cmd = static_cast<le::CommandTraceRays *>( dataIt );
+			case le::CommandType::eTraceRays: {
+				auto *le_cmd = static_cast<le::CommandTraceRays *>( dataIt );
 
-					// -- update descriptorsets via template if tainted
-					bool argumentsOk = updateArguments( device, descriptorPool, argumentState, previousSetState, descriptorSets );
+				// -- update descriptorsets via template if tainted
+				bool argumentsOk = updateArguments( device, descriptorPool, descriptorSetCache, argumentState, previousSetState, descriptorSets );
 
-					if ( false == argumentsOk ) {
-						break;
-					}
+				if ( false == argumentsOk ) {
+					break;
+				}
 
-					// --------| invariant: arguments were updated successfully
+				// --------| invariant: arguments were updated successfully
 
-					if ( argumentState.setCount > 0 ) {
+				if ( argumentState.setCount > 0 ) {
 
-						cmd.bindDescriptorSets( vk::PipelineBindPoint::eRayTracingKHR,
-						                        currentPipelineLayout,
-						                        0,
-						                        argumentState.setCount,
-						                        descriptorSets,
-						                        argumentState.dynamicOffsetCount,
-						                        argumentState.dynamicOffsets.data() );
-					}
+					cmd.bindDescriptorSets( vk::PipelineBindPoint::eRayTracingKHR,
+					                        currentPipelineLayout,
+					                        0,
+					                        argumentState.setCount,
+					                        descriptorSets,
+					                        argumentState.dynamicOffsetCount,
+					                        argumentState.dynamicOffsets.data() );
+				}
 
-					assert( rtx_state.is_set && "sbt state must have been set before calling traceRays" );
-
-					vk::Buffer sbt_vk_buffer = frame_data_get_buffer_from_le_resource_id( frame, rtx_state.sbt_buffer );
-
-					//					std::cout << "sbt buffer: " << std::hex << sbt_vk_buffer << std::endl
-					//					          << std::flush;
-					//					std::cout << "sbt buffer raygen offset: " << std::dec << rtx_state.ray_gen_sbt_offset << std::endl
-					//					          << std::flush;
-
-					// buffer, offset, stride, size
-					vk::StridedBufferRegionKHR sbt_ray_gen{ sbt_vk_buffer, rtx_state.ray_gen_sbt_offset, 0, rtx_state.ray_gen_sbt_size };
-					vk::StridedBufferRegionKHR sbt_miss{ sbt_vk_buffer, rtx_state.miss_sbt_offset, rtx_state.miss_sbt_stride, rtx_state.miss_sbt_size };
-					vk::StridedBufferRegionKHR sbt_hit{ sbt_vk_buffer, rtx_state.hit_sbt_offset, rtx_state.hit_sbt_stride, rtx_state.hit_sbt_size };
-					vk::StridedBufferRegionKHR sbt_callable{ sbt_vk_buffer, rtx_state.callable_sbt_offset, rtx_state.callable_sbt_stride, rtx_state.callable_sbt_size };
-
-					cmd.traceRaysKHR(
-					    sbt_ray_gen,
-					    sbt_miss,
-					    sbt_hit,
-					    sbt_callable,
-					    le_cmd->info.width,
-					    le_cmd->info.height,
-					    le_cmd->info.depth //
-					);
+				assert( rtx_state.is_set && "sbt state must have been set before calling traceRays" );
+
+				vk::Buffer sbt_vk_buffer = frame_data_get_buffer_from_le_resource_id( frame, rtx_state.sbt_buffer );
 
-				} break;
+				//					std::cout << "sbt buffer: " << std::hex << sbt_vk_buffer << std::endl
+				//					          << std::flush;
+				//					std::cout << "sbt buffer raygen offset: " << std::dec << rtx_state.ray_gen_sbt_offset << std::endl
+				//					          << std::flush;
+
+				// buffer, offset, stride, size
+				vk::StridedBufferRegionKHR sbt_ray_gen{ sbt_vk_buffer, rtx_state.ray_gen_sbt_offset, 0, rtx_state.ray_gen_sbt_size };
+				vk::StridedBufferRegionKHR sbt_miss{ sbt_vk_buffer, rtx_state.miss_sbt_offset, rtx_state.miss_sbt_stride, rtx_state.miss_sbt_size };
+				vk::StridedBufferRegionKHR sbt_hit{ sbt_vk_buffer, rtx_state.hit_sbt_offset, rtx_state.hit_sbt_stride, rtx_state.hit_sbt_size };
+				vk::StridedBufferRegionKHR sbt_callable{ sbt_vk_buffer, rtx_state.callable_sbt_offset, rtx_state.callable_sbt_stride, rtx_state.callable_sbt_size };
+
+				cmd.traceRaysKHR(
+				    sbt_ray_gen,
+				    sbt_miss,
+				    sbt_hit,
+				    sbt_callable,
+				    le_cmd->info.width,
+				    le_cmd->info.height,
+				    le_cmd->info.depth //
+				);
+
+			} break;
 #endif
-				case le::CommandType::eDispatch: {
-					auto *le_cmd = static_cast<le::CommandDispatch *>( dataIt );
+			case le::CommandType::eDispatch: {
+				auto *le_cmd = static_cast<le::CommandDispatch *>( dataIt );
 
-					// -- update descriptorsets via template if tainted
-					bool argumentsOk = updateArguments( device, descriptorPool, argumentState, previousSetState, descriptorSets );
+				// -- update descriptorsets via template if tainted
+				bool argumentsOk = updateArguments( device, descriptorPool, descriptorSetCache, argumentState, previousSetState, descriptorSets );
 
-					if ( false == argumentsOk ) {
-						break;
-					}
+				if ( false == argumentsOk ) {
+					break;
+				}
 
-					// --------| invariant: arguments were updated successfully
+				// --------| invariant: arguments were updated successfully
 
-					if ( argumentState.setCount > 0 ) {
+				if ( argumentState.setCount > 0 ) {
 
-						cmd.bindDescriptorSets( vk::PipelineBindPoint::eCompute,
-						                        currentPipelineLayout,
-						                        0,
-						                        argumentState.setCount,
-						                        descriptorSets,
-						                        argumentState.dynamicOffsetCount,
-						                        argumentState.dynamicOffsets.data() );
-					}
+					cmd.bindDescriptorSets( vk::PipelineBindPoint::eCompute,
+					                        currentPipelineLayout,
+					                        0,
+					                        argumentState.setCount,
+					                        descriptorSets,
+					                        argumentState.dynamicOffsetCount,
+					                        argumentState.dynamicOffsets.data() );
+				}
 
-					cmd.dispatch( le_cmd->info.groupCountX, le_cmd->info.groupCountY, le_cmd->info.groupCountZ );
-				} break;
+				cmd.dispatch( le_cmd->info.groupCountX, le_cmd->info.groupCountY, le_cmd->info.groupCountZ );
+			} break;
 
-				case le::CommandType::eDraw: {
-					auto *le_cmd = static_cast<le::CommandDraw *>( dataIt );
+			case le::CommandType::eDraw: {
+				auto *le_cmd = static_cast<le::CommandDraw *>( dataIt );
 
-					// -- update descriptorsets via template if tainted
-					bool argumentsOk = updateArguments( device, descriptorPool, argumentState, previousSetState, descriptorSets );
+				if ( pipelinePending ) {
+					break; // pipeline is still being created - we must skip this draw.
+				}
 
-					if ( false == argumentsOk ) {
-						break;
-					}
+				// -- update descriptorsets via template if tainted
+				bool argumentsOk = updateArguments( device, descriptorPool, descriptorSetCache, argumentState, previousSetState, descriptorSets );
 
-					// --------| invariant: arguments were updated successfully
+				if ( false == argumentsOk ) {
+					break;
+				}
 
-					if ( argumentState.setCount > 0 ) {
+				// --------| invariant: arguments were updated successfully
 
-						cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
-						                        currentPipelineLayout,
-						                        0,
-						                        argumentState.setCount,
-						                        descriptorSets,
-						                        argumentState.dynamicOffsetCount,
-						                        argumentState.dynamicOffsets.data() );
-					}
+				if ( argumentState.setCount > 0 ) {
 
-					cmd.draw( le_cmd->info.vertexCount, le_cmd->info.instanceCount, le_cmd->info.firstVertex, le_cmd->info.firstInstance );
-				} break;
+					cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
+					                        currentPipelineLayout,
+					                        0,
+					                        argumentState.setCount,
+					                        descriptorSets,
+					                        argumentState.dynamicOffsetCount,
+					                        argumentState.dynamicOffsets.data() );
+				}
 
-				case le::CommandType::eDrawIndexed: {
-					auto *le_cmd = static_cast<le::CommandDrawIndexed *>( dataIt );
+				cmd.draw( le_cmd->info.vertexCount, le_cmd->info.instanceCount, le_cmd->info.firstVertex, le_cmd->info.firstInstance );
+			} break;
 
-					// -- update descriptorsets via template if tainted
-					bool argumentsOk = updateArguments( device, descriptorPool, argumentState, previousSetState, descriptorSets );
+			case le::CommandType::eDrawIndexed: {
+				auto *le_cmd = static_cast<le::CommandDrawIndexed *>( dataIt );
 
-					if ( false == argumentsOk ) {
-						break;
-					}
+				if ( pipelinePending ) {
+					break; // pipeline is still being created - we must skip this draw.
+				}
 
-					// --------| invariant: arguments were updated successfully
+				// -- update descriptorsets via template if tainted
+				bool argumentsOk = updateArguments( device, descriptorPool, descriptorSetCache, argumentState, previousSetState, descriptorSets );
 
-					if ( argumentState.setCount > 0 ) {
+				if ( false == argumentsOk ) {
+					break;
+				}
 
-						cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
-						                        currentPipelineLayout,
-						                        0,
-						                        argumentState.setCount,
-						                        descriptorSets,
-						                        argumentState.dynamicOffsetCount,
-						                        argumentState.dynamicOffsets.data() );
-					}
+				// --------| invariant: arguments were updated successfully
 
-					cmd.drawIndexed( le_cmd->info.indexCount, le_cmd->info.instanceCount, le_cmd->info.firstIndex, le_cmd->info.vertexOffset, le_cmd->info.firstInstance );
-				} break;
+				if ( argumentState.setCount > 0 ) {
 
-				case le::CommandType::eDrawMeshTasks: {
-					auto *le_cmd = static_cast<le::CommandDrawMeshTasks *>( dataIt );
+					cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
+					                        currentPipelineLayout,
+					                        0,
+					                        argumentState.setCount,
+					                        descriptorSets,
+					                        argumentState.dynamicOffsetCount,
+					                        argumentState.dynamicOffsets.data() );
+				}
 
-					// -- update descriptorsets via template if tainted
-					bool argumentsOk = updateArguments( device, descriptorPool, argumentState, previousSetState, descriptorSets );
+				cmd.drawIndexed( le_cmd->info.indexCount, le_cmd->info.instanceCount, le_cmd->info.firstIndex, le_cmd->info.vertexOffset, le_cmd->info.firstInstance );
+			} break;
 
-					if ( false == argumentsOk ) {
-						break;
-					}
+			case le::CommandType::eDrawMeshTasks: {
+				auto *le_cmd = static_cast<le::CommandDrawMeshTasks *>( dataIt );
+
+				if ( pipelinePending ) {
+					break; // pipeline is still being created - we must skip this draw.
+				}
+
+				// -- update descriptorsets via template if tainted
+				bool argumentsOk = updateArguments( device, descriptorPool, descriptorSetCache, argumentState, previousSetState, descriptorSets );
+
+				if ( false == argumentsOk ) {
+					break;
+				}
 #ifdef LE_FEATURE_MESH_SHADER_NV
 
-					// --------| invariant: arguments were updated successfully
+				// --------| invariant: arguments were updated successfully
 
-					if ( argumentState.setCount > 0 ) {
+				if ( argumentState.setCount > 0 ) {
 
-						cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
-						                        currentPipelineLayout,
-						                        0,
-						                        argumentState.setCount,
-						                        descriptorSets,
-						                        argumentState.dynamicOffsetCount,
-						                        argumentState.dynamicOffsets.data() );
-					}
+					cmd.bindDescriptorSets( vk::PipelineBindPoint::eGraphics,
+					                        currentPipelineLayout,
+					                        0,
+					                        argumentState.setCount,
+					                        descriptorSets,
+					                        argumentState.dynamicOffsetCount,
+					                        argumentState.dynamicOffsets.data() );
+				}
 
-					cmd.drawMeshTasksNV( le_cmd->info.taskCount, le_cmd->info.firstTask );
+				cmd.drawMeshTasksNV( le_cmd->info.taskCount, le_cmd->info.firstTask );
 #else
-					break;
+				break;
 #endif
-				} break;
-
-				case le::CommandType::eSetLineWidth: {
-					auto *le_cmd = static_cast<le::CommandSetLineWidth *>( dataIt );
-					cmd.setLineWidth( le_cmd->info.width );
-				} break;
-
-				case le::CommandType::eSetViewport: {
-					auto *le_cmd = static_cast<le::CommandSetViewport *>( dataIt );
-					// Since data for viewports *is stored inline*, we increment the typed pointer
-					// of le_cmd by 1 to reach the next slot in the stream, where the data is stored.
-					cmd.setViewport( le_cmd->info.firstViewport, le_cmd->info.viewportCount, reinterpret_cast<vk::Viewport *>( le_cmd + 1 ) );
-				} break;
-
-				case le::CommandType::eSetScissor: {
-					auto *le_cmd = static_cast<le::CommandSetScissor *>( dataIt );
-					// Since data for scissors *is stored inline*, we increment the typed pointer
-					// of le_cmd by 1 to reach the next slot in the stream, where the data is stored.
-					cmd.setScissor( le_cmd->info.firstScissor, le_cmd->info.scissorCount, reinterpret_cast<vk::Rect2D *>( le_cmd + 1 ) );
-				} break;
-
-				case le::CommandType::eBindArgumentBuffer: {
-					// we need to store the data for the dynamic binding which was set as an argument to the ubo
-					// this alters our internal state
-					auto *le_cmd = static_cast<le::CommandBindArgumentBuffer *>( dataIt );
-
-					uint64_t argument_name_id = le_cmd->info.argument_name_id;
-
-					// find binding info with name referenced in command
-
-					auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(),
-					                       [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
-						                       return e.name_hash == argument_name_id;
-					                       } );
-
-					if ( b == argumentState.binding_infos.end() ) {
-						static uint64_t wrong_argument = argument_name_id;
-						[]( uint64_t argument ) {
-							static uint64_t argument_id_local = 0;
-							if ( argument_id_local == wrong_argument )
-								return;
-							std::cout << "backend_process_frame:"
-							          << char( 0x1B ) << "[38;5;209m"
-							          << " Warning: Invalid argument name: '" << le_get_argument_name_from_hash( argument ) << "'"
-							          << char( 0x1B ) << "[0m"
-							          << " id: 0x" << std::hex << argument << std::endl
-							          << std::flush;
-							argument_id_local = argument;
-						}( argument_name_id );
+			} break;
+
+			case le::CommandType::eSetLineWidth: {
+				auto *le_cmd = static_cast<le::CommandSetLineWidth *>( dataIt );
+				cmd.setLineWidth( le_cmd->info.width );
+			} break;
+
+			case le::CommandType::eSetViewport: {
+				auto *le_cmd = static_cast<le::CommandSetViewport *>( dataIt );
+				// Since data for viewports *is stored inline*, we increment the typed pointer
+				// of le_cmd by 1 to reach the next slot in the stream, where the data is stored.
+				cmd.setViewport( le_cmd->info.firstViewport, le_cmd->info.viewportCount, reinterpret_cast<vk::Viewport *>( le_cmd + 1 ) );
+			} break;
+
+			case le::CommandType::eSetScissor: {
+				auto *le_cmd = static_cast<le::CommandSetScissor *>( dataIt );
+				// Since data for scissors *is stored inline*, we increment the typed pointer
+				// of le_cmd by 1 to reach the next slot in the stream, where the data is stored.
+				cmd.setScissor( le_cmd->info.firstScissor, le_cmd->info.scissorCount, reinterpret_cast<vk::Rect2D *>( le_cmd + 1 ) );
+			} break;
+
+			case le::CommandType::eBindArgumentBuffer: {
+				// we need to store the data for the dynamic binding which was set as an argument to the ubo
+				// this alters our internal state
+				auto *le_cmd = static_cast<le::CommandBindArgumentBuffer *>( dataIt );
+
+				uint64_t argument_name_id = le_cmd->info.argument_name_id;
+
+				if ( pipelinePending ) {
+					break; // there are no bindings to set while pipeline is still being created.
+				}
+
+				// find binding info with name referenced in command
+
+				auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(),
+				                       [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
+					                       return e.name_hash == argument_name_id;
+				                       } );
+
+				if ( b == argumentState.binding_infos.end() ) {
+					static uint64_t wrong_argument = argument_name_id;
+					[]( uint64_t argument ) {
+						static uint64_t argument_id_local = 0;
+						if ( argument_id_local == wrong_argument )
+							return;
+						std::cout << "backend_process_frame:"
+						          << char( 0x1B ) << "[38;5;209m"
+						          << " Warning: Invalid argument name: '" << le_get_argument_name_from_hash( argument ) << "'"
+						          << char( 0x1B ) << "[0m"
+						          << " id: 0x" << std::hex << argument << std::endl
+						          << std::flush;
+						argument_id_local = argument;
+					}( argument_name_id );
+					break;
+				}
+
+				// ---------| invariant: we found an argument name that matches
+				auto setIndex = b->setIndex;
+				auto binding  = b->binding;
+
+				auto &bindingData = argumentState.setData[ setIndex ][ binding ].bufferInfo;
+
+				bindingData.buffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.buffer_id );
+				bindingData.range  = std::min<uint64_t>( le_cmd->info.range, b->range ); // CHECK: use range from binding to limit range...
+
+				if ( bindingData.range == 0 ) {
+
+					// If no range was specified, we must default to VK_WHOLE_SIZE,
+					// as a range setting of 0 is not allowed in Vulkan.
+
+					bindingData.range = VK_WHOLE_SIZE;
+				}
+
+				// If binding is in fact a dynamic binding, set the corresponding dynamic offset
+				// and set the buffer offset to 0.
+				if ( b->type == vk::DescriptorType::eStorageBufferDynamic ||
+				     b->type == vk::DescriptorType::eUniformBufferDynamic ) {
+					auto dynamicOffset                            = b->dynamic_offset_idx;
+					bindingData.offset                            = 0;
+					argumentState.dynamicOffsets[ dynamicOffset ] = uint32_t( le_cmd->info.offset );
+				} else {
+					bindingData.offset = le_cmd->info.offset;
+				}
+
+			} break;
+
+			case le::CommandType::eSetArgumentTexture: {
+				auto *   le_cmd           = static_cast<le::CommandSetArgumentTexture *>( dataIt );
+				uint64_t argument_name_id = le_cmd->info.argument_name_id;
+
+				if ( pipelinePending ) {
+					break; // there are no bindings to set while pipeline is still being created.
+				}
+
+				// Find binding info with name referenced in command
+				auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
+					return e.name_hash == argument_name_id;
+				} );
+
+				if ( b == argumentState.binding_infos.end() ) {
+					std::cout << "Warning: Invalid texture argument name id: 0x" << std::hex << argument_name_id << std::endl
+					          << std::flush;
+					break;
+				}
+
+				// ---------| invariant: we found an argument name that matches
+
+				auto setIndex      = b->setIndex;
+				auto bindingNumber = b->binding;
+				auto arrayIndex    = uint32_t( le_cmd->info.array_index );
+
+				auto       bindingData      = argumentState.setData[ setIndex ].data();
+				auto const binding_data_end = bindingData + argumentState.setData[ setIndex ].size();
+
+				// Descriptors are stored as flat arrays; we cannot assume that binding number matches
+				// index of descriptor in set, because some types of uniforms may be arrays, and these
+				// arrays will be stored flat in the vector of per-set descriptors.
+				//
+				// Imagine these were bindings for a set: a b c0 c1 c2 c3 c4 d
+				// a(0), b(1), would have their own binding number, but c0(2), c1(2), c2(2), c3(2), c4(2)
+				// would share a single binding number, 2, until d(3), which would have binding number 3.
+				//
+				// To find the correct descriptor, we must therefore iterate over descriptors in-set
+				// until we find one that matches the correct array index.
+				//
+				for ( ; bindingData != binding_data_end; bindingData++ ) {
+					if ( bindingData->bindingNumber == bindingNumber &&
+					     bindingData->arrayIndex == arrayIndex ) {
 						break;
 					}
+				}
 
-					// ---------| invariant: we found an argument name that matches
-					auto setIndex = b->setIndex;
-					auto binding  = b->binding;
-
-					auto &bindingData = argumentState.setData[ setIndex ][ binding ].bufferInfo;
-
-					bindingData.buffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.buffer_id );
-					bindingData.range  = std::min<uint64_t>( le_cmd->info.range, b->range ); // CHECK: use range from binding to limit range...
+				assert( bindingData != binding_data_end && "could not find specified binding." );
 
-					if ( bindingData.range == 0 ) {
+				// fetch texture information based on texture id from command
 
-						// If no range was specified, we must default to VK_WHOLE_SIZE,
-						// as a range setting of 0 is not allowed in Vulkan.
+				auto foundTex = frame.textures_per_pass[ passIndex ].find( le_cmd->info.texture_id );
+				if ( foundTex == frame.textures_per_pass[ passIndex ].end() ) {
+					using namespace le_renderer;
+					std::cerr << "Could not find requested texture: "
+					          << renderer_i.texture_handle_get_name( le_cmd->info.texture_id )
+					          << " Ignoring texture binding command." << std::endl
+					          << std::flush;
+					break;
+				}
 
-						bindingData.range = VK_WHOLE_SIZE;
-					}
+				// ----------| invariant: texture has been found
 
-					// If binding is in fact a dynamic binding, set the corresponding dynamic offset
-					// and set the buffer offset to 0.
-					if ( b->type == vk::DescriptorType::eStorageBufferDynamic ||
-					     b->type == vk::DescriptorType::eUniformBufferDynamic ) {
-						auto dynamicOffset                            = b->dynamic_offset_idx;
-						bindingData.offset                            = 0;
-						argumentState.dynamicOffsets[ dynamicOffset ] = uint32_t( le_cmd->info.offset );
-					} else {
-						bindingData.offset = le_cmd->info.offset;
-					}
+				bindingData->imageInfo.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+				bindingData->imageInfo.sampler     = foundTex->second.sampler;
+				bindingData->imageInfo.imageView   = foundTex->second.imageView;
+				bindingData->type                  = vk::DescriptorType::eCombinedImageSampler;
 
-				} break;
+			} break;
 
-				case le::CommandType::eSetArgumentTexture: {
-					auto *   le_cmd           = static_cast<le::CommandSetArgumentTexture *>( dataIt );
-					uint64_t argument_name_id = le_cmd->info.argument_name_id;
+			case le::CommandType::eSetArgumentImage: {
+				auto *   le_cmd           = static_cast<le::CommandSetArgumentImage *>( dataIt );
+				uint64_t argument_name_id = le_cmd->info.argument_name_id;
 
-					// Find binding info with name referenced in command
-					auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
-						return e.name_hash == argument_name_id;
-					} );
+				if ( pipelinePending ) {
+					break; // there are no bindings to set while pipeline is still being created.
+				}
 
-					if ( b == argumentState.binding_infos.end() ) {
-						std::cout << "Warning: Invalid texture argument name id: 0x" << std::hex << argument_name_id << std::endl
-						          << std::flush;
-						break;
-					}
+				// Find binding info with name referenced in command
+				auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
+					return e.name_hash == argument_name_id;
+				} );
 
-					// ---------| invariant: we found an argument name that matches
+				if ( b == argumentState.binding_infos.end() ) {
+					std::cout << "Warning: Invalid image argument name id: 0x" << std::hex << argument_name_id << std::endl
+					          << std::flush;
+					break;
+				}
 
-					auto setIndex      = b->setIndex;
-					auto bindingNumber = b->binding;
-					auto arrayIndex    = uint32_t( le_cmd->info.array_index );
+				// ---------| invariant: we found an argument name that matches
+				auto setIndex = b->setIndex;
+				auto binding  = b->binding;
 
-					auto       bindingData      = argumentState.setData[ setIndex ].data();
-					auto const binding_data_end = bindingData + argumentState.setData[ setIndex ].size();
+				auto &bindingData = argumentState.setData[ setIndex ][ binding ];
 
-					// Descriptors are stored as flat arrays; we cannot assume that binding number matches
-					// index of descriptor in set, because some types of uniforms may be arrays, and these
-					// arrays will be stored flat in the vector of per-set descriptors.
-					//
-					// Imagine these were bindings for a set: a b c0 c1 c2 c3 c4 d
-					// a(0), b(1), would have their own binding number, but c0(2), c1(2), c2(2), c3(2), c4(2)
-					// would share a single binding number, 2, until d(3), which would have binding number 3.
-					//
-					// To find the correct descriptor, we must therefore iterate over descriptors in-set
-					// until we find one that matches the correct array index.
-					//
-					for ( ; bindingData != binding_data_end; bindingData++ ) {
-						if ( bindingData->bindingNumber == bindingNumber &&
-						     bindingData->arrayIndex == arrayIndex ) {
-							break;
-						}
-					}
+				// fetch texture information based on texture id from command
 
-					assert( bindingData != binding_data_end && "could not find specified binding." );
+				auto foundImgView = frame.imageViews.find( le_cmd->info.image_id );
+				if ( foundImgView == frame.imageViews.end() ) {
+					std::cerr << "Could not find image view for image: " << le_cmd->info.image_id.getDebugName() << " Ignoring image binding command." << std::endl
+					          << std::flush;
+					break;
+				}
 
-					// fetch texture information based on texture id from command
+				// ----------| invariant: image view has been found
 
-					auto foundTex = frame.textures_per_pass[ passIndex ].find( le_cmd->info.texture_id );
-					if ( foundTex == frame.textures_per_pass[ passIndex ].end() ) {
-						using namespace le_renderer;
-						std::cerr << "Could not find requested texture: "
-						          << renderer_i.texture_handle_get_name( le_cmd->info.texture_id )
-						          << " Ignoring texture binding command." << std::endl
-						          << std::flush;
-						break;
-					}
+				// FIXME: (sync) image layout at this point *must* be general, if we wanted to write to this image.
+				bindingData.imageInfo.imageLayout = vk::ImageLayout::eGeneral;
+				bindingData.imageInfo.imageView   = foundImgView->second;
 
-					// ----------| invariant: texture has been found
+				bindingData.type       = vk::DescriptorType::eStorageImage;
+				bindingData.arrayIndex = uint32_t( le_cmd->info.array_index );
 
-					bindingData->imageInfo.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
-					bindingData->imageInfo.sampler     = foundTex->second.sampler;
-					bindingData->imageInfo.imageView   = foundTex->second.imageView;
-					bindingData->type                  = vk::DescriptorType::eCombinedImageSampler;
+			} break;
+#ifdef LE_FEATURE_RTX
+			case le::CommandType::eSetArgumentTlas: {
+				auto *   le_cmd           = static_cast<le::CommandSetArgumentTlas *>( dataIt );
+				uint64_t argument_name_id = le_cmd->info.argument_name_id;
 
-				} break;
+				if ( pipelinePending ) {
+					break; // there are no bindings to set while pipeline is still being created.
+				}
 
-				case le::CommandType::eSetArgumentImage: {
-					auto *   le_cmd           = static_cast<le::CommandSetArgumentImage *>( dataIt );
-					uint64_t argument_name_id = le_cmd->info.argument_name_id;
+				// Find binding info with name referenced in command
+				auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
+					return e.name_hash == argument_name_id;
+				} );
 
-					// Find binding info with name referenced in command
-					auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
-						return e.name_hash == argument_name_id;
-					} );
+				if ( b == argumentState.binding_infos.end() ) {
+					std::cout << "Warning: Invalid tlas argument name id: 0x" << std::hex << argument_name_id << std::endl
+					          << std::flush;
+					break;
+				}
 
-					if ( b == argumentState.binding_infos.end() ) {
-						std::cout << "Warning: Invalid image argument name id: 0x" << std::hex << argument_name_id << std::endl
-						          << std::flush;
-						break;
-					}
+				// ---------| invariant: we found an argument name that matches
+				auto setIndex = b->setIndex;
+				auto binding  = b->binding;
 
-					// ---------| invariant: we found an argument name that matches
-					auto setIndex = b->setIndex;
-					auto binding  = b->binding;
+				auto &bindingData = argumentState.setData[ setIndex ][ binding ];
 
-					auto &bindingData = argumentState.setData[ setIndex ][ binding ];
+				// fetch texture information based on texture id from command
 
-					// fetch texture information based on texture id from command
+				assert( le_cmd->info.tlas_id.getResourceType() == LeResourceType::eRtxTlas );
 
-					auto foundImgView = frame.imageViews.find( le_cmd->info.image_id );
-					if ( foundImgView == frame.imageViews.end() ) {
-						std::cerr << "Could not find image view for image: " << le_cmd->info.image_id.debug_name << " Ignoring image binding command." << std::endl
-						          << std::flush;
-						break;
-					}
+				auto found_resource = frame.availableResources.find( le_cmd->info.tlas_id );
+				if ( found_resource == frame.availableResources.end() ) {
+					std::cerr << "Could not find acceleration structure: " << le_cmd->info.tlas_id.getDebugName()
+					          << " Ignoring top level acceleration structure binding command." << std::endl
+					          << std::flush;
+					break;
+				}
 
-					// ----------| invariant: image view has been found
+				// ----------| invariant: image view has been found
 
-					// FIXME: (sync) image layout at this point *must* be general, if we wanted to write to this image.
-					bindingData.imageInfo.imageLayout = vk::ImageLayout::eGeneral;
-					bindingData.imageInfo.imageView   = foundImgView->second;
+				bindingData.accelerationStructureInfo.accelerationStructure = found_resource->second.as.tlas;
+				bindingData.type                                            = vk::DescriptorType::eAccelerationStructureKHR;
+				bindingData.arrayIndex                                      = uint32_t( le_cmd->info.array_index );
 
-					bindingData.type       = vk::DescriptorType::eStorageImage;
-					bindingData.arrayIndex = uint32_t( le_cmd->info.array_index );
+			} break;
+#endif
+			case le::CommandType::eBindIndexBuffer: {
+				auto *le_cmd = static_cast<le::CommandBindIndexBuffer *>( dataIt );
+				auto  buffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.buffer );
+				cmd.bindIndexBuffer( buffer, le_cmd->info.offset, le_index_type_to_vk( le_cmd->info.indexType ) );
+			} break;
 
-				} break;
-#ifdef LE_FEATURE_RTX
-				case le::CommandType::eSetArgumentTlas: {
-					auto *   le_cmd           = static_cast<le::CommandSetArgumentTlas *>( dataIt );
-					uint64_t argument_name_id = le_cmd->info.argument_name_id;
+			case le::CommandType::eBindVertexBuffers: {
+				auto *le_cmd = static_cast<le::CommandBindVertexBuffers *>( dataIt );
 
-					// Find binding info with name referenced in command
-					auto b = std::find_if( argumentState.binding_infos.begin(), argumentState.binding_infos.end(), [ &argument_name_id ]( const le_shader_binding_info &e ) -> bool {
-						return e.name_hash == argument_name_id;
-					} );
+				uint32_t firstBinding = le_cmd->info.firstBinding;
+				uint32_t numBuffers   = le_cmd->info.bindingCount;
 
-					if ( b == argumentState.binding_infos.end() ) {
-						std::cout << "Warning: Invalid tlas argument name id: 0x" << std::hex << argument_name_id << std::endl
-						          << std::flush;
-						break;
-					}
+				// translate le_buffers to vk_buffers
+				for ( uint32_t b = 0; b != numBuffers; ++b ) {
+					vertexInputBindings[ b + firstBinding ] = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.pBuffers[ b ] );
+				}
 
-					// ---------| invariant: we found an argument name that matches
-					auto setIndex = b->setIndex;
-					auto binding  = b->binding;
+				cmd.bindVertexBuffers( le_cmd->info.firstBinding, le_cmd->info.bindingCount, &vertexInputBindings[ firstBinding ], le_cmd->info.pOffsets );
+			} break;
 
-					auto &bindingData = argumentState.setData[ setIndex ][ binding ];
+			case le::CommandType::eWriteToBuffer: {
 
-					// fetch texture information based on texture id from command
+				// Enqueue copy buffer command
+				// TODO: we must sync this before the next read.
+				auto *le_cmd = static_cast<le::CommandWriteToBuffer *>( dataIt );
 
-					assert( le_cmd->info.tlas_id.getResourceType() == LeResourceType::eRtxTlas );
+				vk::BufferCopy region( le_cmd->info.src_offset, le_cmd->info.dst_offset, le_cmd->info.numBytes );
 
-					auto found_resource = frame.availableResources.find( le_cmd->info.tlas_id );
-					if ( found_resource == frame.availableResources.end() ) {
-						std::cerr << "Could not find acceleration structure: " << le_cmd->info.tlas_id.debug_name
-						          << " Ignoring top level acceleration structure binding command." << std::endl
-						          << std::flush;
-						break;
-					}
+				auto srcBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.src_buffer_id );
+				auto dstBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.dst_buffer_id );
 
-					// ----------| invariant: image view has been found
+				cmd.copyBuffer( srcBuffer, dstBuffer, 1, &region );
 
-					bindingData.accelerationStructureInfo.accelerationStructure = found_resource->second.as.tlas;
-					bindingData.type                                            = vk::DescriptorType::eAccelerationStructureKHR;
-					bindingData.arrayIndex                                      = uint32_t( le_cmd->info.array_index );
+				break;
+			}
 
-				} break;
-#endif
-				case le::CommandType::eBindIndexBuffer: {
-					auto *le_cmd = static_cast<le::CommandBindIndexBuffer *>( dataIt );
-					auto  buffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.buffer );
-					cmd.bindIndexBuffer( buffer, le_cmd->info.offset, le_index_type_to_vk( le_cmd->info.indexType ) );
-				} break;
+			case le::CommandType::eWriteToImage: {
 
-				case le::CommandType::eBindVertexBuffers: {
-					auto *le_cmd = static_cast<le::CommandBindVertexBuffers *>( dataIt );
+				// TODO: Use sync chain to sync
+				// TODO: we can only write to linear images - we must find a way to make our image tiled
 
-					uint32_t firstBinding = le_cmd->info.firstBinding;
-					uint32_t numBuffers   = le_cmd->info.bindingCount;
+				auto *le_cmd = static_cast<le::CommandWriteToImage *>( dataIt );
 
-					// translate le_buffers to vk_buffers
-					for ( uint32_t b = 0; b != numBuffers; ++b ) {
-						vertexInputBindings[ b + firstBinding ] = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.pBuffers[ b ] );
-					}
+				auto srcBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.src_buffer_id );
+				auto dstImage  = frame_data_get_image_from_le_resource_id( frame, le_cmd->info.dst_image_id );
 
-					cmd.bindVertexBuffers( le_cmd->info.firstBinding, le_cmd->info.bindingCount, &vertexInputBindings[ firstBinding ], le_cmd->info.pOffsets );
-				} break;
+				// We define a range that covers all miplevels. this is useful as it allows us to transform
+				// Image layouts in bulk, covering the full mip chain.
+				vk::ImageSubresourceRange rangeAllRemainingMiplevels;
+				rangeAllRemainingMiplevels
+				    .setAspectMask( vk::ImageAspectFlagBits::eColor )
+				    .setBaseMipLevel( le_cmd->info.dst_miplevel )
+				    .setLevelCount( VK_REMAINING_MIP_LEVELS ) // we want all miplevels to be in transferDstOptimal.
+				    .setBaseArrayLayer( le_cmd->info.dst_array_layer )
+				    .setLayerCount( VK_REMAINING_ARRAY_LAYERS ); // we want the range to encompass all layers
 
-				case le::CommandType::eWriteToBuffer: {
+				{
+					vk::BufferMemoryBarrier bufferTransferBarrier;
+					bufferTransferBarrier
+					    .setSrcAccessMask( vk::AccessFlagBits::eHostWrite )    // after host write
+					    .setDstAccessMask( vk::AccessFlagBits::eTransferRead ) // ready buffer for transfer read
+					    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setBuffer( srcBuffer )
+					    .setOffset( le_cmd->info.src_offset )
+					    .setSize( le_cmd->info.numBytes );
+
+					vk::ImageMemoryBarrier imageLayoutToTransferDstOptimal;
+					imageLayoutToTransferDstOptimal
+					    .setSrcAccessMask( {} )                                 // no prior access
+					    .setDstAccessMask( vk::AccessFlagBits::eTransferWrite ) // ready image for transferwrite
+					    .setOldLayout( {} )                                     // from vk::ImageLayout::eUndefined
+					    .setNewLayout( vk::ImageLayout::eTransferDstOptimal )   // to transfer_dst_optimal
+					    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setImage( dstImage )
+					    .setSubresourceRange( rangeAllRemainingMiplevels );
 
-					// Enqueue copy buffer command
-					// TODO: we must sync this before the next read.
-					auto *le_cmd = static_cast<le::CommandWriteToBuffer *>( dataIt );
+					cmd.pipelineBarrier(
+					    vk::PipelineStageFlagBits::eHost,
+					    vk::PipelineStageFlagBits::eTransfer,
+					    {},
+					    {},
+					    { bufferTransferBarrier },          // buffer: host write -> transfer read
+					    { imageLayoutToTransferDstOptimal } // image: prepare for transfer write
+					);
+				}
 
-					vk::BufferCopy region( le_cmd->info.src_offset, le_cmd->info.dst_offset, le_cmd->info.numBytes );
+				{
+					// Copy data for first mip level from buffer to image.
+					//
+					// Then use the first mip level as a source for subsequent mip levels.
+					// When copying from a lower mip level to a higher mip level, we must make
+					// sure to add barriers, as these blit operations are transfers.
+					//
 
-					auto srcBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.src_buffer_id );
-					auto dstBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.dst_buffer_id );
+					vk::ImageSubresourceLayers imageSubresourceLayers;
+					imageSubresourceLayers
+					    .setAspectMask( vk::ImageAspectFlagBits::eColor )
+					    .setMipLevel( 0 )
+					    .setBaseArrayLayer( le_cmd->info.dst_array_layer )
+					    .setLayerCount( 1 );
+
+					vk::BufferImageCopy region;
+					region
+					    .setBufferOffset( le_cmd->info.src_offset )                 // offset of image data within staging buffer
+					    .setBufferRowLength( 0 )                                    // 0 means tightly packed
+					    .setBufferImageHeight( 0 )                                  // 0 means tightly packed
+					    .setImageSubresource( std::move( imageSubresourceLayers ) ) // stored inline
+					    .setImageOffset( { le_cmd->info.offset_x, le_cmd->info.offset_y, le_cmd->info.offset_z } )
+					    .setImageExtent( { le_cmd->info.image_w, le_cmd->info.image_h, le_cmd->info.image_d } );
+
+					cmd.copyBufferToImage( srcBuffer, dstImage, vk::ImageLayout::eTransferDstOptimal, 1, &region );
+				}
 
-					cmd.copyBuffer( srcBuffer, dstBuffer, 1, &region );
+				if ( le_cmd->info.num_miplevels > 1 ) {
 
-					break;
-				}
+					// We generate additional miplevels by issueing scaled blits from one image subresource to the
+					// next higher mip level subresource.
 
-				case le::CommandType::eWriteToImage: {
+					// For this to work, we must first make sure that the image subresource we just wrote to
+					// is ready to be read back. We do this by issueing a read-after-write barrier, and with
+					// the same barrier we also transition the source subresource image to transfer_src_optimal
+					// layout (which is a requirement for blitting operations)
+					//
+					// The target image subresource is already in layout transfer_dst_optimal, as this is the
+					// layout we applied to the whole mip chain when
+
+					const uint32_t         base_miplevel = le_cmd->info.dst_miplevel;
+					vk::ImageMemoryBarrier prepareBlit;
+					prepareBlit
+					    .setSrcAccessMask( vk::AccessFlagBits::eTransferWrite ) // transfer write
+					    .setDstAccessMask( vk::AccessFlagBits::eTransferRead )  // ready image for transfer read
+					    .setOldLayout( vk::ImageLayout::eTransferDstOptimal )   // from transfer dst optimal
+					    .setNewLayout( vk::ImageLayout::eTransferSrcOptimal )   // to shader readonly optimal
+					    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+					    .setImage( dstImage )
+					    .setSubresourceRange( { vk::ImageAspectFlagBits::eColor, base_miplevel, 1, 0, 1 } );
 
-					// TODO: Use sync chain to sync
-					// TODO: we can only write to linear images - we must find a way to make our image tiled
+					cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, { prepareBlit } );
 
-					auto *le_cmd = static_cast<le::CommandWriteToImage *>( dataIt );
+					// Now blit from the srcMipLevel to dstMipLevel
 
-					auto srcBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.src_buffer_id );
-					auto dstImage  = frame_data_get_image_from_le_resource_id( frame, le_cmd->info.dst_image_id );
+					int32_t srcImgWidth  = int32_t( le_cmd->info.image_w );
+					int32_t srcImgHeight = int32_t( le_cmd->info.image_h );
 
-					// We define a range that covers all miplevels. this is useful as it allows us to transform
-					// Image layouts in bulk, covering the full mip chain.
-					vk::ImageSubresourceRange rangeAllRemainingMiplevels;
-					rangeAllRemainingMiplevels
-					    .setAspectMask( vk::ImageAspectFlagBits::eColor )
-					    .setBaseMipLevel( le_cmd->info.dst_miplevel )
-					    .setLevelCount( VK_REMAINING_MIP_LEVELS ) // we want all miplevels to be in transferDstOptimal.
-					    .setBaseArrayLayer( le_cmd->info.dst_array_layer )
-					    .setLayerCount( VK_REMAINING_ARRAY_LAYERS ); // we want the range to encompass all layers
+					for ( uint32_t dstMipLevel = le_cmd->info.dst_miplevel + 1; dstMipLevel < le_cmd->info.num_miplevels; dstMipLevel++ ) {
 
-					{
-						vk::BufferMemoryBarrier bufferTransferBarrier;
-						bufferTransferBarrier
-						    .setSrcAccessMask( vk::AccessFlagBits::eHostWrite )    // after host write
-						    .setDstAccessMask( vk::AccessFlagBits::eTransferRead ) // ready buffer for transfer read
-						    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-						    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-						    .setBuffer( srcBuffer )
-						    .setOffset( 0 ) // we assume a fresh buffer was allocated, so offset must be 0
-						    .setSize( le_cmd->info.numBytes );
-
-						vk::ImageMemoryBarrier imageLayoutToTransferDstOptimal;
-						imageLayoutToTransferDstOptimal
-						    .setSrcAccessMask( {} )                                 // no prior access
-						    .setDstAccessMask( vk::AccessFlagBits::eTransferWrite ) // ready image for transferwrite
-						    .setOldLayout( {} )                                     // from vk::ImageLayout::eUndefined
-						    .setNewLayout( vk::ImageLayout::eTransferDstOptimal )   // to transfer_dst_optimal
-						    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-						    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-						    .setImage( dstImage )
-						    .setSubresourceRange( rangeAllRemainingMiplevels );
+						// Blit from lower mip level into next higher mip level
+						auto srcMipLevel = dstMipLevel - 1;
 
-						cmd.pipelineBarrier(
-						    vk::PipelineStageFlagBits::eHost,
-						    vk::PipelineStageFlagBits::eTransfer,
-						    {},
-						    {},
-						    { bufferTransferBarrier },          // buffer: host write -> transfer read
-						    { imageLayoutToTransferDstOptimal } // image: prepare for transfer write
-						);
-					}
+						// Calculate width and height for next image in mip chain as half the corresponding source
+						// image dimension, unless dimension is smaller or equal to 2, in which case clamp to 1.
+						auto dstImgWidth  = srcImgWidth > 2 ? srcImgWidth >> 1 : 1;
+						auto dstImgHeight = srcImgHeight > 2 ? srcImgHeight >> 1 : 1;
 
-					{
-						// Copy data for first mip level from buffer to image.
-						//
-						// Then use the first mip level as a source for subsequent mip levels.
-						// When copying from a lower mip level to a higher mip level, we must make
-						// sure to add barriers, as these blit operations are transfers.
-						//
+						vk::ImageSubresourceRange rangeSrcMipLevel( vk::ImageAspectFlagBits::eColor, srcMipLevel, 1, 0, 1 );
+						vk::ImageSubresourceRange rangeDstMipLevel( vk::ImageAspectFlagBits::eColor, dstMipLevel, 1, 0, 1 );
 
-						vk::ImageSubresourceLayers imageSubresourceLayers;
-						imageSubresourceLayers
-						    .setAspectMask( vk::ImageAspectFlagBits::eColor )
-						    .setMipLevel( 0 )
-						    .setBaseArrayLayer( le_cmd->info.dst_array_layer )
-						    .setLayerCount( 1 );
+						vk::ImageBlit region;
 
-						vk::BufferImageCopy region;
+						vk::Offset3D offsetZero = { 0, 0, 0 };
+						vk::Offset3D offsetSrc  = { srcImgWidth, srcImgHeight, 1 };
+						vk::Offset3D offsetDst  = { dstImgWidth, dstImgHeight, 1 };
 						region
-						    .setBufferOffset( 0 )                                       // buffer offset is 0, since staging buffer is a fresh, specially allocated buffer
-						    .setBufferRowLength( 0 )                                    // 0 means tightly packed
-						    .setBufferImageHeight( 0 )                                  // 0 means tightly packed
-						    .setImageSubresource( std::move( imageSubresourceLayers ) ) // stored inline
-						    .setImageOffset( { le_cmd->info.offset_x, le_cmd->info.offset_y, le_cmd->info.offset_z } )
-						    .setImageExtent( { le_cmd->info.image_w, le_cmd->info.image_h, le_cmd->info.image_d } );
-
-						cmd.copyBufferToImage( srcBuffer, dstImage, vk::ImageLayout::eTransferDstOptimal, 1, &region );
-					}
-
-					if ( le_cmd->info.num_miplevels > 1 ) {
+						    .setSrcSubresource( { vk::ImageAspectFlagBits::eColor, srcMipLevel, 0, 1 } )
+						    .setDstSubresource( { vk::ImageAspectFlagBits::eColor, dstMipLevel, 0, 1 } )
+						    .setSrcOffsets( { offsetZero, offsetSrc } )
+						    .setDstOffsets( { offsetZero, offsetDst } )
+						    //
+						    ;
 
-						// We generate additional miplevels by issueing scaled blits from one image subresource to the
-						// next higher mip level subresource.
+						cmd.blitImage( dstImage, vk::ImageLayout::eTransferSrcOptimal, dstImage, vk::ImageLayout::eTransferDstOptimal, 1, &region, vk::Filter::eLinear );
 
-						// For this to work, we must first make sure that the image subresource we just wrote to
-						// is ready to be read back. We do this by issueing a read-after-write barrier, and with
-						// the same barrier we also transition the source subresource image to transfer_src_optimal
-						// layout (which is a requirement for blitting operations)
-						//
-						// The target image subresource is already in layout transfer_dst_optimal, as this is the
-						// layout we applied to the whole mip chain when
+						// Now we barrier Read after Write, and transition our freshly blitted subresource to transferSrc,
+						// so that the next iteration may read from it.
 
-						const uint32_t         base_miplevel = le_cmd->info.dst_miplevel;
-						vk::ImageMemoryBarrier prepareBlit;
-						prepareBlit
+						vk::ImageMemoryBarrier finishBlit;
+						finishBlit
 						    .setSrcAccessMask( vk::AccessFlagBits::eTransferWrite ) // transfer write
-						    .setDstAccessMask( vk::AccessFlagBits::eTransferRead )  // ready image for transfer read
+						    .setDstAccessMask( vk::AccessFlagBits::eTransferRead )  // ready image for shader read
 						    .setOldLayout( vk::ImageLayout::eTransferDstOptimal )   // from transfer dst optimal
 						    .setNewLayout( vk::ImageLayout::eTransferSrcOptimal )   // to shader readonly optimal
 						    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
 						    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
 						    .setImage( dstImage )
-						    .setSubresourceRange( { vk::ImageAspectFlagBits::eColor, base_miplevel, 1, 0, 1 } );
+						    .setSubresourceRange( rangeDstMipLevel );
+
+						cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, { finishBlit } );
 
-						cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, { prepareBlit } );
+						// Store this miplevel image's dimensions for next iteration
+						srcImgHeight = dstImgHeight;
+						srcImgWidth  = dstImgWidth;
+					}
 
-						// Now blit from the srcMipLevel to dstMipLevel
+				} // end if mipLevelCount > 1
 
-						int32_t srcImgWidth  = int32_t( le_cmd->info.image_w );
-						int32_t srcImgHeight = int32_t( le_cmd->info.image_h );
+				// Transition image from transfer src optimal to shader read only optimal layout
 
-						for ( uint32_t dstMipLevel = le_cmd->info.dst_miplevel + 1; dstMipLevel < le_cmd->info.num_miplevels; dstMipLevel++ ) {
+				{
+					vk::ImageMemoryBarrier imageLayoutToShaderReadOptimal;
 
-							// Blit from lower mip level into next higher mip level
-							auto srcMipLevel = dstMipLevel - 1;
+					if ( le_cmd->info.num_miplevels > 1 ) {
 
-							// Calculate width and height for next image in mip chain as half the corresponding source
-							// image dimension, unless dimension is smaller or equal to 2, in which case clamp to 1.
-							auto dstImgWidth  = srcImgWidth > 2 ? srcImgWidth >> 1 : 1;
-							auto dstImgHeight = srcImgHeight > 2 ? srcImgHeight >> 1 : 1;
+						// If there were additional miplevels, the miplevel generation logic ensures that all subresources
+						// are left in transfer_src layout.
 
-							vk::ImageSubresourceRange rangeSrcMipLevel( vk::ImageAspectFlagBits::eColor, srcMipLevel, 1, 0, 1 );
-							vk::ImageSubresourceRange rangeDstMipLevel( vk::ImageAspectFlagBits::eColor, dstMipLevel, 1, 0, 1 );
+						imageLayoutToShaderReadOptimal
+						    .setSrcAccessMask( {} )                                  // nothing to flush, as previous barriers ensure flush
+						    .setDstAccessMask( vk::AccessFlagBits::eShaderRead )     // ready image for shader read
+						    .setOldLayout( vk::ImageLayout::eTransferSrcOptimal )    // all subresources are in transfer src optimal
+						    .setNewLayout( vk::ImageLayout::eShaderReadOnlyOptimal ) // to shader readonly optimal
+						    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+						    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+						    .setImage( dstImage )
+						    .setSubresourceRange( rangeAllRemainingMiplevels );
+					} else {
 
-							vk::ImageBlit region;
+						// If there are no additional miplevels, the single subresource will still be in
+						// transfer_dst layout after pixel data was uploaded to it.
 
-							vk::Offset3D offsetZero = { 0, 0, 0 };
-							vk::Offset3D offsetSrc  = { srcImgWidth, srcImgHeight, 1 };
-							vk::Offset3D offsetDst  = { dstImgWidth, dstImgHeight, 1 };
-							region
-							    .setSrcSubresource( { vk::ImageAspectFlagBits::eColor, srcMipLevel, 0, 1 } )
-							    .setDstSubresource( { vk::ImageAspectFlagBits::eColor, dstMipLevel, 0, 1 } )
-							    .setSrcOffsets( { offsetZero, offsetSrc } )
-							    .setDstOffsets( { offsetZero, offsetDst } )
-							    //
-							    ;
+						imageLayoutToShaderReadOptimal
+						    .setSrcAccessMask( vk::AccessFlagBits::eTransferWrite )  // no need to flush anything, that's been done by barriers before
+						    .setDstAccessMask( vk::AccessFlagBits::eShaderRead )     // ready image for shader read
+						    .setOldLayout( vk::ImageLayout::eTransferDstOptimal )    // the single one subresource is in transfer dst optimal
+						    .setNewLayout( vk::ImageLayout::eShaderReadOnlyOptimal ) // to shader readonly optimal
+						    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+						    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
+						    .setImage( dstImage )
+						    .setSubresourceRange( rangeAllRemainingMiplevels );
+					}
 
-							cmd.blitImage( dstImage, vk::ImageLayout::eTransferSrcOptimal, dstImage, vk::ImageLayout::eTransferDstOptimal, 1, &region, vk::Filter::eLinear );
+					cmd.pipelineBarrier(
+					    vk::PipelineStageFlagBits::eTransfer,
+					    vk::PipelineStageFlagBits::eFragmentShader,
+					    {},
+					    {},
+					    {},                                // buffers: nothing to do
+					    { imageLayoutToShaderReadOptimal } // images: prepare for shader read
+					);
+				}
 
-							// Now we barrier Read after Write, and transition our freshly blitted subresource to transferSrc,
-							// so that the next iteration may read from it.
+				break;
+			}
+#ifdef LE_FEATURE_RTX
+			case le::CommandType::eBuildRtxBlas: {
+				auto *le_cmd = static_cast<le::CommandBuildRtxBlas *>( dataIt );
 
-							vk::ImageMemoryBarrier finishBlit;
-							finishBlit
-							    .setSrcAccessMask( vk::AccessFlagBits::eTransferWrite ) // transfer write
-							    .setDstAccessMask( vk::AccessFlagBits::eTransferRead )  // ready image for shader read
-							    .setOldLayout( vk::ImageLayout::eTransferDstOptimal )   // from transfer dst optimal
-							    .setNewLayout( vk::ImageLayout::eTransferSrcOptimal )   // to shader readonly optimal
-							    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setImage( dstImage )
-							    .setSubresourceRange( rangeDstMipLevel );
+				size_t     num_blas_handles  = le_cmd->info.blas_handles_count;
+				auto const blas_handle_begin = reinterpret_cast<le_resource_handle_t *>( le_cmd + 1 );
 
-							cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, { finishBlit } );
+				auto const blas_end = blas_handle_begin + num_blas_handles;
 
-							// Store this miplevel image's dimensions for next iteration
-							srcImgHeight = dstImgHeight;
-							srcImgWidth  = dstImgWidth;
-						}
+				VkBuffer scratchBuffer = frame_data_get_buffer_from_le_resource_id( frame, LE_RTX_SCRATCH_BUFFER_HANDLE );
 
-					} // end if mipLevelCount > 1
+				for ( auto blas_handle = blas_handle_begin; blas_handle != blas_end; blas_handle++ ) {
 
-					// Transition image from transfer src optimal to shader read only optimal layout
+					auto const &               allocated_resource        = frame.availableResources.at( *blas_handle );
+					VkAccelerationStructureKHR vk_acceleration_structure = allocated_resource.as.blas;
+					auto                       blas_info                 = reinterpret_cast<le_rtx_blas_info_o *>( allocated_resource.info.blasInfo.handle );
 
-					{
-						vk::ImageMemoryBarrier imageLayoutToShaderReadOptimal;
-
-						if ( le_cmd->info.num_miplevels > 1 ) {
-
-							// If there were additional miplevels, the miplevel generation logic ensures that all subresources
-							// are left in transfer_src layout.
-
-							imageLayoutToShaderReadOptimal
-							    .setSrcAccessMask( {} )                                  // nothing to flush, as previous barriers ensure flush
-							    .setDstAccessMask( vk::AccessFlagBits::eShaderRead )     // ready image for shader read
-							    .setOldLayout( vk::ImageLayout::eTransferSrcOptimal )    // all subresources are in transfer src optimal
-							    .setNewLayout( vk::ImageLayout::eShaderReadOnlyOptimal ) // to shader readonly optimal
-							    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setImage( dstImage )
-							    .setSubresourceRange( rangeAllRemainingMiplevels );
-						} else {
+					// Translate geometry info from internal format to vk::geometryKHR format.
+					// We do this for each blas, which in turn may have an array of geometries.
 
-							// If there are no additional miplevels, the single subresource will still be in
-							// transfer_dst layout after pixel data was uploaded to it.
-
-							imageLayoutToShaderReadOptimal
-							    .setSrcAccessMask( vk::AccessFlagBits::eTransferWrite )  // no need to flush anything, that's been done by barriers before
-							    .setDstAccessMask( vk::AccessFlagBits::eShaderRead )     // ready image for shader read
-							    .setOldLayout( vk::ImageLayout::eTransferDstOptimal )    // the single one subresource is in transfer dst optimal
-							    .setNewLayout( vk::ImageLayout::eShaderReadOnlyOptimal ) // to shader readonly optimal
-							    .setSrcQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setDstQueueFamilyIndex( VK_QUEUE_FAMILY_IGNORED )
-							    .setImage( dstImage )
-							    .setSubresourceRange( rangeAllRemainingMiplevels );
-						}
+					std::vector<vk::AccelerationStructureGeometryKHR> geometries;
+					geometries.reserve( blas_info->geometries.size() );
 
-						cmd.pipelineBarrier(
-						    vk::PipelineStageFlagBits::eTransfer,
-						    vk::PipelineStageFlagBits::eFragmentShader,
-						    {},
-						    {},
-						    {},                                // buffers: nothing to do
-						    { imageLayoutToShaderReadOptimal } // images: prepare for shader read
-						);
-					}
+					std::vector<vk::AccelerationStructureBuildOffsetInfoKHR> offset_infos;
+					offset_infos.reserve( blas_info->geometries.size() );
 
-					break;
-				}
-#ifdef LE_FEATURE_RTX
-				case le::CommandType::eBuildRtxBlas: {
-					auto *le_cmd = static_cast<le::CommandBuildRtxBlas *>( dataIt );
+					for ( auto const &g : blas_info->geometries ) {
 
-					size_t     num_blas_handles  = le_cmd->info.blas_handles_count;
-					auto const blas_handle_begin = reinterpret_cast<le_resource_handle_t *>( le_cmd + 1 );
+						// TODO: we may want to cache this - so that we don't have to lookup addresses more than once
 
-					auto const blas_end = blas_handle_begin + num_blas_handles;
+						vk::Buffer vertex_buffer = frame_data_get_buffer_from_le_resource_id( frame, g.vertex_buffer );
+						vk::Buffer index_buffer  = frame_data_get_buffer_from_le_resource_id( frame, g.index_buffer );
 
-					VkBuffer scratchBuffer = frame_data_get_buffer_from_le_resource_id( frame, LE_RTX_SCRATCH_BUFFER_HANDLE );
+						vk::DeviceOrHostAddressConstKHR vertex_addr =
+						    device.getBufferAddress( { vertex_buffer } ) + g.vertex_offset;
 
-					for ( auto blas_handle = blas_handle_begin; blas_handle != blas_end; blas_handle++ ) {
+						vk::DeviceOrHostAddressConstKHR index_addr =
+						    g.index_count
+						        ? device.getBufferAddress( { index_buffer } ) + g.index_offset
+						        : 0;
 
-						auto const &               allocated_resource        = frame.availableResources.at( *blas_handle );
-						VkAccelerationStructureKHR vk_acceleration_structure = allocated_resource.as.blas;
-						auto                       blas_info                 = reinterpret_cast<le_rtx_blas_info_o *>( allocated_resource.info.blasInfo.handle );
+						vk::AccelerationStructureGeometryTrianglesDataKHR triangles_data{};
+						triangles_data
+						    .setVertexFormat( le_format_to_vk( g.vertex_format ) )
+						    .setVertexData( vertex_addr )
+						    .setVertexStride( g.vertex_stride )
+						    .setIndexType( le_index_type_to_vk( g.index_type ) )
+						    .setIndexData( index_addr )
+						    .setTransformData( {} ) // no transform data
+						    ;
 
-						// Translate geometry info from internal format to vk::geometryKHR format.
-						// We do this for each blas, which in turn may have an array of geometries.
+						vk::AccelerationStructureGeometryKHR geometry{};
+						geometry
+						    .setFlags( vk::GeometryFlagBitsKHR::eOpaque )
+						    .setGeometryType( vk::GeometryTypeKHR::eTriangles )
+						    .setGeometry( { triangles_data } );
+
+						geometries.emplace_back( geometry );
+
+						vk::AccelerationStructureBuildOffsetInfoKHR offset_info{};
+						if ( g.index_count ) {
+							// indexed geometry
+							offset_info
+							    .setPrimitiveCount( g.index_count / 3 )
+							    .setPrimitiveOffset( 0 )
+							    .setFirstVertex( 0 )
+							    .setTransformOffset( 0 );
+						} else {
+							// non-indexed geometry
+							offset_info.setPrimitiveCount( g.vertex_count / 3 )
+							    .setPrimitiveOffset( 0 )
+							    .setFirstVertex( 0 )
+							    .setTransformOffset( 0 );
+						}
 
-						std::vector<vk::AccelerationStructureGeometryKHR> geometries;
-						geometries.reserve( blas_info->geometries.size() );
+						offset_infos.emplace_back( offset_info );
+					}
 
-						std::vector<vk::AccelerationStructureBuildOffsetInfoKHR> offset_infos;
-						offset_infos.reserve( blas_info->geometries.size() );
+					vk::AccelerationStructureGeometryKHR const *       pGeometries  = geometries.data();
+					vk::AccelerationStructureBuildOffsetInfoKHR const *pOffsetInfos = offset_infos.data();
 
-						for ( auto const &g : blas_info->geometries ) {
+					vk::DeviceOrHostAddressKHR scratchData;
+					//  We get the device address by querying from the buffer.
+					scratchData = device.getBufferAddress( { scratchBuffer } );
 
-							// TODO: we may want to cache this - so that we don't have to lookup addresses more than once
+					vk::AccelerationStructureBuildGeometryInfoKHR info;
+					info
+					    .setType( vk::AccelerationStructureTypeKHR::eBottomLevel )
+					    .setFlags( blas_info->flags )
+					    .setUpdate( false )
+					    .setSrcAccelerationStructure( nullptr )
+					    .setDstAccelerationStructure( vk_acceleration_structure )
+					    .setGeometryArrayOfPointers( false )
+					    .setGeometryCount( uint32_t( geometries.size() ) )
+					    .setPpGeometries( &pGeometries )
+					    .setScratchData( scratchData );
 
-							vk::Buffer vertex_buffer = frame_data_get_buffer_from_le_resource_id( frame, g.vertex_buffer );
-							vk::Buffer index_buffer  = frame_data_get_buffer_from_le_resource_id( frame, g.index_buffer );
+					cmd.buildAccelerationStructureKHR( 1, &info, &pOffsetInfos );
 
-							vk::DeviceOrHostAddressConstKHR vertex_addr =
-							    device.getBufferAddress( { vertex_buffer } ) + g.vertex_offset;
+					// Since the scratch buffer is reused across builds, we need a barrier to ensure one build
+					// is finished before starting the next one
 
-							vk::DeviceOrHostAddressConstKHR index_addr =
-							    g.index_count
-							        ? device.getBufferAddress( { index_buffer } ) + g.index_offset
-							        : 0;
+					vk::MemoryBarrier barrier(
+					    vk::AccessFlagBits::eAccelerationStructureWriteKHR,                         // all writes must be visible ...
+					    vk::AccessFlagBits::eAccelerationStructureReadKHR );                        // ... before the next read happens,
+					cmd.pipelineBarrier( vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // and the barrier is limited to the
+					                     vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // accelerationStructureBuild stage.
+					                     vk::DependencyFlags(), { barrier }, {}, {} );
 
-							vk::AccelerationStructureGeometryTrianglesDataKHR triangles_data{};
-							triangles_data
-							    .setVertexFormat( le_format_to_vk( g.vertex_format ) )
-							    .setVertexData( vertex_addr )
-							    .setVertexStride( g.vertex_stride )
-							    .setIndexType( le_index_type_to_vk( g.index_type ) )
-							    .setIndexData( index_addr )
-							    .setTransformData( {} ) // no transform data
-							    ;
+				} // end for each blas element in array
 
-							vk::AccelerationStructureGeometryKHR geometry{};
-							geometry
-							    .setFlags( vk::GeometryFlagBitsKHR::eOpaque )
-							    .setGeometryType( vk::GeometryTypeKHR::eTriangles )
-							    .setGeometry( { triangles_data } );
-
-							geometries.emplace_back( geometry );
-
-							vk::AccelerationStructureBuildOffsetInfoKHR offset_info{};
-							if ( g.index_count ) {
-								// indexed geometry
-								offset_info
-								    .setPrimitiveCount( g.index_count / 3 )
-								    .setPrimitiveOffset( 0 )
-								    .setFirstVertex( 0 )
-								    .setTransformOffset( 0 );
-							} else {
-								// non-indexed geometry
-								offset_info.setPrimitiveCount( g.vertex_count / 3 )
-								    .setPrimitiveOffset( 0 )
-								    .setFirstVertex( 0 )
-								    .setTransformOffset( 0 );
-							}
+				break;
+			}
+			case le::CommandType::eBuildRtxTlas: {
+				auto *                      le_cmd              = static_cast<le::CommandBuildRtxTlas *>( dataIt );
+				void *                      payload_addr        = le_cmd + 1;
+				le_resource_handle_t const *resources           = static_cast<le_resource_handle_t *>( payload_addr );
+				void *                      scratch_memory_addr = le_cmd->info.staging_buffer_mapped_memory;
+				le_rtx_geometry_instance_t *instances           = static_cast<le_rtx_geometry_instance_t *>( scratch_memory_addr );
 
-							offset_infos.emplace_back( offset_info );
-						}
+				// Foreach resource, we must patch the corresponding instance
 
-						vk::AccelerationStructureGeometryKHR const *       pGeometries  = geometries.data();
-						vk::AccelerationStructureBuildOffsetInfoKHR const *pOffsetInfos = offset_infos.data();
+				const size_t instances_count = le_cmd->info.geometry_instances_count;
 
-						vk::DeviceOrHostAddressKHR scratchData;
-						//  We get the device address by querying from the buffer.
-						scratchData = device.getBufferAddress( { scratchBuffer } );
+				// TODO: Error checking: we should skip this command and issue a
+				// warning if any blas resource could not be found.
 
-						vk::AccelerationStructureBuildGeometryInfoKHR info;
-						info
-						    .setType( vk::AccelerationStructureTypeKHR::eBottomLevel )
-						    .setFlags( blas_info->flags )
-						    .setUpdate( false )
-						    .setSrcAccelerationStructure( nullptr )
-						    .setDstAccelerationStructure( vk_acceleration_structure )
-						    .setGeometryArrayOfPointers( false )
-						    .setGeometryCount( uint32_t( geometries.size() ) )
-						    .setPpGeometries( &pGeometries )
-						    .setScratchData( scratchData );
+				for ( size_t i = 0; i != instances_count; i++ ) {
+					// Update blas handles in-place on GPU mapped, coherent memory.
+					//
+					// The 64bit integer handles for bottom level acceleration structures were queried from the GPU when
+					// building bottom level acceleration structures.
+					instances[ i ].blas_handle = frame.availableResources.at( resources[ i ] ).info.blasInfo.device_address;
+				}
 
-						cmd.buildAccelerationStructureKHR( 1, &info, &pOffsetInfos );
+				// Invariant: all instances should be patched right now, we can use the buffer at offset as
+				// instance data to build tlas.
+				auto const &               allocated_resource        = frame.availableResources.at( le_cmd->info.tlas_handle );
+				VkAccelerationStructureKHR vk_acceleration_structure = allocated_resource.as.tlas;
+				auto                       tlas_info                 = reinterpret_cast<le_rtx_tlas_info_o *>( allocated_resource.info.tlasInfo.handle );
+
+				// Issue barrier to make sure that transfer to instances buffer is complete
+				// before building top-level acceleration structure
+
+				vk::MemoryBarrier barrier( vk::AccessFlagBits::eTransferWrite,                   // All transfers must be visible ...
+				                           vk::AccessFlagBits::eAccelerationStructureWriteKHR ); // ... before we can write to acceleration structures,
+
+				cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer,                      // Writes from transfer ...
+				                     vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // must be visible for accelerationStructureBuild stage.
+				                     vk::DependencyFlags(), { barrier }, {}, {} );
+
+				// instances information is encoded via buffer, but that buffer is also available as host memory,
+				// because it is held in staging_buffer_mapped_memory...
+				VkBuffer instanceBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.staging_buffer_id );
+				VkBuffer scratchBuffer  = frame_data_get_buffer_from_le_resource_id( frame, LE_RTX_SCRATCH_BUFFER_HANDLE );
+
+				vk::DeviceOrHostAddressConstKHR instanceBufferDeviceAddress =
+				    device.getBufferAddress( { instanceBuffer } ) + le_cmd->info.staging_buffer_offset;
+
+				vk::AccelerationStructureGeometryKHR khr_instances_data{ vk::GeometryTypeKHR::eInstances };
+				khr_instances_data.geometry.instances.setArrayOfPointers( false );
+				khr_instances_data.geometry.instances.setData( instanceBufferDeviceAddress );
+				khr_instances_data.setFlags( vk::GeometryFlagBitsKHR::eOpaque );
+
+				// Take pointer to array of khr_instances - we will need one further indirection because reasons.
+				vk::AccelerationStructureGeometryKHR *pKhrInstancesData = &khr_instances_data;
+
+				//  we get the device address by querying from the buffer.
+				vk::DeviceOrHostAddressKHR scratchData =
+				    device.getBufferAddress( { scratchBuffer } );
+
+				vk::AccelerationStructureBuildGeometryInfoKHR info{};
+				info.setType( vk::AccelerationStructureTypeKHR::eTopLevel )
+				    .setFlags( tlas_info->flags )
+				    .setUpdate( false )
+				    .setSrcAccelerationStructure( {} )
+				    .setDstAccelerationStructure( vk_acceleration_structure )
+				    .setGeometryArrayOfPointers( false ) // False: &pInstances is a pointer to a pointer to an array
+				    .setGeometryCount( 1 )               // only one top level acceleration structure
+				    .setPpGeometries( &pKhrInstancesData )
+				    .setScratchData( scratchData );
+
+				vk::AccelerationStructureBuildOffsetInfoKHR buildOffsets{};
+				buildOffsets
+				    .setPrimitiveCount( tlas_info->instances_count ) // This is where we set the number of instances.
+				    .setPrimitiveOffset( 0 )                         // spec states: must be a multiple of 16?!!
+				    .setFirstVertex( 0 )
+				    .setTransformOffset( 0 ) //
+				    ;
+				auto pBuildOffsets = &buildOffsets;
+				cmd.buildAccelerationStructureKHR( 1, &info, &pBuildOffsets );
 
-						// Since the scratch buffer is reused across builds, we need a barrier to ensure one build
-						// is finished before starting the next one
+				break;
+			}
+#endif // LE_FEATURE_RTX
+			default: {
+				assert( false && "command not handled" );
+			}
+			} // end switch header.info.type
 
-						vk::MemoryBarrier barrier(
-						    vk::AccessFlagBits::eAccelerationStructureWriteKHR,                         // all writes must be visible ...
-						    vk::AccessFlagBits::eAccelerationStructureReadKHR );                        // ... before the next read happens,
-						cmd.pipelineBarrier( vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // and the barrier is limited to the
-						                     vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // accelerationStructureBuild stage.
-						                     vk::DependencyFlags(), { barrier }, {}, {} );
+			// Move iterator by size of current le_command so that it points
+			// to the next command in the list.
+			dataIt = static_cast<char *>( dataIt ) + header->info.size;
 
-					} // end for each blas element in array
+			++commandIndex;
+		}
+	}
 
-					break;
-				}
-				case le::CommandType::eBuildRtxTlas: {
-					auto *                      le_cmd              = static_cast<le::CommandBuildRtxTlas *>( dataIt );
-					void *                      payload_addr        = le_cmd + 1;
-					le_resource_handle_t const *resources           = static_cast<le_resource_handle_t *>( payload_addr );
-					void *                      scratch_memory_addr = le_cmd->info.staging_buffer_mapped_memory;
-					le_rtx_geometry_instance_t *instances           = static_cast<le_rtx_geometry_instance_t *>( scratch_memory_addr );
+	// non-draw passes don't need renderpasses.
+	if ( pass.type == LE_RENDER_PASS_TYPE_DRAW && pass.renderPass ) {
+		cmd.endRenderPass();
+	}
 
-					// Foreach resource, we must patch the corresponding instance
+	if ( timestampQueryIndex + 1 < frame.timestampQueryCount ) {
+		cmd.writeTimestamp( vk::PipelineStageFlagBits::eBottomOfPipe, frame.timestampQueryPool, timestampQueryIndex + 1 );
+	}
 
-					const size_t instances_count = le_cmd->info.geometry_instances_count;
+	cmd.end();
 
-					// TODO: Error checking: we should skip this command and issue a
-					// warning if any blas resource could not be found.
+	return cmd;
+}
 
-					for ( size_t i = 0; i != instances_count; i++ ) {
-						// Update blas handles in-place on GPU mapped, coherent memory.
-						//
-						// The 64bit integer handles for bottom level acceleration structures were queried from the GPU when
-						// building bottom level acceleration structures.
-						instances[ i ].blas_handle = frame.availableResources.at( resources[ i ] ).info.blasInfo.device_address;
-					}
+#if ( LE_MT > 0 )
+struct process_pass_params_t {
+	le_backend_o *            backend;
+	BackendFrameData *        frame;
+	size_t                    pass_index;
+	le_frame_capture_t const *replay;
+	vk::CommandBuffer *       result;
+};
 
-					// Invariant: all instances should be patched right now, we can use the buffer at offset as
-					// instance data to build tlas.
-					auto const &               allocated_resource        = frame.availableResources.at( le_cmd->info.tlas_handle );
-					VkAccelerationStructureKHR vk_acceleration_structure = allocated_resource.as.tlas;
-					auto                       tlas_info                 = reinterpret_cast<le_rtx_tlas_info_o *>( allocated_resource.info.tlasInfo.handle );
+static void backend_process_pass_job( void *params_ ) {
+	auto p     = static_cast<process_pass_params_t *>( params_ );
+	*p->result = backend_process_pass( p->backend, *p->frame, p->pass_index, p->replay );
+}
+#endif
 
-					// Issue barrier to make sure that transfer to instances buffer is complete
-					// before building top-level acceleration structure
+// ----------------------------------------------------------------------
+// Decode commandStream for each pass (passes may be processed in parallel)
+// translate into vk specific commands.
+static void backend_process_frame( le_backend_o *self, size_t frameIndex ) {
 
-					vk::MemoryBarrier barrier( vk::AccessFlagBits::eTransferWrite,                   // All transfers must be visible ...
-					                           vk::AccessFlagBits::eAccelerationStructureWriteKHR ); // ... before we can write to acceleration structures,
+	if ( PRINT_DEBUG_MESSAGES ) {
+		std::cout << "** Process Frame #" << std::dec << std::setw( 8 ) << frameIndex << " **" << std::endl
+		          << std::flush;
+	}
 
-					cmd.pipelineBarrier( vk::PipelineStageFlagBits::eTransfer,                      // Writes from transfer ...
-					                     vk::PipelineStageFlagBits::eAccelerationStructureBuildKHR, // must be visible for accelerationStructureBuild stage.
-					                     vk::DependencyFlags(), { barrier }, {}, {} );
+	using namespace le_backend_vk; // for le_allocator_linear_i
 
-					// instances information is encoded via buffer, but that buffer is also available as host memory,
-					// because it is held in staging_buffer_mapped_memory...
-					VkBuffer instanceBuffer = frame_data_get_buffer_from_le_resource_id( frame, le_cmd->info.staging_buffer_id );
-					VkBuffer scratchBuffer  = frame_data_get_buffer_from_le_resource_id( frame, LE_RTX_SCRATCH_BUFFER_HANDLE );
+	auto &frame = self->mFrames[ frameIndex ];
 
-					vk::DeviceOrHostAddressConstKHR instanceBufferDeviceAddress =
-					    device.getBufferAddress( { instanceBuffer } ) + le_cmd->info.staging_buffer_offset;
+	// -- Write this frame to a file if a capture was requested, and fetch the
+	// capture to replay - if any - in place of the command streams of this frame.
+	std::shared_ptr<le_frame_capture_t const> replay;
+	{
+		std::string capture_path;
+		{
+			std::scoped_lock lock( self->frame_capture.mtx );
+			std::swap( capture_path, self->frame_capture.request_path );
+			replay = self->frame_capture.replay;
+		}
 
-					vk::AccelerationStructureGeometryKHR khr_instances_data{ vk::GeometryTypeKHR::eInstances };
-					khr_instances_data.geometry.instances.setArrayOfPointers( false );
-					khr_instances_data.geometry.instances.setData( instanceBufferDeviceAddress );
-					khr_instances_data.setFlags( vk::GeometryFlagBitsKHR::eOpaque );
+		if ( !capture_path.empty() ) {
+			auto capture = frame_capture_create( frame );
+			if ( capture && frame_capture_write( *capture, capture_path.c_str() ) ) {
+				std::cout << "Wrote frame capture to: '" << capture_path << "'" << std::endl
+				          << std::flush;
+			}
+		}
 
-					// Take pointer to array of khr_instances - we will need one further indirection because reasons.
-					vk::AccelerationStructureGeometryKHR *pKhrInstancesData = &khr_instances_data;
+		if ( replay && !frame_capture_matches_frame( *replay, frame ) ) {
+			replay = nullptr; // passes don't match capture - process frame as recorded
+		}
 
-					//  we get the device address by querying from the buffer.
-					vk::DeviceOrHostAddressKHR scratchData =
-					    device.getBufferAddress( { scratchBuffer } );
+		if ( replay ) {
+			for ( size_t i = 0; i != replay->allocators.size(); i++ ) {
+				auto const &a = replay->allocators[ i ];
+				le_allocator_linear_i.restore_used_data( frame.allocators[ i ], a.data.data(), a.data.size() );
+			}
+		}
+	}
 
-					vk::AccelerationStructureBuildGeometryInfoKHR info{};
-					info.setType( vk::AccelerationStructureTypeKHR::eTopLevel )
-					    .setFlags( tlas_info->flags )
-					    .setUpdate( false )
-					    .setSrcAccelerationStructure( {} )
-					    .setDstAccelerationStructure( vk_acceleration_structure )
-					    .setGeometryArrayOfPointers( false ) // False: &pInstances is a pointer to a pointer to an array
-					    .setGeometryCount( 1 )               // only one top level acceleration structure
-					    .setPpGeometries( &pKhrInstancesData )
-					    .setScratchData( scratchData );
+	auto numCommandBuffers = uint32_t( frame.passes.size() );
 
-					vk::AccelerationStructureBuildOffsetInfoKHR buildOffsets{};
-					buildOffsets
-					    .setPrimitiveCount( tlas_info->instances_count ) // This is where we set the number of instances.
-					    .setPrimitiveOffset( 0 )                         // spec states: must be a multiple of 16?!!
-					    .setFirstVertex( 0 )
-					    .setTransformOffset( 0 ) //
-					    ;
-					auto pBuildOffsets = &buildOffsets;
-					cmd.buildAccelerationStructureKHR( 1, &info, &pBuildOffsets );
+	// We write two timestamps per pass, as long as there is space in the query pool.
+	frame.timestampQueryCount =
+	    frame.timestampQueryPool
+	        ? std::min<uint32_t>( 2 * numCommandBuffers, LE_MAX_TIMESTAMP_QUERIES )
+	        : 0;
 
-					break;
-				}
-#endif // LE_FEATURE_RTX
-				default: {
-					assert( false && "command not handled" );
-				}
-				} // end switch header.info.type
+	std::vector<vk::CommandBuffer> cmdBufs( numCommandBuffers );
 
-				// Move iterator by size of current le_command so that it points
-				// to the next command in the list.
-				dataIt = static_cast<char *>( dataIt ) + header->info.size;
+#if ( LE_MT > 0 )
+	// One job per pass - jobs record into separate command buffers, which means
+	// that they can run concurrently. We keep command buffers in pass order.
 
-				++commandIndex;
-			}
-		}
+	std::vector<process_pass_params_t> params( numCommandBuffers );
+	std::vector<le_jobs::job_t>        jobs( numCommandBuffers );
 
-		// non-draw passes don't need renderpasses.
-		if ( pass.type == LE_RENDER_PASS_TYPE_DRAW && pass.renderPass ) {
-			cmd.endRenderPass();
-		}
+	for ( size_t passIndex = 0; passIndex != frame.passes.size(); ++passIndex ) {
+		params[ passIndex ] = { self, &frame, passIndex, replay.get(), &cmdBufs[ passIndex ] };
+		jobs[ passIndex ]   = { backend_process_pass_job, &params[ passIndex ] };
+	}
 
-		cmd.end();
+	if ( !jobs.empty() ) {
+		le_jobs::counter_t *counter;
+		le_jobs::run_jobs( jobs.data(), uint32_t( jobs.size() ), &counter );
+		le_jobs::wait_for_counter_and_free( counter, 0 );
+	}
+#else
+	for ( size_t passIndex = 0; passIndex != frame.passes.size(); ++passIndex ) {
+		cmdBufs[ passIndex ] = backend_process_pass( self, frame, passIndex, replay.get() );
 	}
+#endif
 
-	// place command buffer in frame store so that it can be submitted.
+	// place command buffers in frame store so that they can be submitted - in pass order.
 	for ( auto &&c : cmdBufs ) {
 		frame.commandBuffers.emplace_back( c );
 	}
@@ -5483,6 +7009,12 @@ static le_shader_module_o *backend_create_shader_module( le_backend_o *self, cha
 	return le_pipeline_manager_i.create_shader_module( self->pipelineCache, path, moduleType, macro_definitions );
 }
 
+// ----------------------------------------------------------------------
+static void backend_create_shader_modules( le_backend_o *self, char const *const *paths, LeShaderStageEnum const *moduleTypes, char const *const *macro_definitions, size_t num_modules, le_shader_module_o **modules ) {
+	using namespace le_backend_vk;
+	le_pipeline_manager_i.create_shader_modules( self->pipelineCache, paths, moduleTypes, macro_definitions, num_modules, modules );
+}
+
 // ----------------------------------------------------------------------
 
 static le_pipeline_manager_o *backend_get_pipeline_cache( le_backend_o *self ) {
@@ -5509,19 +7041,36 @@ static bool backend_dispatch_frame( le_backend_o *self, size_t frameIndex ) {
 		render_complete_semaphores.push_back( swp.renderComplete );
 	}
 
+	// The frame is complete once the gpu signals the next value on the frame timeline.
+	frame.timelineValue = ++self->frameTimelineValue;
+
+	// Signal semaphores are: all render complete semaphores (binary), followed by frame timeline.
+	// Values for binary semaphores are ignored.
+	std::vector<vk::Semaphore> signal_semaphores( render_complete_semaphores );
+	std::vector<uint64_t>      signal_semaphore_values( render_complete_semaphores.size(), 0 );
+
+	signal_semaphores.push_back( self->frameTimeline );
+	signal_semaphore_values.push_back( frame.timelineValue );
+
+	vk::TimelineSemaphoreSubmitInfo timelineSubmitInfo;
+	timelineSubmitInfo
+	    .setSignalSemaphoreValueCount( uint32_t( signal_semaphore_values.size() ) )
+	    .setPSignalSemaphoreValues( signal_semaphore_values.data() );
+
 	vk::SubmitInfo submitInfo;
 	submitInfo
+	    .setPNext( &timelineSubmitInfo )
 	    .setWaitSemaphoreCount( uint32_t( present_complete_semaphores.size() ) )
 	    .setPWaitSemaphores( present_complete_semaphores.data() )
 	    .setPWaitDstStageMask( wait_dst_stage_mask.data() )
 	    .setCommandBufferCount( uint32_t( frame.commandBuffers.size() ) )
 	    .setPCommandBuffers( frame.commandBuffers.data() )
-	    .setSignalSemaphoreCount( uint32( render_complete_semaphores.size() ) )
-	    .setPSignalSemaphores( render_complete_semaphores.data() );
+	    .setSignalSemaphoreCount( uint32_t( signal_semaphores.size() ) )
+	    .setPSignalSemaphores( signal_semaphores.data() );
 
 	auto queue = vk::Queue{ self->device->getDefaultGraphicsQueue() };
 
-	queue.submit( { submitInfo }, frame.frameFence );
+	queue.submit( { submitInfo }, nullptr );
 
 	using namespace le_swapchain_vk;
 
@@ -5546,6 +7095,35 @@ static bool backend_dispatch_frame( le_backend_o *self, size_t frameIndex ) {
 
 // ----------------------------------------------------------------------
 
+static void backend_get_frame_gpu_timings( le_backend_o *self, size_t frameIndex, uint64_t const **p_pass_ids, uint64_t const **p_durations_ns, size_t *p_count ) {
+	auto const &frame = self->mFrames[ frameIndex ];
+	*p_pass_ids       = frame.passGpuIds.data();
+	*p_durations_ns   = frame.passGpuDurations.data();
+	*p_count          = frame.passGpuIds.size();
+}
+
+// ----------------------------------------------------------------------
+
+static void backend_get_frame_descriptor_set_cache_stats( le_backend_o *self, size_t frameIndex, uint64_t *p_hits, uint64_t *p_misses ) {
+	auto const &cache = *self->mFrames[ frameIndex ].descriptorSetCache;
+	*p_hits           = cache.last_hit_count;
+	*p_misses         = cache.last_miss_count;
+}
+
+// ----------------------------------------------------------------------
+
+static void backend_get_frame_transient_allocator_stats( le_backend_o *self, size_t frameIndex, le_allocator_linear_stats_t *stats ) {
+	*stats = self->mFrames[ frameIndex ].transientAllocatorStats;
+}
+
+// ----------------------------------------------------------------------
+
+static void backend_get_frame_staging_allocator_stats( le_backend_o *self, size_t frameIndex, le_staging_allocator_stats_t *stats ) {
+	*stats = self->mFrames[ frameIndex ].stagingAllocatorStats;
+}
+
+// ----------------------------------------------------------------------
+
 le_rtx_blas_info_handle backend_create_rtx_blas_info( le_backend_o *self, le_rtx_geometry_t const *geometries, uint32_t geometries_count, LeBuildAccelerationStructureFlags const *flags ) {
 
 	auto *blas_info = new le_rtx_blas_info_o{};
@@ -5586,6 +7164,79 @@ le_rtx_tlas_info_handle backend_create_rtx_tlas_info( le_backend_o *self, uint32
 };
 // ----------------------------------------------------------------------
 
+// Returns the array element for `key` in bindless `indices` - assigns the next free element if
+// `key` has not been registered yet. Returns LE_BINDLESS_INDEX_INVALID if capacity is exhausted.
+// Array elements are never recycled, so that shaders may rely on indices staying stable.
+template <typename Map, typename Key>
+static uint32_t bindless_indices_produce( Map &indices, Key const &key, uint32_t max_count ) {
+
+	auto it = indices.find( key );
+
+	if ( it != indices.end() ) {
+		return it->second;
+	}
+
+	// ----------| invariant: key has not been registered yet
+
+	if ( indices.size() >= max_count ) {
+		return LE_BINDLESS_INDEX_INVALID;
+	}
+
+	uint32_t index = uint32_t( indices.size() );
+	indices.emplace( key, index );
+	return index;
+}
+
+// ----------------------------------------------------------------------
+// Returns index into bindless texture array for given texture.
+// Shaders may sample from this texture via this index, as long as the texture
+// is also declared as sampled for any pass which uses it.
+static uint32_t backend_register_bindless_texture( le_backend_o *self, le_texture_handle texture ) {
+
+	if ( nullptr == self->bindless.pool ) {
+		std::cerr << "ERROR: Cannot register bindless texture - bindless descriptors are not enabled in renderer settings." << std::endl
+		          << std::flush;
+		return LE_BINDLESS_INDEX_INVALID;
+	}
+
+	std::scoped_lock lock( self->bindless.mtx );
+
+	uint32_t index = bindless_indices_produce( self->bindless.texture_indices, texture, LE_BINDLESS_MAX_TEXTURES );
+
+	if ( index == LE_BINDLESS_INDEX_INVALID ) {
+		std::cout << "WARNING: Cannot register bindless texture - maximum number of bindless textures (" << LE_BINDLESS_MAX_TEXTURES << ") reached." << std::endl
+		          << std::flush;
+	}
+
+	return index;
+}
+
+// ----------------------------------------------------------------------
+// Returns index into bindless storage buffer array for given buffer resource.
+static uint32_t backend_register_bindless_buffer( le_backend_o *self, le_resource_handle_t const &buffer ) {
+
+	assert( buffer.getResourceType() == LeResourceType::eBuffer ); // resource type must be buffer
+
+	if ( nullptr == self->bindless.pool ) {
+		std::cerr << "ERROR: Cannot register bindless buffer - bindless descriptors are not enabled in renderer settings." << std::endl
+		          << std::flush;
+		return LE_BINDLESS_INDEX_INVALID;
+	}
+
+	std::scoped_lock lock( self->bindless.mtx );
+
+	uint32_t index = bindless_indices_produce( self->bindless.buffer_indices, buffer, LE_BINDLESS_MAX_BUFFERS );
+
+	if ( index == LE_BINDLESS_INDEX_INVALID ) {
+		std::cout << "WARNING: Cannot register bindless buffer - maximum number of bindless buffers (" << LE_BINDLESS_MAX_BUFFERS << ") reached." << std::endl
+		          << std::flush;
+	}
+
+	return index;
+}
+
+// ----------------------------------------------------------------------
+
 extern void register_le_instance_vk_api( void *api );       // for le_instance_vk.cpp
 extern void register_le_allocator_linear_api( void *api_ ); // for le_allocator.cpp
 extern void register_le_device_vk_api( void *api );         // for le_device_vk.cpp
@@ -5605,14 +7256,22 @@ LE_MODULE_REGISTER_IMPL( le_backend_vk, api_ ) {
 	vk_backend_i.get_transient_allocators   = backend_get_transient_allocators;
 	vk_backend_i.get_staging_allocator      = backend_get_staging_allocator;
 	vk_backend_i.poll_frame_fence           = backend_poll_frame_fence;
+	vk_backend_i.wait_frame_fence           = backend_wait_frame_fence;
+	vk_backend_i.get_gpu_frames_in_flight   = backend_get_gpu_frames_in_flight;
 	vk_backend_i.clear_frame                = backend_clear_frame;
 	vk_backend_i.acquire_physical_resources = backend_acquire_physical_resources;
 	vk_backend_i.process_frame              = backend_process_frame;
 	vk_backend_i.dispatch_frame             = backend_dispatch_frame;
+	vk_backend_i.get_frame_gpu_timings      = backend_get_frame_gpu_timings;
+
+	vk_backend_i.get_frame_descriptor_set_cache_stats = backend_get_frame_descriptor_set_cache_stats;
+	vk_backend_i.get_frame_transient_allocator_stats  = backend_get_frame_transient_allocator_stats;
+	vk_backend_i.get_frame_staging_allocator_stats    = backend_get_frame_staging_allocator_stats;
 
 	vk_backend_i.get_pipeline_cache    = backend_get_pipeline_cache;
 	vk_backend_i.update_shader_modules = backend_update_shader_modules;
 	vk_backend_i.create_shader_module  = backend_create_shader_module;
+	vk_backend_i.create_shader_modules = backend_create_shader_modules;
 
 	vk_backend_i.get_swapchain_resource = backend_get_swapchain_resource;
 	vk_backend_i.get_swapchain_extent   = backend_get_swapchain_extent;
@@ -5622,6 +7281,12 @@ LE_MODULE_REGISTER_IMPL( le_backend_vk, api_ ) {
 	vk_backend_i.create_rtx_blas_info = backend_create_rtx_blas_info;
 	vk_backend_i.create_rtx_tlas_info = backend_create_rtx_tlas_info;
 
+	vk_backend_i.request_frame_capture = backend_request_frame_capture;
+	vk_backend_i.load_frame_capture    = backend_load_frame_capture;
+
+	vk_backend_i.register_bindless_texture = backend_register_bindless_texture;
+	vk_backend_i.register_bindless_buffer  = backend_register_bindless_buffer;
+
 	auto &private_backend_i                  = api_i->private_backend_vk_i;
 	private_backend_i.get_vk_device          = backend_get_vk_device;
 	private_backend_i.get_vk_physical_device = backend_get_vk_physical_device;
@@ -5632,11 +7297,12 @@ LE_MODULE_REGISTER_IMPL( le_backend_vk, api_ ) {
 	private_backend_i.allocate_buffer        = backend_allocate_buffer;
 	private_backend_i.destroy_buffer         = backend_destroy_buffer;
 
-	auto &staging_allocator_i   = api_i->le_staging_allocator_i;
-	staging_allocator_i.create  = staging_allocator_create;
-	staging_allocator_i.destroy = staging_allocator_destroy;
-	staging_allocator_i.map     = staging_allocator_map;
-	staging_allocator_i.reset   = staging_allocator_reset;
+	auto &staging_allocator_i     = api_i->le_staging_allocator_i;
+	staging_allocator_i.create    = staging_allocator_create;
+	staging_allocator_i.destroy   = staging_allocator_destroy;
+	staging_allocator_i.map       = staging_allocator_map;
+	staging_allocator_i.reset     = staging_allocator_reset;
+	staging_allocator_i.get_stats = staging_allocator_get_stats;
 
 	// register/update submodules inside this plugin
 
@@ -31,6 +31,7 @@ LE_OPAQUE_HANDLE( le_rtxpso_handle );
 
 LE_OPAQUE_HANDLE( le_rtx_blas_info_handle ); // handle for backend-managed rtx bottom level acceleration info
 LE_OPAQUE_HANDLE( le_rtx_tlas_info_handle ); // handle for backend-managed rtx top level acceleration info
+LE_OPAQUE_HANDLE( le_texture_handle );       // defined in renderer_types
 struct le_rtx_geometry_t;
 
 struct VkInstance_T;
@@ -51,6 +52,7 @@ struct LeRenderPass;
 
 struct VmaAllocator_T;
 struct VmaAllocation_T;
+struct VmaPool_T;
 struct VmaAllocationCreateInfo;
 struct VmaAllocationInfo;
 
@@ -69,6 +71,7 @@ struct le_backend_vk_settings_t {
 	uint32_t                 concurrency_count              = 1;       // number of potential worker threads
 	le_swapchain_settings_t *pSwapchain_settings            = nullptr; // non-owning, owned by caller of setup method.
 	uint32_t                 num_swapchain_settings         = 1;       // must be set by caller of setup method - tells us how many pSwapchain_settings to expect.
+	bool                     bindlessDescriptors            = false;   // opt-in: enables descriptor indexing, and a global descriptor set for registered textures and buffers
 };
 
 struct le_pipeline_layout_info {
@@ -82,6 +85,32 @@ struct le_pipeline_and_layout_info_t {
 	le_pipeline_layout_info layout_info;
 };
 
+struct le_allocator_linear_stats_t {
+	uint64_t bytes_used;           // bytes handed out since last reset, over all blocks
+	uint64_t bytes_capacity;       // sum of capacity over all blocks
+	uint64_t high_water_mark;      // largest bytes_used seen at any reset
+	uint64_t first_block_capacity; // capacity of first block
+	uint32_t num_blocks;           // number of blocks chained to allocator(s), including first block
+};
+
+struct le_staging_allocator_stats_t {
+	uint64_t bytes_requested;           // bytes mapped for uploads, over ring and dedicated allocations
+	uint64_t bytes_dedicated;           // bytes which did not fit into the staging ring, and needed dedicated allocations
+	uint64_t ring_capacity;             // capacity of staging ring
+	uint32_t num_dedicated_allocations; // number of uploads which needed dedicated allocations
+};
+
+// Pipeline compile latency histograms: bucket 0 counts pipelines which took less than 1ms,
+// bucket i counts pipelines which took [2^(i-1), 2^i) ms, the last bucket counts anything slower.
+struct le_pipeline_compile_stats_t {
+	enum : uint32_t { NUM_HISTOGRAM_BUCKETS = 12 };
+	uint64_t creation_time_histogram[ NUM_HISTOGRAM_BUCKETS ];   // time spent in vkCreate*Pipelines, for all pipeline types
+	uint64_t request_latency_histogram[ NUM_HISTOGRAM_BUCKETS ]; // time from first request until a background graphics pipeline became available
+	uint64_t num_pipelines_pending;                              // graphics pipelines currently being created in the background
+	uint64_t num_fallback_requests;                              // requests for pending pipelines which were served with a fallback pipeline
+	uint64_t num_skipped_requests;                               // requests for pending pipelines which had no fallback - draws get skipped
+};
+
 struct le_backend_vk_api {
 
 	// clang-format off
@@ -91,12 +120,24 @@ struct le_backend_vk_api {
 
 		void                   ( *setup                      ) ( le_backend_o *self, le_backend_vk_settings_t *settings );
 
-		bool                   ( *poll_frame_fence           ) ( le_backend_o* self, size_t frameIndex);
+		bool                   ( *poll_frame_fence           ) ( le_backend_o* self, size_t frameIndex); // non-blocking
+		bool                   ( *wait_frame_fence           ) ( le_backend_o* self, size_t frameIndex, uint64_t timeout_ns ); // may block for up to timeout_ns
+		uint32_t               ( *get_gpu_frames_in_flight   ) ( le_backend_o* self );
 		bool                   ( *clear_frame                ) ( le_backend_o *self, size_t frameIndex );
 		void                   ( *process_frame              ) ( le_backend_o *self, size_t frameIndex );
 		bool                   ( *acquire_physical_resources ) ( le_backend_o *self, size_t frameIndex, le_renderpass_o **passes, size_t numRenderPasses, le_resource_handle_t const * declared_resources, le_resource_info_t const * declared_resources_infos, size_t const & declared_resources_count );
 		bool                   ( *dispatch_frame             ) ( le_backend_o *self, size_t frameIndex );
 
+		/// gpu time per pass, measured via timestamp queries - available after clear_frame, until the next clear_frame for this frame.
+		void                   ( *get_frame_gpu_timings      ) ( le_backend_o *self, size_t frameIndex, uint64_t const ** p_pass_ids, uint64_t const ** p_durations_ns, size_t * p_count );
+
+		/// descriptor sets re-used from / written to the cross-frame descriptor set cache - available after clear_frame, until the next clear_frame for this frame.
+		void                   ( *get_frame_descriptor_set_cache_stats ) ( le_backend_o *self, size_t frameIndex, uint64_t * p_hits, uint64_t * p_misses );
+
+		/// transient allocator usage, summed over all of a frame's allocators - available after clear_frame, until the next clear_frame for this frame.
+		void                   ( *get_frame_transient_allocator_stats  ) ( le_backend_o *self, size_t frameIndex, le_allocator_linear_stats_t * stats );
+		void                   ( *get_frame_staging_allocator_stats    ) ( le_backend_o *self, size_t frameIndex, le_staging_allocator_stats_t * stats );
+
 		size_t                 ( *get_num_swapchain_images   ) ( le_backend_o *self );
 		void                   ( *reset_swapchain            ) ( le_backend_o *self, uint32_t index );
 		void                   ( *reset_failed_swapchains    ) ( le_backend_o *self );
@@ -104,6 +145,7 @@ struct le_backend_vk_api {
 		le_staging_allocator_o*( *get_staging_allocator      ) ( le_backend_o* self, size_t frameIndex);
 
 		le_shader_module_o*    ( *create_shader_module       ) ( le_backend_o* self, char const * path, const LeShaderStageEnum& moduleType, char const * macro_definitions);
+		void                   ( *create_shader_modules      ) ( le_backend_o* self, char const * const * paths, LeShaderStageEnum const * moduleTypes, char const * const * macro_definitions, size_t num_modules, le_shader_module_o** modules);
 		void                   ( *update_shader_modules      ) ( le_backend_o* self );
 
 		le_pipeline_manager_o* ( *get_pipeline_cache         ) ( le_backend_o* self);
@@ -115,6 +157,15 @@ struct le_backend_vk_api {
 
 		le_rtx_blas_info_handle( *create_rtx_blas_info )(le_backend_o* self, le_rtx_geometry_t const * geometries, uint32_t geometries_count, struct LeBuildAccelerationStructureFlags const * flags);
 		le_rtx_tlas_info_handle( *create_rtx_tlas_info )(le_backend_o* self,  uint32_t instances_count, struct LeBuildAccelerationStructureFlags const * flags);
+
+		/// returns stable index into the bindless descriptor set's texture (or buffer) array - LE_BINDLESS_INDEX_INVALID if bindless mode is not enabled.
+		uint32_t               ( *register_bindless_texture  ) ( le_backend_o* self, le_texture_handle texture );
+		uint32_t               ( *register_bindless_buffer   ) ( le_backend_o* self, le_resource_handle_t const & buffer );
+
+		/// Writes command streams and transient allocator data of the next frame to be processed to file_path.
+		void                   ( *request_frame_capture      ) ( le_backend_o* self, char const * file_path );
+		/// Replaces command streams of subsequent frames with command streams from a capture, as long as frame passes match the capture. nullptr unloads capture.
+		bool                   ( *load_frame_capture         ) ( le_backend_o* self, char const * file_path );
 	};
 
 	struct private_backend_vk_interface_t {
@@ -159,7 +210,7 @@ struct le_backend_vk_api {
 	};
 
 	struct device_interface_t {
-		le_device_o *               ( *create                                  ) ( le_backend_vk_instance_o* instance_, const char **extension_names, uint32_t extension_names_count );
+		le_device_o *               ( *create                                  ) ( le_backend_vk_instance_o* instance_, const char **extension_names, uint32_t extension_names_count, bool bindless_descriptors );
 		void                        ( *destroy                                 ) ( le_device_o* self_ );
 
 		le_device_o *			    ( *decrease_reference_count                ) ( le_device_o* self_ );
@@ -182,7 +233,7 @@ struct le_backend_vk_api {
 	};
 
 	struct le_pipeline_manager_interface_t {
-		le_pipeline_manager_o*                   ( *create                            ) ( le_device_o * device        );
+		le_pipeline_manager_o*                   ( *create                            ) ( le_device_o * device, bool bindless_descriptors );
 		void                                     ( *destroy                           ) ( le_pipeline_manager_o* self );
 
 		bool                                     ( *introduce_graphics_pipeline_state ) ( le_pipeline_manager_o *self, graphics_pipeline_state_o* gpso, le_gpso_handle gpsoHandle);
@@ -194,25 +245,49 @@ struct le_backend_vk_api {
 		le_pipeline_and_layout_info_t            ( *produce_compute_pipeline          ) ( le_pipeline_manager_o *self, le_cpso_handle cpsoHandle);
 
 		le_shader_module_o*                      ( *create_shader_module              ) ( le_pipeline_manager_o* self, char const * path, const LeShaderStageEnum& moduleType, char const *macro_definitions);
+
+		/// compiles shader modules concurrently; writes one module per path into `modules`, or nullptr for any module which failed to compile.
+		/// `macro_definitions` may be nullptr, as may any of its elements.
+		void                                     ( *create_shader_modules             ) ( le_pipeline_manager_o* self, char const * const * paths, LeShaderStageEnum const * moduleTypes, char const * const * macro_definitions, size_t num_modules, le_shader_module_o** modules);
 		void                                     ( *update_shader_modules             ) ( le_pipeline_manager_o* self );
 
+		/// writes vulkan pipeline cache, and pipeline manifest, to disk if any pipelines were created since they were last saved - is also called on destroy.
+		bool                                     ( *save_pipeline_cache               ) ( le_pipeline_manager_o* self );
+
+		/// graphics pipelines are created in the background; until a pipeline is available, `produce_graphics_pipeline` returns
+		/// the pipeline for its fallback pso instead - or a null pipeline if no fallback was set. Returns false if pso already had a fallback.
+		bool                                     ( *set_graphics_pipeline_fallback    ) ( le_pipeline_manager_o* self, le_gpso_handle gpsoHandle, le_gpso_handle fallbackHandle);
+		void                                     ( *get_pipeline_compile_stats        ) ( le_pipeline_manager_o* self, le_pipeline_compile_stats_t* stats);
+
+		/// blocks until all pipelines which are being created in the background are available - this includes pipelines
+		/// which get warmed up from the pipeline manifest once their pso has been introduced.
+		void                                     ( *wait_for_pending_pipelines        ) ( le_pipeline_manager_o* self );
+
 		struct VkPipelineLayout_T*               ( *get_pipeline_layout               ) ( le_pipeline_manager_o* self, uint64_t pipeline_layout_key);
 		const struct le_descriptor_set_layout_t* ( *get_descriptor_set_layout         ) ( le_pipeline_manager_o* self, uint64_t setlayout_key);
+
+		/// returns key for the descriptor set layout which pipeline layouts use for bindless sets - only available if the device was created with descriptor indexing.
+		uint64_t                                 ( *produce_bindless_set_layout       ) ( le_pipeline_manager_o* self );
 	};
 
 	struct allocator_linear_interface_t {
-		le_allocator_o *        ( *create               ) ( VmaAllocationInfo const *info, uint16_t alignment);
+		le_allocator_o *        ( *create               ) ( VmaAllocator_T* vmaAlloc, VmaPool_T* pool, VkBufferCreateInfo const * bufferInfo, le_resource_handle_t const & resource_id, uint64_t max_block_size, uint16_t alignment);
 		void                    ( *destroy              ) ( le_allocator_o* self );
 		bool                    ( *allocate             ) ( le_allocator_o* self, uint64_t numBytes, void ** pData, uint64_t* bufferOffset);
-		void                    ( *reset                ) ( le_allocator_o* self );
-		le_resource_handle_t    ( *get_le_resource_id   ) ( le_allocator_o* self );
+		bool                    ( *reset                ) ( le_allocator_o* self ); // returns true if blocks were re-allocated, which invalidates any previous buffer handles
+		le_resource_handle_t    ( *get_le_resource_id   ) ( le_allocator_o* self ); // resource id for the block which served the most recent allocation
+		struct VkBuffer_T*      ( *get_vk_buffer        ) ( le_allocator_o* self, uint8_t block_index );
+		void                    ( *get_stats            ) ( le_allocator_o* self, le_allocator_linear_stats_t* stats );
+		bool                    ( *get_used_data        ) ( le_allocator_o* self, void const ** pData, uint64_t* numBytes ); // fails if more than the first block is in use
+		bool                    ( *restore_used_data    ) ( le_allocator_o* self, void const * data, uint64_t numBytes );
 	};
 
 	struct staging_allocator_interface_t {
-		le_staging_allocator_o* ( *create  )( VmaAllocator_T* const vmaAlloc, VkDevice_T* const device );
-		void                    ( *destroy )( le_staging_allocator_o* self ) ;
-		void                    ( *reset   )( le_staging_allocator_o* self );
-		bool                    ( *map     )( le_staging_allocator_o* self, uint64_t numBytes, void **pData, le_resource_handle_t *resource_handle );
+		le_staging_allocator_o* ( *create    )( VmaAllocator_T* const vmaAlloc, VkDevice_T* const device );
+		void                    ( *destroy   )( le_staging_allocator_o* self ) ;
+		void                    ( *reset     )( le_staging_allocator_o* self );
+		bool                    ( *map       )( le_staging_allocator_o* self, uint64_t numBytes, void **pData, le_resource_handle_t *resource_handle, uint64_t* offset );
+		void                    ( *get_stats )( le_staging_allocator_o* self, le_staging_allocator_stats_t* stats ); // stats for the most recently reset frame
 	};
 
 	struct shader_module_interface_t {
@@ -306,8 +381,8 @@ class Device : NoCopy, NoMove {
 	le_device_o *self = nullptr;
 
   public:
-	Device( le_backend_vk_instance_o *instance_, const char **extension_names, uint32_t extension_names_count )
-	    : self( le_backend_vk::vk_device_i.create( instance_, extension_names, extension_names_count ) ) {
+	Device( le_backend_vk_instance_o *instance_, const char **extension_names, uint32_t extension_names_count, bool bindless_descriptors = false )
+	    : self( le_backend_vk::vk_device_i.create( instance_, extension_names, extension_names_count, bindless_descriptors ) ) {
 		le_backend_vk::vk_device_i.increase_reference_count( self );
 	}
 
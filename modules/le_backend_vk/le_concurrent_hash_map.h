@@ -0,0 +1,152 @@
+#ifndef LE_CONCURRENT_HASH_MAP_H
+#define LE_CONCURRENT_HASH_MAP_H
+
+// Note: this header is internal to le_backend_vk - it lives in a header of its own so
+// that apps/benchmarks/concurrent_hash_map may exercise the same code as le_pipeline.cpp.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "le_core/le_core.h" // for NoCopy, NoMove
+
+// An open-addressing hash map from `uint64_t` key -> `object*`, for read-mostly workloads.
+//
+// Lookups are lock-free, and don't write to shared memory, so that any number of threads
+// may look up objects concurrently without contending for the cache line of a lock.
+//
+// Insertions are serialised via a mutex. If an insertion makes the table grow, the new
+// table gets filled first, and is then atomically published. Readers which are still
+// probing the previous table see a consistent snapshot of it: this is why we retire
+// previous tables instead of freeing them, and only free them once the map gets destroyed.
+// Since tables double in size, retired tables never take up more memory than the current one.
+//
+// Objects are copied on insertion, and never move - pointers to objects stay valid for
+// the lifetime of the map.
+//
+// Keys are expected to be hash values - we use fibonacci hashing to pick slots.
+template <typename T>
+class ConcurrentHashMap : NoCopy, NoMove {
+
+	struct Slot {
+		std::atomic<uint64_t> key{ 0 };
+		std::atomic<T *>      obj{ nullptr }; // nullptr means slot is empty - published after key
+	};
+
+	struct Table {
+		uint32_t                capacity_log2;
+		std::unique_ptr<Slot[]> slots;
+		explicit Table( uint32_t capacity_log2_ )
+		    : capacity_log2( capacity_log2_ )
+		    , slots( new Slot[ size_t( 1 ) << capacity_log2_ ] ) {
+		}
+	};
+
+	static constexpr uint32_t INITIAL_CAPACITY_LOG2 = 6;
+
+	std::atomic<Table *>                table{ nullptr }; // current table - published with release semantics
+	std::vector<std::unique_ptr<Table>> tables;           // owning, current table and any retired tables, protected by mtx
+	std::mutex                          mtx;              // serialises writers
+	size_t                              count = 0;        // number of objects in current table, protected by mtx
+
+	static T *find_in_table( Table const *t, uint64_t key ) {
+		size_t const mask = ( size_t( 1 ) << t->capacity_log2 ) - 1;
+		for ( size_t i = ( key * 0x9e3779b97f4a7c15ull ) >> ( 64 - t->capacity_log2 );; i = ( i + 1 ) & mask ) {
+			T *obj = t->slots[ i ].obj.load( std::memory_order_acquire );
+			if ( obj == nullptr ) {
+				return nullptr; // tables are never more than half full - we will always hit an empty slot
+			}
+			if ( t->slots[ i ].key.load( std::memory_order_relaxed ) == key ) {
+				return obj;
+			}
+		}
+	}
+
+	// Must only be called by writers.
+	static void insert_into_table( Table *t, uint64_t key, T *obj ) {
+		size_t const mask = ( size_t( 1 ) << t->capacity_log2 ) - 1;
+		size_t       i    = ( key * 0x9e3779b97f4a7c15ull ) >> ( 64 - t->capacity_log2 );
+		while ( t->slots[ i ].obj.load( std::memory_order_relaxed ) != nullptr ) {
+			i = ( i + 1 ) & mask;
+		}
+		t->slots[ i ].key.store( key, std::memory_order_relaxed );
+		t->slots[ i ].obj.store( obj, std::memory_order_release );
+	}
+
+	// Must only be called by writers.
+	void reset() {
+		tables.clear();
+		tables.emplace_back( std::make_unique<Table>( INITIAL_CAPACITY_LOG2 ) );
+		table.store( tables.back().get(), std::memory_order_release );
+		count = 0;
+	}
+
+  public:
+	ConcurrentHashMap() {
+		reset();
+	}
+
+	// Returns nullptr if not found. Lock-free.
+	T *find( uint64_t key ) const {
+		return find_in_table( table.load( std::memory_order_acquire ), key );
+	}
+
+	// Inserts a copy of obj - returns false if an object with this key already existed,
+	// in which case obj is not copied.
+	bool try_insert( uint64_t key, T const &obj ) {
+		std::scoped_lock lock( mtx );
+
+		Table *t = table.load( std::memory_order_relaxed );
+
+		if ( find_in_table( t, key ) ) {
+			return false;
+		}
+
+		if ( 2 * ( count + 1 ) > ( size_t( 1 ) << t->capacity_log2 ) ) {
+			// -- grow: fill new table, then publish it - readers may still be probing the previous table.
+			auto grown = std::make_unique<Table>( t->capacity_log2 + 1 );
+			for ( size_t i = 0; i != ( size_t( 1 ) << t->capacity_log2 ); i++ ) {
+				T *e = t->slots[ i ].obj.load( std::memory_order_relaxed );
+				if ( e ) {
+					insert_into_table( grown.get(), t->slots[ i ].key.load( std::memory_order_relaxed ), e );
+				}
+			}
+			t = grown.get();
+			tables.emplace_back( std::move( grown ) );
+			table.store( t, std::memory_order_release );
+		}
+
+		insert_into_table( t, key, new T( obj ) );
+		count++;
+
+		return true;
+	}
+
+	template <typename F>
+	void for_each( F &&fun ) {
+		std::scoped_lock lock( mtx );
+		Table *t = table.load( std::memory_order_relaxed );
+		for ( size_t i = 0; i != ( size_t( 1 ) << t->capacity_log2 ); i++ ) {
+			T *e = t->slots[ i ].obj.load( std::memory_order_relaxed );
+			if ( e ) {
+				fun( e );
+			}
+		}
+	}
+
+	// Deletes all objects. Must not be called while any other thread may look up objects.
+	void clear() {
+		for_each( []( T *e ) { delete e; } );
+		std::scoped_lock lock( mtx );
+		reset();
+	}
+
+	~ConcurrentHashMap() {
+		clear();
+	}
+};
+
+#endif // LE_CONCURRENT_HASH_MAP_H
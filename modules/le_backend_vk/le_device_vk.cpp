@@ -36,6 +36,7 @@ struct le_device_o {
 	};
 
 	std::set<std::string> requestedDeviceExtensions;
+	bool                  bindlessDescriptors = false; // set on creation - enables descriptor indexing features for bindless mode
 
 	DefaultQueueIndices defaultQueueIndices;
 	vk::Format          defaultDepthStencilFormat;
@@ -150,10 +151,12 @@ std::vector<std::tuple<uint32_t, uint32_t, size_t>> findBestMatchForRequestedQue
 
 // ----------------------------------------------------------------------
 
-le_device_o *device_create( le_backend_vk_instance_o *instance_, const char **extension_names, uint32_t extension_names_count ) {
+le_device_o *device_create( le_backend_vk_instance_o *instance_, const char **extension_names, uint32_t extension_names_count, bool bindless_descriptors ) {
 
 	le_device_o *self = new le_device_o{};
 
+	self->bindlessDescriptors = bindless_descriptors;
+
 	using namespace le_backend_vk;
 
 	vk::Instance instance   = vk_instance_i.get_vk_instance( instance_ );
@@ -235,6 +238,11 @@ le_device_o *device_create( le_backend_vk_instance_o *instance_, const char **ex
 			self->requestedDeviceExtensions.insert( *ext );
 		}
 
+		if ( self->bindlessDescriptors ) {
+			// Bindless mode needs descriptor indexing.
+			self->requestedDeviceExtensions.insert( VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME );
+		}
+
 		// We then copy the strings with the names for requested extensions
 		// into this object's storage, so that we can be sure the pointers
 		// will not go stale.
@@ -308,8 +316,23 @@ le_device_o *device_create( le_backend_vk_instance_o *instance_, const char **ex
 	featuresChain.get<vk::PhysicalDeviceVulkan12Features>()
 	    //    .setShaderInt8( true )
 	    //    .setShaderFloat16( true )
+	    .setTimelineSemaphore( true ) // backend tracks frame completion via a timeline semaphore
 	    ;
 
+	if ( self->bindlessDescriptors ) {
+		// Bindless mode: shaders index into runtime-sized descriptor arrays, which may be partially bound,
+		// and which the backend updates after binding. Note that we don't infer bindless mode from the
+		// descriptor indexing extension, as it may have been requested for other reasons (ray tracing requires it).
+		featuresChain.get<vk::PhysicalDeviceVulkan12Features>()
+		    .setDescriptorIndexing( true )
+		    .setRuntimeDescriptorArray( true )
+		    .setDescriptorBindingPartiallyBound( true )
+		    .setDescriptorBindingSampledImageUpdateAfterBind( true )
+		    .setDescriptorBindingStorageBufferUpdateAfterBind( true )
+		    .setShaderSampledImageArrayNonUniformIndexing( true )
+		    .setShaderStorageBufferArrayNonUniformIndexing( true );
+	}
+
 	vk::DeviceCreateInfo deviceCreateInfo;
 	deviceCreateInfo
 	    .setPNext( &featuresChain.get<vk::PhysicalDeviceFeatures2>() )
@@ -6,17 +6,62 @@
 #include <sstream>
 #include <string>
 #include <set>
+#include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
 
 #include <filesystem> // for parsing shader source file paths
 #include <fstream>    // for reading shader source files
 #include <cstring>    // for memcpy
 #include <shared_mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifndef LE_MT
+#	define LE_MT 0
+#endif
+
+#ifndef LE_PIPELINE_ASYNC
+// Whether to create graphics pipelines on background threads - if disabled,
+// pipelines are created on first use, while the frame is being processed.
+#	define LE_PIPELINE_ASYNC 1
+#endif
+
+static constexpr uint32_t LE_PIPELINE_WORKER_COUNT = 2; // number of background threads for creating graphics pipelines
+
+#if ( LE_MT > 0 )
+#	include "le_jobs/le_jobs.h"
+#endif
+
+#ifndef _WIN32
+#	include <sys/mman.h> // for mapping pipeline cache file
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#else
+#	define __PRETTY_FUNCTION__ __FUNCSIG__
+#endif
 
 #include "le_shader_compiler/le_shader_compiler.h"
 #include "util/spirv-cross/spirv_cross.hpp"
-#include "le_file_watcher/le_file_watcher.h" // for watching shader source files
-#include "3rdparty/src/spooky/SpookyV2.h"    // for hashing renderpass gestalt, so that we can test for *compatible* renderpasses
+#include "le_file_watcher/le_file_watcher.h"      // for watching shader source files
+#include "le_backend_vk/le_concurrent_hash_map.h" // lock-free lookups for pipeline manager caches
+#include "3rdparty/src/spooky/SpookyV2.h"         // for hashing renderpass gestalt, so that we can test for *compatible* renderpasses
+
+#ifdef _WIN32
+// Included last, so that windows.h macros don't leak into any of the headers above.
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h> // for mapping pipeline cache file
+#endif
 
 struct le_shader_module_o {
 	uint64_t                                         hash                = 0;     ///< hash taken from spirv code + hash_file_path + hash_shader_defines
@@ -41,167 +86,163 @@ struct le_shader_manager_o {
 	std::unordered_map<std::string, std::set<le_shader_module_o *>> moduleDependencies;    // map 'canonical shader source file path' -> [shader modules]
 	std::set<le_shader_module_o *>                                  modifiedShaderModules; // non-owning pointers to shader modules which need recompiling (used by file watcher)
 
-	le_shader_compiler_o *shader_compiler   = nullptr; // owning
-	le_file_watcher_o *   shaderFileWatcher = nullptr; // owning
+	std::vector<le_shader_compiler_o *> shader_compilers;            // owning, one per worker thread, plus one for the main thread
+	le_file_watcher_o *                 shaderFileWatcher = nullptr; // owning
+
+	std::filesystem::path spirvCacheDirectory;        // compiled spir-v (and its reflection data) is cached in this directory, keyed by hash of inputs
+	std::atomic<uint64_t> spirvCacheHits{ 0 };        // number of shader compilations which could be skipped
+	std::atomic<uint64_t> spirvCacheMisses{ 0 };      // number of shader compilations which went through the shader compiler
+	std::atomic<uint64_t> reflectionCacheHits{ 0 };   // number of shader reflections which could be skipped
+	std::atomic<uint64_t> reflectionCacheMisses{ 0 }; // number of shader reflections which went through spirv-cross
 };
 
-// A table from `handle` -> `object*`, protected by mutex.
-//
-// Access is internally synchronised.
+// A table from `handle` -> `object*`.
 //
-// lookup time will deteriorate linearly with number of elements,
-// but cache locality is very good for lookups, so this should work
-// fairly well for small number of resources such as pipelines.
+// Access is internally synchronised, lookups are lock-free.
 template <typename T, typename U>
 class HashTable : NoCopy, NoMove {
 
-	std::shared_mutex mtx;
-	std::vector<T>    handles;
-	std::vector<U *>  objects; // owning, object is copied on add_entry
+	ConcurrentHashMap<U> store; // owning, object is copied on add_entry
+
+	static uint64_t to_key( T const &handle ) {
+		if constexpr ( std::is_pointer_v<T> ) {
+			return reinterpret_cast<uint64_t>( handle );
+		} else {
+			return uint64_t( handle );
+		}
+	}
 
   public:
 	// Insert a new obj into table, object is copied.
 	// return true if successful, false if entry aready existed.
 	// in case return value is false, object was not copied.
 	bool try_insert( T const &handle, U *obj ) {
-		mtx.lock();
-		size_t i = 0;
-		for ( auto const &h : handles ) {
-			if ( h == handle ) {
-				break;
-			}
-			i++;
-		}
-		if ( i != handles.size() ) {
-			// entry already existed - this is strange.
-			mtx.unlock();
-			return false;
-		}
-		// -------| invariant: i == handles.size()
-		handles.push_back( handle );
-		objects.emplace_back( new U( *obj ) ); // make a copy
-		mtx.unlock();
-		return true;
+		return store.try_insert( to_key( handle ), *obj );
 	}
 
 	// Looks up table entry under `needle`,
 	// returns nullptr if not found.
 	U *const try_find( T const &needle ) {
-		mtx.lock_shared();
-		U *const *obj = objects.data();
-		for ( auto const &h : handles ) {
-			if ( h == needle ) {
-				mtx.unlock();
-				return *obj;
-			}
-			obj++;
-		}
-		// --------| Invariant: no handle matching needle found
-		mtx.unlock();
-		return nullptr;
+		return store.find( to_key( needle ) );
 	}
 
 	typedef void ( *iterator_fun )( U *e, void *user_data );
 
 	// do something on all objects
 	void iterator( iterator_fun fun, void *user_data ) {
-		mtx.lock();
-		for ( auto &e : objects ) {
-			fun( e, user_data );
-		}
-		mtx.unlock();
+		store.for_each( [ fun, user_data ]( U *e ) { fun( e, user_data ); } );
 	}
 
 	void clear() {
-		mtx.lock();
-		for ( auto &obj : objects ) {
-			delete obj;
-		}
-		handles.clear();
-		objects.clear();
-		mtx.unlock();
-	}
-
-	~HashTable() {
-		clear();
+		store.clear();
 	}
 };
 
+// A map from `hash` -> `object*`.
 //
+// Access is internally synchronised, lookups are lock-free.
 template <typename T>
 class HashMap : NoCopy, NoMove {
 
-	std::shared_mutex                               mtx;
-	std::unordered_map<uint64_t, T *, IdentityHash> store; // owning
+	ConcurrentHashMap<T> store; // owning
 
   public:
 	T const *try_find( uint64_t needle ) {
-		mtx.lock_shared();
-		auto e = store.find( needle );
-		if ( e == store.end() ) {
-			mtx.unlock();
-			return nullptr;
-		} else {
-			auto ret = e->second;
-			mtx.unlock();
-			return ret;
-		}
+		return store.find( needle );
 	}
-	bool try_insert( uint64_t handle, T const *obj ) {
-
-		mtx.lock();
-
-		// we attempt an insertion - a nullptr will go in as a placeholder
-		// because we cannot tell at this point whether the insertion will
-		// be successful.
-		auto result = store.emplace( handle, nullptr );
-
-		if ( result.second ) {
-			// Insertion was successful - replace the placeholder with a copy of the actual object.
-			result.first->second = new T( *obj );
-		}
-
-		mtx.unlock();
 
-		return result.second;
+	bool try_insert( uint64_t handle, T const *obj ) {
+		return store.try_insert( handle, *obj );
 	}
 
 	typedef void ( *iterator_fun )( T *e, void *user_data );
 
 	// do something on all objects
 	void iterator( iterator_fun fun, void *user_data ) {
-		mtx.lock();
-		for ( auto &e : store ) {
-			fun( e.second, user_data );
-		}
-		mtx.unlock();
+		store.for_each( [ fun, user_data ]( T *e ) { fun( e, user_data ); } );
 	}
 
 	void clear() {
-		mtx.lock();
-		for ( auto &e : store ) {
-			if ( e.second ) {
-				delete e.second;
-			}
-		}
 		store.clear();
-		mtx.unlock();
-	}
-	~HashMap() {
-		clear();
 	}
 };
 
+static constexpr size_t LE_PIPELINE_MANIFEST_MAX_SHADER_STAGES = 8;
+
+// One entry per pipeline in the pipeline manifest - this is stored to disk as-is, and must therefore
+// only contain plain data, with explicit padding.
+struct le_pipeline_manifest_entry_t {
+	uint64_t gpso_handle;
+	uint64_t renderpass_hash; // hash for *compatible* renderpass
+	uint64_t shader_module_hashes[ LE_PIPELINE_MANIFEST_MAX_SHADER_STAGES ];
+	uint32_t subpass;
+	uint32_t sample_count;
+	uint16_t num_color_attachments;
+	uint16_t num_depth_stencil_attachments;
+	uint16_t num_resolve_attachments;
+	uint16_t num_shader_stages;
+	struct {
+		uint32_t format;
+		uint32_t num_samples;
+		uint32_t type;
+	} attachments[ VK_MAX_COLOR_ATTACHMENTS ]; // only what's needed to create a compatible renderpass
+};
+
+static_assert( std::has_unique_object_representations_v<le_pipeline_manifest_entry_t>, "manifest entry must not contain implicit padding" );
+
 // NOTE: It might make sense to have one pipeline manager per worker thread, and
 //       to consolidate after the frame has been processed.
 struct le_pipeline_manager_o {
-	le_device_o *le_device = nullptr; // arc-owning, increases reference count, decreases on destruction
-	vk::Device   device    = nullptr;
+	le_device_o *le_device           = nullptr; // arc-owning, increases reference count, decreases on destruction
+	vk::Device   device              = nullptr;
+	bool         bindlessDescriptors = false;   // set on creation - shaders may only use the bindless set if the backend has enabled bindless mode
 
 	vk::PipelineCache vulkanCache = nullptr;
 
+	std::filesystem::path vulkanCachePath;                // vulkanCache is loaded from, and saved to this path
+	std::atomic<uint64_t> pipelinesCreatedSinceSave{ 0 }; // we only save the cache if there is anything new to save
+	std::atomic<uint64_t> pipelinesCreated{ 0 };          // | so that we can compare startup with a warm
+	std::atomic<uint64_t> pipelineCreationTimeNs{ 0 };    // | against startup with a cold pipeline cache
+
 	le_shader_manager_o *shaderManager = nullptr; // owning
 
+	// Graphics pipelines which are not yet in the cache get created on background threads,
+	// so that processing a frame never needs to wait for the driver to compile a pipeline.
+	struct GraphicsPipelineRequest {
+		uint64_t                                       pipeline_hash;
+		graphics_pipeline_state_o const *              pso;
+		LeRenderPass                                   pass; // only holds what's needed to create the pipeline - renderPass is a compatible renderpass owned by us
+		uint32_t                                       subpass;
+		std::chrono::high_resolution_clock::time_point t_requested;
+	};
+
+	std::mutex                          pipelineRequestsMtx;
+	std::condition_variable             pipelineRequestsCondition; // signals new requests to background threads
+	std::condition_variable             pipelineCreatedCondition;  // signals that a requested pipeline has been created
+	std::deque<GraphicsPipelineRequest> pipelineRequests;                  // protected by pipelineRequestsMtx
+	std::unordered_set<uint64_t>        pipelineRequestsPending;           // hashes for pipelines which were requested, but not created yet; protected by pipelineRequestsMtx
+	bool                                pipelineWorkersShouldStop = false; // protected by pipelineRequestsMtx
+	std::vector<std::thread>            pipelineWorkers;
+
+	std::shared_mutex shaderModulesMtx; // shader modules must not be recompiled while background threads create pipelines from them
+
+	HashMap<vk::RenderPass> compatibleRenderPasses; // indexed by renderpassHash - for creating pipelines independently of a frame's renderpasses
+	HashMap<le_gpso_handle> graphicsPsoFallbacks;   // indexed by gpso handle
+
+	std::atomic<uint64_t> pipelineCreationTimeHistogram[ le_pipeline_compile_stats_t::NUM_HISTOGRAM_BUCKETS ]{};
+	std::atomic<uint64_t> pipelineRequestLatencyHistogram[ le_pipeline_compile_stats_t::NUM_HISTOGRAM_BUCKETS ]{};
+	std::atomic<uint64_t> fallbackPipelineRequests{ 0 };
+	std::atomic<uint64_t> skippedPipelineRequests{ 0 };
+
+	// Every graphics pipeline which gets produced is recorded into a manifest. On next start, pipelines
+	// from the manifest are created in the background as soon as their pso gets introduced.
+	std::filesystem::path                                           manifestPath;
+	std::mutex                                                      manifestMtx;
+	std::unordered_map<uint64_t, le_pipeline_manifest_entry_t>      manifestRecorded;      // indexed by pipeline hash, protected by manifestMtx
+	std::unordered_multimap<uint64_t, le_pipeline_manifest_entry_t> manifestLoaded;        // indexed by gpso handle, protected by manifestMtx
+	bool                                                            manifestDirty = false; // protected by manifestMtx
+	std::atomic<uint64_t>                                           pipelinesWarmedUp{ 0 };
+
 	HashTable<le_gpso_handle, graphics_pipeline_state_o> graphicsPso;
 	HashTable<le_cpso_handle, compute_pipeline_state_o>  computePso;
 	HashTable<le_rtxpso_handle, rtx_pipeline_state_o>    rtxPso;
@@ -257,6 +298,78 @@ static std::vector<char> load_file( const std::filesystem::path &file_path, bool
 	return contents;
 }
 
+// ----------------------------------------------------------------------
+
+// Read-only, memory-mapped view onto the contents of a file.
+struct le_mapped_file_t {
+	void const *data = nullptr;
+	size_t      size = 0;
+};
+
+// ----------------------------------------------------------------------
+// Returns false if file could not be opened, or if it is empty.
+static bool mapped_file_open( std::filesystem::path const &path, le_mapped_file_t *file ) {
+
+	file->data = nullptr;
+	file->size = 0;
+
+#ifndef _WIN32
+	int fd = open( path.c_str(), O_RDONLY );
+
+	if ( fd == -1 ) {
+		return false;
+	}
+
+	struct stat file_stat {};
+	if ( 0 == fstat( fd, &file_stat ) && file_stat.st_size > 0 ) {
+		void *addr = mmap( nullptr, size_t( file_stat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+		if ( addr != MAP_FAILED ) {
+			file->data = addr;
+			file->size = size_t( file_stat.st_size );
+		}
+	}
+
+	close( fd ); // mapping stays valid after closing file descriptor
+#else
+	HANDLE handle = CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+
+	if ( handle == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+
+	LARGE_INTEGER file_size{};
+	if ( GetFileSizeEx( handle, &file_size ) && file_size.QuadPart > 0 ) {
+		HANDLE mapping = CreateFileMappingW( handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if ( mapping != nullptr ) {
+			void *addr = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+			if ( addr != nullptr ) {
+				file->data = addr;
+				file->size = size_t( file_size.QuadPart );
+			}
+			CloseHandle( mapping ); // view stays valid after closing mapping handle
+		}
+	}
+
+	CloseHandle( handle ); // view stays valid after closing file handle
+#endif
+
+	return file->data != nullptr;
+}
+
+// ----------------------------------------------------------------------
+
+static void mapped_file_close( le_mapped_file_t *file ) {
+	if ( file->data ) {
+#ifndef _WIN32
+		munmap( const_cast<void *>( file->data ), file->size );
+#else
+		UnmapViewOfFile( file->data );
+#endif
+	}
+	file->data = nullptr;
+	file->size = 0;
+}
+
 // ----------------------------------------------------------------------
 // Returns the hash for a given shaderModule
 static uint64_t le_shader_module_get_hash( le_shader_module_o *module ) {
@@ -311,11 +424,272 @@ static bool check_is_data_spirv( const void *raw_data, size_t data_size ) {
 	}
 }
 
+// ----------------------------------------------------------------------
+// Returns the shader compiler for the current thread. Shader compilers must not be shared
+// between threads, which is why we keep one compiler per worker thread, plus one compiler
+// for any thread outside the job system.
+static le_shader_compiler_o *le_shader_manager_get_shader_compiler( le_shader_manager_o *self ) {
+#if ( LE_MT > 0 )
+	int32_t worker_id = le_jobs::get_current_worker_id();
+	size_t  index     = size_t( worker_id + 1 ); // worker_id is -1 if we're not on a worker thread
+	assert( index < self->shader_compilers.size() && "there must be a shader compiler for each worker" );
+	return self->shader_compilers[ index ];
+#else
+	return self->shader_compilers[ 0 ];
+#endif
+}
+
+// ----------------------------------------------------------------------
+
+static constexpr char     LE_SPIRV_CACHE_DIRECTORY[] = "./local_resources/cache/spirv";
+static constexpr uint32_t LE_SPIRV_CACHE_MAGIC       = 0x5653454c; // 'LESV', little endian
+static constexpr uint32_t LE_SPIRV_CACHE_VERSION     = 1;          // bump this if shader compiler options change, to invalidate all cache entries
+
+// SPIR-V cache files start with this header, followed by `spirv_size` bytes of spir-v code,
+// followed by `num_includes` include records. Each include record is an `le_spirv_cache_include_t`,
+// followed by `path_size` bytes of path, padded to 8 bytes.
+struct le_spirv_cache_file_header_t {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;          // hash over compiler inputs - must match key derived from file name
+	uint64_t spirv_size;   // number of bytes of spir-v code following this header
+	uint32_t num_includes; // number of include records following spir-v code
+	uint32_t padding;
+	uint64_t data_hash; // SpookyHash of all data following this header
+};
+
+struct le_spirv_cache_include_t {
+	uint64_t content_hash; // SpookyHash over contents of include file at the time of compilation
+	uint32_t path_size;
+	uint32_t padding;
+};
+
+// ----------------------------------------------------------------------
+// Cache key is calculated over all inputs to the shader compiler which we know about before
+// compiling: source text, macro defines, shader stage, and source file path (which is used to
+// resolve relative includes). Include files are only known after compilation - their contents
+// are validated on lookup, see `spirv_cache_try_load`.
+static uint64_t spirv_cache_calculate_key( void const *source_text, size_t source_text_size, LeShaderStageEnum const &moduleType, char const *original_file_name, std::string const &shaderDefines ) {
+	uint64_t key = SpookyHash::Hash64( &moduleType, sizeof( moduleType ), LE_SPIRV_CACHE_VERSION );
+	key          = SpookyHash::Hash64( shaderDefines.data(), shaderDefines.size(), key );
+	key          = SpookyHash::Hash64( original_file_name, strlen( original_file_name ), key );
+	key          = SpookyHash::Hash64( source_text, source_text_size, key );
+	return key;
+}
+
+// ----------------------------------------------------------------------
+
+static std::filesystem::path spirv_cache_get_path( le_shader_manager_o const *self, uint64_t key, char const *extension = ".spv" ) {
+	std::ostringstream file_name;
+	file_name << std::hex << std::setw( 16 ) << std::setfill( '0' ) << key << extension;
+	return self->spirvCacheDirectory / file_name.str();
+}
+
+// ----------------------------------------------------------------------
+// Returns hash over file contents, or 0 if file could not be read.
+static uint64_t spirv_cache_hash_file_contents( std::filesystem::path const &path ) {
+	le_mapped_file_t file;
+	if ( !mapped_file_open( path, &file ) ) {
+		return 0;
+	}
+	uint64_t hash = SpookyHash::Hash64( file.data, file.size, 0 );
+	mapped_file_close( &file );
+	return hash;
+}
+
+// ----------------------------------------------------------------------
+// Loads spir-v code and set of includes from cache file for given key. Returns false if there
+// is no cache entry, if the entry is corrupt, or if any of the include files which went into the
+// cached compilation have changed since.
+//
+// Since include files are what the file watcher reports via `moduleDependencies`, a hot-reload
+// triggered by an edit to an include file will always miss here, and recompile.
+static bool spirv_cache_try_load( le_shader_manager_o const *self, uint64_t key, std::vector<uint32_t> &spirvCode, std::set<std::string> &includesSet ) {
+
+	if ( self->spirvCacheDirectory.empty() ) {
+		return false;
+	}
+
+	le_mapped_file_t file;
+
+	if ( !mapped_file_open( spirv_cache_get_path( self, key ), &file ) ) {
+		return false;
+	}
+
+	// ----------| invariant: cache file exists
+
+	bool is_valid = false;
+
+	std::vector<uint32_t> cached_spirv;
+	std::set<std::string> cached_includes;
+
+	do {
+
+		le_spirv_cache_file_header_t header;
+
+		if ( file.size < sizeof( header ) ) {
+			break;
+		}
+
+		memcpy( &header, file.data, sizeof( header ) );
+
+		auto const *data      = static_cast<char const *>( file.data ) + sizeof( header );
+		size_t      data_size = file.size - sizeof( header );
+
+		if ( header.magic != LE_SPIRV_CACHE_MAGIC ||
+		     header.version != LE_SPIRV_CACHE_VERSION ||
+		     header.key != key ||
+		     header.spirv_size > data_size ||
+		     header.spirv_size % sizeof( uint32_t ) != 0 ||
+		     header.data_hash != SpookyHash::Hash64( data, data_size, 0 ) ||
+		     false == check_is_data_spirv( data, header.spirv_size ) ) {
+			break;
+		}
+
+		// ----------| invariant: header is valid, and data is not corrupt
+
+		cached_spirv.resize( header.spirv_size / sizeof( uint32_t ) );
+		memcpy( cached_spirv.data(), data, header.spirv_size );
+
+		char const *p_include = data + header.spirv_size;
+		char const *p_end     = data + data_size;
+
+		bool includes_valid = true;
+
+		for ( uint32_t i = 0; i != header.num_includes && includes_valid; i++ ) {
+
+			le_spirv_cache_include_t include;
+
+			if ( size_t( p_end - p_include ) < sizeof( include ) ) {
+				includes_valid = false;
+				break;
+			}
+
+			memcpy( &include, p_include, sizeof( include ) );
+			p_include += sizeof( include );
+
+			size_t padded_path_size = ( size_t( include.path_size ) + 7 ) & ~size_t( 7 );
+
+			if ( size_t( p_end - p_include ) < padded_path_size ) {
+				includes_valid = false;
+				break;
+			}
+
+			std::string include_path( p_include, include.path_size );
+			p_include += padded_path_size;
+
+			// Include file must not have changed since we compiled - otherwise cache entry is stale.
+			includes_valid = ( include.content_hash == spirv_cache_hash_file_contents( include_path ) );
+
+			cached_includes.emplace( std::move( include_path ) );
+		}
+
+		is_valid = includes_valid;
+
+	} while ( false );
+
+	mapped_file_close( &file );
+
+	if ( is_valid ) {
+		spirvCode = std::move( cached_spirv );
+		includesSet.insert( cached_includes.begin(), cached_includes.end() );
+	}
+
+	return is_valid;
+}
+
+// ----------------------------------------------------------------------
+// Writes header, followed by data, to cache file at `cache_path`. We write to a temporary file
+// first, which we then rename, so that a concurrent reader can never see a half-written cache file.
+static bool spirv_cache_write_file( le_shader_manager_o const *self, std::filesystem::path const &cache_path, void const *header, size_t header_size, std::vector<char> const &data ) {
+
+	std::error_code ec;
+	std::filesystem::create_directories( self->spirvCacheDirectory, ec );
+
+	auto tmp_path = cache_path;
+
+	{
+		// Temporary file name must be unique per thread, as more than one thread may
+		// attempt to store the same cache entry.
+		std::ostringstream tmp_suffix;
+		tmp_suffix << "." << std::hex << std::hash<std::thread::id>()( std::this_thread::get_id() ) << ".tmp";
+		tmp_path += tmp_suffix.str();
+	}
+
+	{
+		std::ofstream file( tmp_path, std::ios::out | std::ios::binary | std::ios::trunc );
+
+		if ( !file.is_open() ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not open file for writing: '" << tmp_path.string() << "'" << std::endl
+			          << std::flush;
+			return false;
+		}
+
+		file.write( static_cast<char const *>( header ), std::streamsize( header_size ) );
+		file.write( data.data(), std::streamsize( data.size() ) );
+		file.close();
+
+		if ( file.fail() ) {
+			std::filesystem::remove( tmp_path, ec );
+			return false;
+		}
+	}
+
+	std::filesystem::rename( tmp_path, cache_path, ec );
+
+	if ( ec ) {
+		std::filesystem::remove( tmp_path, ec );
+		return false;
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Stores spir-v code, together with hashes over the contents of all files which it was compiled
+// from, to cache file for given key.
+static bool spirv_cache_store( le_shader_manager_o const *self, uint64_t key, std::vector<uint32_t> const &spirvCode, std::set<std::string> const &includesSet ) {
+
+	if ( self->spirvCacheDirectory.empty() ) {
+		return false;
+	}
+
+	std::vector<char> data( spirvCode.size() * sizeof( uint32_t ) );
+	memcpy( data.data(), spirvCode.data(), data.size() );
+
+	for ( auto const &include_path : includesSet ) {
+
+		le_spirv_cache_include_t include{};
+		include.content_hash = spirv_cache_hash_file_contents( include_path );
+		include.path_size    = uint32_t( include_path.size() );
+
+		if ( include.content_hash == 0 ) {
+			return false; // we can't validate this entry later, don't cache it.
+		}
+
+		size_t offset = data.size();
+		data.resize( offset + sizeof( include ) + ( ( include_path.size() + 7 ) & ~size_t( 7 ) ), 0 );
+		memcpy( data.data() + offset, &include, sizeof( include ) );
+		memcpy( data.data() + offset + sizeof( include ), include_path.data(), include_path.size() );
+	}
+
+	le_spirv_cache_file_header_t header{};
+	header.magic        = LE_SPIRV_CACHE_MAGIC;
+	header.version      = LE_SPIRV_CACHE_VERSION;
+	header.key          = key;
+	header.spirv_size   = spirvCode.size() * sizeof( uint32_t );
+	header.num_includes = uint32_t( includesSet.size() );
+	header.data_hash    = SpookyHash::Hash64( data.data(), data.size(), 0 );
+
+	return spirv_cache_write_file( self, spirv_cache_get_path( self, key ), &header, sizeof( header ), data );
+}
+
 // ----------------------------------------------------------------------
 
 /// \brief translate a binary blob into spirv code if possible
 /// \details Blob may be raw spirv data, or glsl data
-static void translate_to_spirv_code( le_shader_compiler_o *shader_compiler, void *raw_data, size_t numBytes, LeShaderStageEnum moduleType, const char *original_file_name,
+/// \note    compiled glsl is cached on disk, see `spirv_cache_try_load`
+static void translate_to_spirv_code( le_shader_manager_o *self, void *raw_data, size_t numBytes, LeShaderStageEnum moduleType, const char *original_file_name,
                                      std::vector<uint32_t> &spirvCode, std::set<std::string> &includesSet, std::string const &shaderDefines ) {
 
 	if ( check_is_data_spirv( raw_data, numBytes ) ) {
@@ -325,12 +699,23 @@ static void translate_to_spirv_code( le_shader_compiler_o *shader_compiler, void
 
 		// ----------| Invariant: Data is not SPIRV, it still needs to be compiled
 
+		uint64_t cache_key = spirv_cache_calculate_key( raw_data, numBytes, moduleType, original_file_name, shaderDefines );
+
+		if ( spirv_cache_try_load( self, cache_key, spirvCode, includesSet ) ) {
+			++self->spirvCacheHits;
+			return;
+		}
+
+		// ----------| Invariant: No valid cache entry - we must compile
+
+		++self->spirvCacheMisses;
+
 		using namespace le_shader_compiler;
 
 		auto compilation_result = compiler_i.result_create();
 
 		compiler_i.compile_source(
-		    shader_compiler, static_cast<const char *>( raw_data ), numBytes,
+		    le_shader_manager_get_shader_compiler( self ), static_cast<const char *>( raw_data ), numBytes,
 		    moduleType, original_file_name, shaderDefines.c_str(), shaderDefines.size(), compilation_result );
 
 		if ( compiler_i.result_get_success( compilation_result ) == true ) {
@@ -348,6 +733,8 @@ static void translate_to_spirv_code( le_shader_compiler_o *shader_compiler, void
 				// -- update set of includes for this module
 				includesSet.emplace( pStr, strSz );
 			}
+
+			spirv_cache_store( self, cache_key, spirvCode, includesSet );
 		}
 
 		// Release compile result object
@@ -648,10 +1035,14 @@ static void shader_module_update_reflection( le_shader_module_o *module ) {
 	for ( auto &resource : resources.storage_buffers ) {
 		le_shader_binding_info info{};
 
+		// A runtime-sized array of storage buffers reports an array size of 0 - we keep this
+		// as the binding's count, as it marks the binding as part of a bindless set.
+		auto const &tp = compiler.get_type( resource.type_id );
+
 		info.setIndex   = compiler.get_decoration( resource.id, spv::DecorationDescriptorSet );
 		info.binding    = compiler.get_decoration( resource.id, spv::DecorationBinding );
 		info.type       = vk::DescriptorType::eStorageBufferDynamic;
-		info.count      = 1;
+		info.count      = ( !tp.array.empty() && tp.array[ 0 ] == 0 ) ? 0 : 1;
 		info.stage_bits = enumToNum( module->stage );
 		info.name_hash  = hash_64_fnv1a( resource.name.c_str() );
 
@@ -698,71 +1089,248 @@ static void shader_module_update_reflection( le_shader_module_o *module ) {
 
 // ----------------------------------------------------------------------
 
-/// \brief compare sorted bindings and raise the alarm if two successive bindings alias locations
-static bool shader_module_check_bindings_valid( le_shader_binding_info const *bindings, size_t numBindings ) {
+static constexpr uint32_t LE_SPIRV_REFLECTION_CACHE_MAGIC   = 0x4652454c; // 'LERF', little endian
+static constexpr uint32_t LE_SPIRV_REFLECTION_CACHE_VERSION = 2;          // bump this if reflection, or any reflected struct changes
+
+// SPIR-V reflection cache files start with this header, followed by `num_bindings` bindings,
+// `num_vertex_attributes` vertex attribute descriptions, `num_vertex_bindings` vertex binding
+// descriptions, and finally `num_vertex_attributes` vertex attribute names. Each name is stored
+// as a `uint32_t` size, followed by `size` bytes of name.
+struct le_spirv_reflection_cache_file_header_t {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key; // hash over spir-v code and shader stage - must match key derived from file name
+	uint32_t num_bindings;
+	uint32_t num_vertex_attributes;
+	uint32_t num_vertex_bindings;
+	uint32_t padding;
+	uint64_t data_hash; // SpookyHash of all data following this header
+};
 
-	// -- perform sanity check on bindings - bindings must be unique:
-	// (location+binding cannot be shared between shader uniforms)
+// ----------------------------------------------------------------------
+// Reflection data depends on nothing but spir-v code and shader stage.
+static uint64_t spirv_reflection_cache_calculate_key( le_shader_module_o const *module ) {
+	uint64_t key = SpookyHash::Hash64( &module->stage, sizeof( module->stage ), LE_SPIRV_REFLECTION_CACHE_VERSION );
+	key          = SpookyHash::Hash64( module->spirv.data(), module->spirv.size() * sizeof( uint32_t ), key );
+	return key;
+}
 
-	auto b_start = bindings;
-	auto b_end   = b_start + numBindings;
+// ----------------------------------------------------------------------
+// Loads reflection data for module's spir-v code from cache, and stores it with module.
+// Returns false if there is no cache entry, or if the entry is corrupt - in which case
+// the module is left untouched.
+static bool spirv_reflection_cache_try_load( le_shader_manager_o const *self, le_shader_module_o *module ) {
 
-	for ( auto b = b_start, b_prev = b_start; b != b_end; b++ ) {
+	if ( self->spirvCacheDirectory.empty() ) {
+		return false;
+	}
 
-		if ( b == b_prev ) {
-			// first iteration
-			continue;
-		}
+	uint64_t const key = spirv_reflection_cache_calculate_key( module );
 
-		if ( b->setIndex == b_prev->setIndex &&
-		     b->binding == b_prev->binding ) {
-			std::cerr << "ERROR: Illegal shader bindings detected, rejecting shader."
-			          << std::endl
-			          << "Duplicate bindings for set: " << b->setIndex << ", binding: " << b->binding
-			          << std::endl;
-			return false;
-		}
+	le_mapped_file_t file;
 
-		b_prev = b;
+	if ( !mapped_file_open( spirv_cache_get_path( self, key, ".refl" ), &file ) ) {
+		return false;
 	}
 
-	return true;
-}
+	// ----------| invariant: cache file exists
 
-// Create union of bindings over shader stages based on the
-// invariant that each shader stage provides their bindings
-// in ascending order.
-//
-// Returns a vector with binding info, combined over all shader stages given.
-// Note: Bindings *must not* be sparse, otherwise this method will assert(false)
-//
-//
-static std::vector<le_shader_binding_info> shader_modules_merge_bindings( le_shader_module_o const *const *shader_stages, size_t numStages ) {
+	bool is_valid = false;
 
-	// maxNumBindings holds the upper bound for the total number of bindings
-	// assuming no overlaps in bindings between shader stages.
+	std::vector<le_shader_binding_info>              bindings;
+	std::vector<vk::VertexInputAttributeDescription> vertexAttributeDescriptions;
+	std::vector<vk::VertexInputBindingDescription>   vertexBindingDescriptions;
+	std::vector<std::string>                         vertexAttributeNames;
 
-	auto const begin_shader_stages = shader_stages;
-	auto const end_shader_stages   = shader_stages + numStages;
+	do {
 
-	std::vector<le_shader_binding_info> all_bindings;
+		le_spirv_reflection_cache_file_header_t header;
 
-	// accumulate all bindings
+		if ( file.size < sizeof( header ) ) {
+			break;
+		}
 
-	for ( auto s = begin_shader_stages; s != end_shader_stages; s++ ) {
-		all_bindings.insert( all_bindings.end(), ( *s )->bindings.begin(), ( *s )->bindings.end() );
-	}
+		memcpy( &header, file.data, sizeof( header ) );
 
-	auto get_filepaths_affected_by_message = []( le_shader_module_o const *const *begin_shader_stages,
-	                                             le_shader_module_o const *const *end_shader_stages,
-	                                             uint32_t                         stage_bitfield ) {
-		std::ostringstream os;
+		auto const *data      = static_cast<char const *>( file.data ) + sizeof( header );
+		size_t      data_size = file.size - sizeof( header );
 
-		// print out filenames for shader stage which matches stage bitflag
+		size_t const fixed_size = header.num_bindings * sizeof( le_shader_binding_info ) +
+		                          header.num_vertex_attributes * sizeof( vk::VertexInputAttributeDescription ) +
+		                          header.num_vertex_bindings * sizeof( vk::VertexInputBindingDescription );
 
-		for ( auto s = begin_shader_stages; s != end_shader_stages; s++ ) {
-			if ( enumToNum( ( *s )->stage ) & stage_bitfield ) {
-				os << "\t '" << ( *s )->filepath << "'" << std::endl;
+		if ( header.magic != LE_SPIRV_REFLECTION_CACHE_MAGIC ||
+		     header.version != LE_SPIRV_REFLECTION_CACHE_VERSION ||
+		     header.key != key ||
+		     fixed_size > data_size ||
+		     header.data_hash != SpookyHash::Hash64( data, data_size, 0 ) ) {
+			break;
+		}
+
+		// ----------| invariant: header is valid, and data is not corrupt
+
+		char const *p     = data;
+		char const *p_end = data + data_size;
+
+		bindings.resize( header.num_bindings );
+		memcpy( bindings.data(), p, bindings.size() * sizeof( le_shader_binding_info ) );
+		p += bindings.size() * sizeof( le_shader_binding_info );
+
+		vertexAttributeDescriptions.resize( header.num_vertex_attributes );
+		memcpy( vertexAttributeDescriptions.data(), p, vertexAttributeDescriptions.size() * sizeof( vk::VertexInputAttributeDescription ) );
+		p += vertexAttributeDescriptions.size() * sizeof( vk::VertexInputAttributeDescription );
+
+		vertexBindingDescriptions.resize( header.num_vertex_bindings );
+		memcpy( vertexBindingDescriptions.data(), p, vertexBindingDescriptions.size() * sizeof( vk::VertexInputBindingDescription ) );
+		p += vertexBindingDescriptions.size() * sizeof( vk::VertexInputBindingDescription );
+
+		bool names_valid = true;
+
+		for ( uint32_t i = 0; i != header.num_vertex_attributes; i++ ) {
+
+			uint32_t name_size;
+
+			if ( size_t( p_end - p ) < sizeof( name_size ) ) {
+				names_valid = false;
+				break;
+			}
+
+			memcpy( &name_size, p, sizeof( name_size ) );
+			p += sizeof( name_size );
+
+			if ( size_t( p_end - p ) < name_size ) {
+				names_valid = false;
+				break;
+			}
+
+			vertexAttributeNames.emplace_back( p, name_size );
+			p += name_size;
+		}
+
+		is_valid = names_valid;
+
+	} while ( false );
+
+	mapped_file_close( &file );
+
+	if ( is_valid ) {
+		module->hash_pipelinelayout         = le_shader_bindings_calculate_hash( bindings.data(), bindings.size() );
+		module->bindings                    = std::move( bindings );
+		module->vertexAttributeDescriptions = std::move( vertexAttributeDescriptions );
+		module->vertexBindingDescriptions   = std::move( vertexBindingDescriptions );
+		module->vertexAttributeNames        = std::move( vertexAttributeNames );
+	}
+
+	return is_valid;
+}
+
+// ----------------------------------------------------------------------
+// Stores module's reflection data to cache, keyed by module's spir-v code and shader stage.
+static bool spirv_reflection_cache_store( le_shader_manager_o const *self, le_shader_module_o const *module ) {
+
+	if ( self->spirvCacheDirectory.empty() ) {
+		return false;
+	}
+
+	auto append = []( std::vector<char> &data, void const *src, size_t num_bytes ) {
+		size_t offset = data.size();
+		data.resize( offset + num_bytes );
+		memcpy( data.data() + offset, src, num_bytes );
+	};
+
+	std::vector<char> data;
+
+	append( data, module->bindings.data(), module->bindings.size() * sizeof( le_shader_binding_info ) );
+	append( data, module->vertexAttributeDescriptions.data(), module->vertexAttributeDescriptions.size() * sizeof( vk::VertexInputAttributeDescription ) );
+	append( data, module->vertexBindingDescriptions.data(), module->vertexBindingDescriptions.size() * sizeof( vk::VertexInputBindingDescription ) );
+
+	for ( auto const &name : module->vertexAttributeNames ) {
+		uint32_t name_size = uint32_t( name.size() );
+		append( data, &name_size, sizeof( name_size ) );
+		append( data, name.data(), name.size() );
+	}
+
+	uint64_t const key = spirv_reflection_cache_calculate_key( module );
+
+	le_spirv_reflection_cache_file_header_t header{};
+	header.magic                 = LE_SPIRV_REFLECTION_CACHE_MAGIC;
+	header.version               = LE_SPIRV_REFLECTION_CACHE_VERSION;
+	header.key                   = key;
+	header.num_bindings          = uint32_t( module->bindings.size() );
+	header.num_vertex_attributes = uint32_t( module->vertexAttributeDescriptions.size() );
+	header.num_vertex_bindings   = uint32_t( module->vertexBindingDescriptions.size() );
+	header.data_hash             = SpookyHash::Hash64( data.data(), data.size(), 0 );
+
+	return spirv_cache_write_file( self, spirv_cache_get_path( self, key, ".refl" ), &header, sizeof( header ), data );
+}
+
+// ----------------------------------------------------------------------
+
+/// \brief compare sorted bindings and raise the alarm if two successive bindings alias locations
+static bool shader_module_check_bindings_valid( le_shader_binding_info const *bindings, size_t numBindings ) {
+
+	// -- perform sanity check on bindings - bindings must be unique:
+	// (location+binding cannot be shared between shader uniforms)
+
+	auto b_start = bindings;
+	auto b_end   = b_start + numBindings;
+
+	for ( auto b = b_start, b_prev = b_start; b != b_end; b++ ) {
+
+		if ( b == b_prev ) {
+			// first iteration
+			continue;
+		}
+
+		if ( b->setIndex == b_prev->setIndex &&
+		     b->binding == b_prev->binding ) {
+			std::cerr << "ERROR: Illegal shader bindings detected, rejecting shader."
+			          << std::endl
+			          << "Duplicate bindings for set: " << b->setIndex << ", binding: " << b->binding
+			          << std::endl;
+			return false;
+		}
+
+		b_prev = b;
+	}
+
+	return true;
+}
+
+// Create union of bindings over shader stages based on the
+// invariant that each shader stage provides their bindings
+// in ascending order.
+//
+// Returns a vector with binding info, combined over all shader stages given.
+// Note: Bindings *must not* be sparse, otherwise this method will assert(false)
+//
+//
+static std::vector<le_shader_binding_info> shader_modules_merge_bindings( le_shader_module_o const *const *shader_stages, size_t numStages ) {
+
+	// maxNumBindings holds the upper bound for the total number of bindings
+	// assuming no overlaps in bindings between shader stages.
+
+	auto const begin_shader_stages = shader_stages;
+	auto const end_shader_stages   = shader_stages + numStages;
+
+	std::vector<le_shader_binding_info> all_bindings;
+
+	// accumulate all bindings
+
+	for ( auto s = begin_shader_stages; s != end_shader_stages; s++ ) {
+		all_bindings.insert( all_bindings.end(), ( *s )->bindings.begin(), ( *s )->bindings.end() );
+	}
+
+	auto get_filepaths_affected_by_message = []( le_shader_module_o const *const *begin_shader_stages,
+	                                             le_shader_module_o const *const *end_shader_stages,
+	                                             uint32_t                         stage_bitfield ) {
+		std::ostringstream os;
+
+		// print out filenames for shader stage which matches stage bitflag
+
+		for ( auto s = begin_shader_stages; s != end_shader_stages; s++ ) {
+			if ( enumToNum( ( *s )->stage ) & stage_bitfield ) {
+				os << "\t '" << ( *s )->filepath << "'" << std::endl;
 			}
 		}
 		return os.str();
@@ -856,21 +1424,29 @@ static std::vector<le_shader_binding_info> shader_modules_merge_bindings( le_sha
 
 // ----------------------------------------------------------------------
 
-static void le_shader_manager_shader_module_update( le_shader_manager_o *self, le_shader_module_o *module ) {
+// Holds everything needed to compile a shader module. Compilation only writes
+// to its own job, so that any number of jobs may be compiled concurrently.
+struct le_shader_module_compile_job_t {
+	le_shader_manager_o * shader_manager = nullptr;
+	le_shader_module_o    module;            // in: stage, filepath, macro_defines; out: hashes, spirv, reflection data
+	std::set<std::string> includesSet;       // out: all source files which went into this module
+	uint64_t              previous_hash = 0; // if spirv hash matches this, we skip reflection
+	bool                  success       = false;
+};
+
+// ----------------------------------------------------------------------
+// Loads source, compiles it to spir-v, and - if the result differs from the module's previous
+// spir-v - reflects it. This method may be called from any thread.
+static void le_shader_manager_compile_module( le_shader_module_compile_job_t *job ) {
 
-	// Shader module needs updating if shader code has changed.
-	// if this happens, a new vulkan object for the module must be created.
+	auto &module = job->module;
 
-	// The module must be locked for this, as we need exclusive access just in case the module is
-	// in use by the frame recording thread, which may want to create pipelines.
-	//
-	// Vulkan lifetimes require us only to keep module alive for as long as a pipeline is being
-	// generated from it. This means we "only" need to protect against any threads which might be
-	// creating pipelines.
+	if ( module.filepath.empty() ) {
+		return;
+	}
 
-	// -- get module spirv code
 	bool loadSuccessful = false;
-	auto source_text    = load_file( module->filepath, &loadSuccessful );
+	auto source_text    = load_file( module.filepath, &loadSuccessful );
 
 	if ( !loadSuccessful ) {
 		// file could not be loaded. bail out.
@@ -878,60 +1454,116 @@ static void le_shader_manager_shader_module_update( le_shader_manager_o *self, l
 	}
 
 	std::vector<uint32_t> spirv_code;
-	std::set<std::string> includesSet{ { module->filepath.string() } }; // let first element be the original source file path
+	job->includesSet = { module.filepath.string() }; // let first element be the original source file path
 
-	translate_to_spirv_code( self->shader_compiler, source_text.data(), source_text.size(), { module->stage }, module->filepath.string().c_str(), spirv_code, includesSet, module->macro_defines );
+	translate_to_spirv_code( job->shader_manager, source_text.data(), source_text.size(), { module.stage }, module.filepath.string().c_str(), spirv_code, job->includesSet, module.macro_defines );
 
 	if ( spirv_code.empty() ) {
 		// no spirv code available, bail out.
 		return;
 	}
 
-	module->hash_file_path      = SpookyHash::Hash64( module->filepath.string().data(), module->filepath.string().size(), 0 );
-	module->hash_shader_defines = SpookyHash::Hash64( module->macro_defines.data(), module->macro_defines.size(), 0 );
+	module.hash_file_path      = SpookyHash::Hash64( module.filepath.string().data(), module.filepath.string().size(), 0 );
+	module.hash_shader_defines = SpookyHash::Hash64( module.macro_defines.data(), module.macro_defines.size(), 0 );
 
-	// -- check spirv code hash against module spirv hash
-	uint64_t path_and_shader_defines_hash_data[ 2 ] = { module->hash_file_path, module->hash_shader_defines };
+	uint64_t path_and_shader_defines_hash_data[ 2 ] = { module.hash_file_path, module.hash_shader_defines };
 	uint64_t path_and_shader_defines_hash           = SpookyHash::Hash64( path_and_shader_defines_hash_data, sizeof( path_and_shader_defines_hash_data ), 0 );
 
-	uint64_t hash_of_module = SpookyHash::Hash64( spirv_code.data(), spirv_code.size() * sizeof( uint32_t ), path_and_shader_defines_hash );
+	module.hash = SpookyHash::Hash64( spirv_code.data(), spirv_code.size() * sizeof( uint32_t ), path_and_shader_defines_hash );
 
-	if ( hash_of_module == module->hash ) {
-		// spirv code identical, no update needed, bail out.
+	if ( module.hash == job->previous_hash ) {
+		// spirv code identical, no need to reflect.
+		job->success = true;
 		return;
 	}
 
-	le_shader_module_o previous_module = *module; // create backup copy
+	module.spirv = std::move( spirv_code );
 
-	// -- update module hash
-	module->hash = hash_of_module;
+	// -- update bindings via spirv-cross, and update bindings hash - unless we have cached
+	//    reflection data for this spirv code.
+	if ( spirv_reflection_cache_try_load( job->shader_manager, &module ) ) {
+		++job->shader_manager->reflectionCacheHits;
+	} else {
+		++job->shader_manager->reflectionCacheMisses;
+		shader_module_update_reflection( &module );
+		spirv_reflection_cache_store( job->shader_manager, &module );
+	}
 
-	// -- update additional include paths, if necessary.
-	le_pipeline_cache_set_module_dependencies_for_watched_file( self, module, includesSet );
+	job->success = shader_module_check_bindings_valid( module.bindings.data(), module.bindings.size() );
+}
 
-	// ---------| Invariant: new spir-v code detected.
+// ----------------------------------------------------------------------
+
+#if ( LE_MT > 0 )
+static void le_shader_manager_compile_module_job( void *job ) {
+	le_shader_manager_compile_module( static_cast<le_shader_module_compile_job_t *>( job ) );
+}
+#endif
+
+// ----------------------------------------------------------------------
+// Compiles all given jobs - in parallel if we have a job system - and returns once
+// all jobs are complete.
+static void le_shader_manager_compile_modules( le_shader_module_compile_job_t *compile_jobs, size_t num_compile_jobs ) {
+
+#if ( LE_MT > 0 )
+	if ( num_compile_jobs > 1 ) {
+		std::vector<le_jobs::job_t> jobs( num_compile_jobs );
+
+		for ( size_t i = 0; i != num_compile_jobs; i++ ) {
+			jobs[ i ] = { le_shader_manager_compile_module_job, &compile_jobs[ i ] };
+		}
+
+		le_jobs::counter_t *counter;
+		le_jobs::run_jobs( jobs.data(), uint32_t( jobs.size() ), &counter );
+		le_jobs::wait_for_counter_and_free( counter, 0 );
+		return;
+	}
+#endif
+
+	for ( size_t i = 0; i != num_compile_jobs; i++ ) {
+		le_shader_manager_compile_module( &compile_jobs[ i ] );
+	}
+}
+
+// ----------------------------------------------------------------------
+// Applies the result of a compile job to the module it was compiled from. Must be called
+// from a single thread, as it updates the shader manager's table of module dependencies.
+static void le_shader_manager_shader_module_update( le_shader_manager_o *self, le_shader_module_o *module, le_shader_module_compile_job_t &job ) {
 
-	// -- if hash doesn't match, delete old vk module, create new vk module
+	// Shader module needs updating if shader code has changed.
+	// if this happens, a new vulkan object for the module must be created.
 
-	// -- store new spir-v code
-	module->spirv = std::move( spirv_code );
+	// The module must be locked for this, as we need exclusive access just in case the module is
+	// in use by the frame recording thread, which may want to create pipelines.
+	//
+	// Vulkan lifetimes require us only to keep module alive for as long as a pipeline is being
+	// generated from it. This means we "only" need to protect against any threads which might be
+	// creating pipelines.
 
-	// -- update bindings via spirv-cross, and update bindings hash
-	shader_module_update_reflection( module );
+	if ( !job.success ) {
+		// compilation, or reflection failed - we keep the previous version of this module.
+		return;
+	}
 
-	if ( false == shader_module_check_bindings_valid( module->bindings.data(), module->bindings.size() ) ) {
-		// we must clean up, and report an error
-		*module = previous_module;
+	if ( job.module.hash == module->hash ) {
+		// spirv code identical, no update needed, bail out.
 		return;
 	}
 
+	// ---------| Invariant: new spir-v code detected.
+
+	// -- update additional include paths, if necessary.
+	le_pipeline_cache_set_module_dependencies_for_watched_file( self, module, job.includesSet );
+
 	// -- delete old vulkan shader module object
 	// Q: Should we rather defer deletion? In case that this module is in use?
 	// A: Not really - according to spec module must only be alife while pipeline is being compiled.
 	//    If we can guarantee that no other process is using this module at the moment to compile a
 	//    Pipeline, we can safely delete it.
 	self->device.destroyShaderModule( module->module );
-	module->module = nullptr;
+
+	// -- store new spir-v code, hashes, and reflection data
+	*module = std::move( job.module );
 
 	// -- create new vulkan shader module object
 	vk::ShaderModuleCreateInfo createInfo( vk::ShaderModuleCreateFlags(), module->spirv.size() * sizeof( uint32_t ), module->spirv.data() );
@@ -948,10 +1580,35 @@ static void le_shader_manager_update_shader_modules( le_shader_manager_o *self )
 	// callbacks will modify le_backend->modifiedShaderModules
 	le_file_watcher_api_i->le_file_watcher_i.poll_notifications( self->shaderFileWatcher );
 
+	if ( self->modifiedShaderModules.empty() ) {
+		return;
+	}
+
 	// -- update only modules which have been tainted
+	//
+	// An edit to an include file may taint many modules at once - we compile these
+	// concurrently, and then apply results in order of module creation, so that the
+	// outcome does not depend on which compile job finishes first.
+
+	std::vector<le_shader_module_o *>           modules;
+	std::vector<le_shader_module_compile_job_t> compile_jobs;
+
+	for ( auto &m : self->shaderModules ) {
+		if ( self->modifiedShaderModules.count( m ) ) {
+			le_shader_module_compile_job_t job;
+			job.shader_manager = self;
+			job.module         = *m;
+			job.module.module  = nullptr; // the job must not own the vulkan module
+			job.previous_hash  = m->hash;
+			modules.push_back( m );
+			compile_jobs.emplace_back( std::move( job ) );
+		}
+	}
 
-	for ( auto &s : self->modifiedShaderModules ) {
-		le_shader_manager_shader_module_update( self, s );
+	le_shader_manager_compile_modules( compile_jobs.data(), compile_jobs.size() );
+
+	for ( size_t i = 0; i != modules.size(); i++ ) {
+		le_shader_manager_shader_module_update( self, modules[ i ], compile_jobs[ i ] );
 	}
 
 	self->modifiedShaderModules.clear();
@@ -964,13 +1621,18 @@ le_shader_manager_o *le_shader_manager_create( VkDevice_T *device ) {
 
 	self->device = device;
 
-	// -- create shader compiler
+	// -- create shader compilers: one for each worker thread, plus one for the main thread.
 	using namespace le_shader_compiler;
-	self->shader_compiler = compiler_i.create();
+	self->shader_compilers.resize( LE_MT + 1 );
+	for ( auto &c : self->shader_compilers ) {
+		c = compiler_i.create();
+	}
 
 	// -- create file watcher for shader files so that changes can be detected
 	self->shaderFileWatcher = le_file_watcher_api_i->le_file_watcher_i.create();
 
+	self->spirvCacheDirectory = LE_SPIRV_CACHE_DIRECTORY;
+
 	return self;
 }
 
@@ -981,17 +1643,21 @@ static void le_shader_manager_destroy( le_shader_manager_o *self ) {
 	using namespace le_shader_compiler;
 	using namespace le_file_watcher;
 
+	std::cout << "SPIR-V cache: " << std::dec << self->spirvCacheHits << " hits, " << self->spirvCacheMisses << " misses." << std::endl
+	          << "SPIR-V reflection cache: " << self->reflectionCacheHits << " hits, " << self->reflectionCacheMisses << " misses." << std::endl
+	          << std::flush;
+
 	if ( self->shaderFileWatcher ) {
 		// -- destroy file watcher
 		le_file_watcher_i.destroy( self->shaderFileWatcher );
 		self->shaderFileWatcher = nullptr;
 	}
 
-	if ( self->shader_compiler ) {
-		// -- destroy shader compiler
-		compiler_i.destroy( self->shader_compiler );
-		self->shader_compiler = nullptr;
+	// -- destroy shader compilers
+	for ( auto &c : self->shader_compilers ) {
+		compiler_i.destroy( c );
 	}
+	self->shader_compilers.clear();
 
 	// -- destroy retained shader modules
 
@@ -1007,97 +1673,98 @@ static void le_shader_manager_destroy( le_shader_manager_o *self ) {
 }
 
 // ----------------------------------------------------------------------
-/// \brief create vulkan shader module based on file path
-/// \details FIXME: this method can get called nearly anywhere - it should not be publicly accessible.
+/// \brief create vulkan shader modules based on file paths
+/// \details Modules are compiled concurrently, and then added to the shader manager in order.
+/// `modules` receives one module per path - or nullptr for any module which failed to compile.
+///
+/// FIXME: this method can get called nearly anywhere - it should not be publicly accessible.
 /// ideally, this method is only allowed to be called in the setup phase.
 ///
 /// TODO: consider handing out an opaque handle instead of a pointer for shader_module, so that it becomes
 /// clear that the object is owned by the backend, and must not be deleted or directly accessed outside.
-static le_shader_module_o *le_shader_manager_create_shader_module( le_shader_manager_o *self, char const *path, const LeShaderStageEnum &moduleType, char const *macro_defines_ ) {
+static void le_shader_manager_create_shader_modules( le_shader_manager_o *self, char const *const *paths, LeShaderStageEnum const *moduleTypes, char const *const *macro_defines, size_t num_modules, le_shader_module_o **modules ) {
 
 	// This method gets called through the renderer - it is assumed during the setup stage.
 
-	bool loadSuccessful = false;
-	auto raw_file_data  = load_file( path, &loadSuccessful ); // returns a raw byte vector
-
-	if ( !loadSuccessful ) {
-		return nullptr;
-	}
-
-	// ---------| invariant: load was successful
+	std::vector<le_shader_module_compile_job_t> compile_jobs( num_modules );
 
-	// We use the canonical path to store a fingerprint of the file
-	auto canonical_path_as_string = std::filesystem::canonical( path ).string();
+	for ( size_t i = 0; i != num_modules; i++ ) {
 
-	// -- Make sure the file contains spir-v code.
+		auto &job = compile_jobs[ i ];
 
-	std::vector<uint32_t> spirv_code;
-	std::set<std::string> includesSet = { { canonical_path_as_string } }; // let first element be the source file path
+		job.shader_manager = self;
 
-	std::string macro_defines = macro_defines_ ? std::string( macro_defines_ ) : "";
+		std::error_code ec;
+		// We use the canonical path to store a fingerprint of the file
+		job.module.filepath = std::filesystem::canonical( paths[ i ], ec );
 
-	translate_to_spirv_code( self->shader_compiler, raw_file_data.data(), raw_file_data.size(), moduleType, path, spirv_code, includesSet, macro_defines );
+		if ( ec ) {
+			std::cerr << "Unable to open file: " << paths[ i ] << std::endl
+			          << std::flush;
+			job.module.filepath.clear();
+		}
 
-	// FIXME: we need to check spirv code is ok, that compilation succeeded.
+		job.module.stage         = moduleTypes[ i ];
+		job.module.macro_defines = ( macro_defines && macro_defines[ i ] ) ? std::string( macro_defines[ i ] ) : "";
+	}
 
-	le_shader_module_o *module = new le_shader_module_o{};
+	le_shader_manager_compile_modules( compile_jobs.data(), compile_jobs.size() );
 
-	module->stage         = moduleType;
-	module->filepath      = canonical_path_as_string;
-	module->macro_defines = macro_defines;
+	// ---------| invariant: all modules compiled - merge results in order
 
-	module->hash_file_path      = SpookyHash::Hash64( module->filepath.string().data(), module->filepath.string().size(), 0 );
-	module->hash_shader_defines = SpookyHash::Hash64( module->macro_defines.data(), module->macro_defines.size(), 0 );
+	for ( size_t i = 0; i != num_modules; i++ ) {
 
-	uint64_t path_and_shader_defines_hash_data[ 2 ] = { module->hash_file_path, module->hash_shader_defines };
-	uint64_t path_and_shader_defines_hash           = SpookyHash::Hash64( path_and_shader_defines_hash_data, sizeof( path_and_shader_defines_hash_data ), 0 );
+		auto &job = compile_jobs[ i ];
 
-	module->hash = SpookyHash::Hash64( spirv_code.data(), spirv_code.size() * sizeof( uint32_t ), path_and_shader_defines_hash );
+		modules[ i ] = nullptr;
 
-	{
-		// -- Check if module is already present in render module cache.
+		if ( !job.success ) {
+			continue;
+		}
 
-		auto found_module = std::find_if( self->shaderModules.begin(), self->shaderModules.end(), [ module ]( const le_shader_module_o *m ) -> bool {
-			return module->hash == m->hash;
-		} );
+		{
+			// -- Check if module is already present in render module cache.
+			// -- If module found in cache, return cached module, discard local module
 
-		// -- If module found in cache, return cached module, discard local module
+			auto found_module = std::find_if( self->shaderModules.begin(), self->shaderModules.end(), [ &job ]( const le_shader_module_o *m ) -> bool {
+				return job.module.hash == m->hash;
+			} );
 
-		if ( found_module != self->shaderModules.end() ) {
-			delete module;
-			return *found_module;
+			if ( found_module != self->shaderModules.end() ) {
+				modules[ i ] = *found_module;
+				continue;
+			}
 		}
-	}
 
-	// ---------| invariant: no previous module with this hash exists
+		// ---------| invariant: no previous module with this hash exists
 
-	module->spirv = std::move( spirv_code );
+		le_shader_module_o *module = new le_shader_module_o( std::move( job.module ) );
 
-	shader_module_update_reflection( module );
+		{
+			// -- create vulkan shader object
+			// flags must be 0 (reserved for future use), size is given in bytes
+			vk::ShaderModuleCreateInfo createInfo( vk::ShaderModuleCreateFlags(), module->spirv.size() * sizeof( uint32_t ), module->spirv.data() );
 
-	if ( false == shader_module_check_bindings_valid( module->bindings.data(), module->bindings.size() ) ) {
-		// we must clean up, and report an error
-		delete module;
-		return nullptr;
-	}
+			module->module = self->device.createShaderModule( createInfo );
+		}
 
-	// ----------| invariant: bindings sanity check passed
+		// -- retain module in shader manager
+		self->shaderModules.push_back( module );
 
-	{
-		// -- create vulkan shader object
-		// flags must be 0 (reserved for future use), size is given in bytes
-		vk::ShaderModuleCreateInfo createInfo( vk::ShaderModuleCreateFlags(), module->spirv.size() * sizeof( uint32_t ), module->spirv.data() );
+		// -- add all source files for this file to the list of watched
+		//    files that point back to this module
+		le_pipeline_cache_set_module_dependencies_for_watched_file( self, module, job.includesSet );
 
-		module->module = self->device.createShaderModule( createInfo );
+		modules[ i ] = module;
 	}
+}
 
-	// -- retain module in shader manager
-	self->shaderModules.push_back( module );
-
-	// -- add all source files for this file to the list of watched
-	//    files that point back to this module
-	le_pipeline_cache_set_module_dependencies_for_watched_file( self, module, includesSet );
-
+// ----------------------------------------------------------------------
+/// \brief create vulkan shader module based on file path
+/// \returns a shader module, or nullptr upon failure
+static le_shader_module_o *le_shader_manager_create_shader_module( le_shader_manager_o *self, char const *path, const LeShaderStageEnum &moduleType, char const *macro_defines ) {
+	le_shader_module_o *module = nullptr;
+	le_shader_manager_create_shader_modules( self, &path, &moduleType, &macro_defines, 1, &module );
 	return module;
 }
 
@@ -1228,6 +1895,48 @@ static inline vk::ShaderStageFlagBits le_to_vk( const le::ShaderStage &stage ) {
 	return vk::ShaderStageFlagBits( stage );
 }
 
+// ----------------------------------------------------------------------
+// Accumulates time spent creating pipelines - this is the time which a warm pipeline cache saves us.
+// Adds duration since t_start to histogram - see le_pipeline_compile_stats_t for bucket sizes.
+static uint64_t histogram_add_duration( std::atomic<uint64_t> *histogram, std::chrono::high_resolution_clock::time_point const &t_start ) {
+	auto     t_end       = std::chrono::high_resolution_clock::now();
+	uint64_t duration_ns = uint64_t( std::chrono::duration_cast<std::chrono::nanoseconds>( t_end - t_start ).count() );
+
+	uint32_t bucket = 0;
+	for ( uint64_t ms = duration_ns / 1000000; ms != 0 && bucket + 1 < le_pipeline_compile_stats_t::NUM_HISTOGRAM_BUCKETS; ms >>= 1 ) {
+		bucket++;
+	}
+
+	histogram[ bucket ]++;
+
+	return duration_ns;
+}
+
+// ----------------------------------------------------------------------
+
+static void le_pipeline_manager_track_pipeline_creation( le_pipeline_manager_o *self, std::chrono::high_resolution_clock::time_point const &t_start ) {
+	self->pipelineCreationTimeNs += histogram_add_duration( self->pipelineCreationTimeHistogram, t_start );
+	self->pipelinesCreated++;
+	self->pipelinesCreatedSinceSave++;
+}
+
+// ----------------------------------------------------------------------
+// Returns specialization info referring to given constants - or nullptr, if there are no constants.
+// Specialization info must outlive pipeline creation, which is why the caller provides storage.
+static vk::SpecializationInfo const *specialization_constants_get_info( le_specialization_constants_t const &constants, vk::SpecializationInfo *info ) {
+
+	if ( constants.entries.empty() ) {
+		return nullptr;
+	}
+
+	info->setMapEntryCount( uint32_t( constants.entries.size() ) )
+	    .setPMapEntries( constants.entries.data() )
+	    .setDataSize( constants.data.size() )
+	    .setPData( constants.data.data() );
+
+	return info;
+}
+
 // ----------------------------------------------------------------------
 // Creates a vulkan graphics pipeline based on a shader state object and a given renderpass and subpass index.
 //
@@ -1238,6 +1947,9 @@ static vk::Pipeline le_pipeline_cache_create_graphics_pipeline( le_pipeline_mana
 
 	le_shader_module_o *vertexShaderModule = nullptr; // We may need the vertex shader module later
 
+	vk::SpecializationInfo        specializationInfoStorage;
+	vk::SpecializationInfo const *specializationInfo = specialization_constants_get_info( pso->specializationConstants, &specializationInfoStorage );
+
 	for ( auto const &shader_stage : pso->shaderStages ) {
 
 		// Try to set the vertex shader module pointer while we are at it. We will need it
@@ -1249,11 +1961,11 @@ static vk::Pipeline le_pipeline_cache_create_graphics_pipeline( le_pipeline_mana
 
 		vk::PipelineShaderStageCreateInfo info{};
 		info
-		    .setFlags( {} )                              // must be 0 - "reserved for future use"
-		    .setStage( le_to_vk( shader_stage->stage ) ) //
-		    .setModule( shader_stage->module )           //
-		    .setPName( "main" )                          //
-		    .setPSpecializationInfo( nullptr )           // TODO: set specialisation constants
+		    .setFlags( {} )                               // must be 0 - "reserved for future use"
+		    .setStage( le_to_vk( shader_stage->stage ) )  //
+		    .setModule( shader_stage->module )            //
+		    .setPName( "main" )                           //
+		    .setPSpecializationInfo( specializationInfo ) // same constants for all stages
 		    ;
 
 		pipelineStages.emplace_back( info );
@@ -1378,7 +2090,9 @@ static vk::Pipeline le_pipeline_cache_create_graphics_pipeline( le_pipeline_mana
 	    .setBasePipelineIndex( 0 )                                 // -1 signals not to use a base pipeline index
 	    ;
 
+	auto t_start         = std::chrono::high_resolution_clock::now();
 	auto creation_result = self->device.createGraphicsPipeline( self->vulkanCache, gpi );
+	le_pipeline_manager_track_pipeline_creation( self, t_start );
 
 	assert( creation_result.result == vk::Result::eSuccess && "pipeline must be created successfully" );
 	return creation_result.value;
@@ -1391,13 +2105,16 @@ static vk::Pipeline le_pipeline_cache_create_compute_pipeline( le_pipeline_manag
 	// Fetch vk::PipelineLayout for this pso
 	auto pipelineLayout = le_pipeline_manager_get_pipeline_layout( self, &pso->shaderStage, 1 );
 
+	vk::SpecializationInfo        specializationInfoStorage;
+	vk::SpecializationInfo const *specializationInfo = specialization_constants_get_info( pso->specializationConstants, &specializationInfoStorage );
+
 	vk::PipelineShaderStageCreateInfo shaderStage{};
 	shaderStage
 	    .setFlags( {} )                                  // must be 0 - "reserved for future use"
 	    .setStage( le_to_vk( pso->shaderStage->stage ) ) //
 	    .setModule( pso->shaderStage->module )           //
 	    .setPName( "main" )                              //
-	    .setPSpecializationInfo( nullptr )               // TODO: Use specialisation consts to set workgroup size?
+	    .setPSpecializationInfo( specializationInfo )    // may be used to set workgroup size
 	    ;
 
 	vk::ComputePipelineCreateInfo cpi;
@@ -1409,7 +2126,10 @@ static vk::Pipeline le_pipeline_cache_create_compute_pipeline( le_pipeline_manag
 	    .setBasePipelineIndex( 0 ) // -1 signals not to use base pipeline index
 	    ;
 
+	auto t_start         = std::chrono::high_resolution_clock::now();
 	auto creation_result = self->device.createComputePipeline( self->vulkanCache, cpi );
+	le_pipeline_manager_track_pipeline_creation( self, t_start );
+
 	assert( creation_result.result == vk::Result::eSuccess && "pipeline must be created successfully" );
 
 	return creation_result.value;
@@ -1493,7 +2213,10 @@ static vk::Pipeline le_pipeline_cache_create_rtx_pipeline( le_pipeline_manager_o
 	    .setBasePipelineHandle( nullptr )
 	    .setBasePipelineIndex( 0 );
 
-	auto result = self->device.createRayTracingPipelineKHR( self->vulkanCache, create_info );
+	auto t_start = std::chrono::high_resolution_clock::now();
+	auto result  = self->device.createRayTracingPipelineKHR( self->vulkanCache, create_info );
+	le_pipeline_manager_track_pipeline_creation( self, t_start );
+
 	assert( vk::Result::eSuccess == result.result );
 	return result.value;
 }
@@ -1627,37 +2350,151 @@ static uint64_t le_pipeline_cache_produce_descriptor_set_layout( le_pipeline_man
 
 		bool result = descriptorSetLayouts.try_insert( set_layout_hash, &le_layout_info );
 
-		assert( result && "descriptorSetLayout insertion must be successful" );
+		if ( false == result ) {
+			// Another thread inserted an identical layout while we were creating ours -
+			// we must dispose of our vulkan objects, and use the layout from the cache.
+			self->device.destroyDescriptorUpdateTemplate( updateTemplate );
+			self->device.destroyDescriptorSetLayout( *layout );
+			*layout = descriptorSetLayouts.try_find( set_layout_hash )->vk_descriptor_set_layout;
+		}
 	}
 
 	return set_layout_hash;
 }
 
 // ----------------------------------------------------------------------
-// Calculates pipeline layout info by first consolidating all bindings
-// over all referenced shader modules, and then ordering these by descriptor sets.
-//
-static le_pipeline_layout_info le_pipeline_cache_produce_pipeline_layout_info( le_pipeline_manager_o *self, le_shader_module_o const *const *shader_modules, size_t shader_modules_count ) {
-	le_pipeline_layout_info info{};
-
-	std::vector<le_shader_binding_info> combined_bindings = shader_modules_merge_bindings( shader_modules, shader_modules_count );
 
-	// -- Create array of DescriptorSetLayouts
-	std::array<vk::DescriptorSetLayout, 8> vkLayouts{};
-	{
+// Key under which the bindless descriptor set layout is stored with all other descriptor set layouts.
+static constexpr uint64_t LE_BINDLESS_SET_LAYOUT_KEY = hash_64_fnv1a_const( "le_bindless_descriptor_set_layout" );
 
-		// -- Create one vkDescriptorSetLayout for each set in bindings
+/// \brief returns key for the bindless descriptor set layout, creates and retains vkDescriptorSetLayout if necessary
+static uint64_t le_pipeline_cache_produce_bindless_descriptor_set_layout( le_pipeline_manager_o *self, vk::DescriptorSetLayout *layout ) {
 
-		std::vector<std::vector<le_shader_binding_info>> sets;
+	auto &descriptorSetLayouts = self->descriptorSetLayouts;
 
-		// Split combined bindings at set boundaries
-		uint32_t set_idx = 0;
-		for ( auto it = combined_bindings.begin(); it != combined_bindings.end(); ) {
+	auto foundLayout = descriptorSetLayouts.try_find( LE_BINDLESS_SET_LAYOUT_KEY );
 
-			// Find next element with different set id
-			auto itN = std::find_if( it, combined_bindings.end(), [ &set_idx ]( const le_shader_binding_info &el ) -> bool {
-				return el.setIndex != set_idx;
-			} );
+	if ( foundLayout ) {
+		*layout = foundLayout->vk_descriptor_set_layout;
+		return LE_BINDLESS_SET_LAYOUT_KEY;
+	}
+
+	// ----------| invariant: layout was not found in cache, we must create vk objects.
+
+	// The bindless set is shared by all pipelines, which is why any stage may access it.
+	std::array<vk::DescriptorSetLayoutBinding, 2> vk_bindings{};
+	vk_bindings[ 0 ]
+	    .setBinding( LE_BINDLESS_TEXTURE_BINDING )
+	    .setDescriptorType( vk::DescriptorType::eCombinedImageSampler )
+	    .setDescriptorCount( LE_BINDLESS_MAX_TEXTURES )
+	    .setStageFlags( vk::ShaderStageFlagBits::eAll );
+	vk_bindings[ 1 ]
+	    .setBinding( LE_BINDLESS_BUFFER_BINDING )
+	    .setDescriptorType( vk::DescriptorType::eStorageBuffer )
+	    .setDescriptorCount( LE_BINDLESS_MAX_BUFFERS )
+	    .setStageFlags( vk::ShaderStageFlagBits::eAll );
+
+	// Array elements which are not used by a draw need not hold valid descriptors, and
+	// update-after-bind gives us the much higher descriptor limits of update-after-bind pools.
+	std::array<vk::DescriptorBindingFlags, 2> binding_flags;
+	binding_flags.fill( vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind );
+
+	vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo;
+	bindingFlagsInfo
+	    .setBindingCount( uint32_t( binding_flags.size() ) )
+	    .setPBindingFlags( binding_flags.data() );
+
+	vk::DescriptorSetLayoutCreateInfo setLayoutInfo;
+	setLayoutInfo
+	    .setPNext( &bindingFlagsInfo )
+	    .setFlags( vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool )
+	    .setBindingCount( uint32_t( vk_bindings.size() ) )
+	    .setPBindings( vk_bindings.data() );
+
+	*layout = self->device.createDescriptorSetLayout( setLayoutInfo );
+
+	// Bindless sets are written by the backend, not via arguments - which is why this
+	// layout has no binding infos, and no update template.
+	le_descriptor_set_layout_t le_layout_info;
+	le_layout_info.vk_descriptor_set_layout      = *layout;
+	le_layout_info.vk_descriptor_update_template = nullptr;
+
+	bool result = descriptorSetLayouts.try_insert( LE_BINDLESS_SET_LAYOUT_KEY, &le_layout_info );
+
+	if ( false == result ) {
+		// Another thread inserted the layout while we were creating ours.
+		self->device.destroyDescriptorSetLayout( *layout );
+		*layout = descriptorSetLayouts.try_find( LE_BINDLESS_SET_LAYOUT_KEY )->vk_descriptor_set_layout;
+	}
+
+	return LE_BINDLESS_SET_LAYOUT_KEY;
+}
+
+// ----------------------------------------------------------------------
+// A set which contains any runtime-sized arrays gets laid out as the bindless set.
+static bool shader_bindings_are_bindless( std::vector<le_shader_binding_info> const &set_bindings ) {
+	for ( auto const &b : set_bindings ) {
+		if ( b.count == 0 ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------
+// Returns false if bindings declared in a bindless set don't match the bindless set layout,
+// or if bindless mode is not available.
+static bool shader_bindings_validate_bindless( le_pipeline_manager_o *self, std::vector<le_shader_binding_info> const &set_bindings ) {
+	using namespace le_backend_vk;
+
+	if ( !self->bindlessDescriptors ) {
+		std::cerr << "ERROR: Shader declares runtime-sized descriptor arrays in set " << std::dec << set_bindings.front().setIndex
+		          << ", but bindless mode is not enabled. Enable it via renderer settings." << std::endl
+		          << std::flush;
+		return false;
+	}
+
+	for ( auto const &b : set_bindings ) {
+		bool is_texture_array = b.binding == LE_BINDLESS_TEXTURE_BINDING && b.type == vk::DescriptorType::eCombinedImageSampler && b.count == 0;
+		bool is_buffer_array  = b.binding == LE_BINDLESS_BUFFER_BINDING && b.type == vk::DescriptorType::eStorageBufferDynamic && b.count == 0;
+
+		if ( !is_texture_array && !is_buffer_array ) {
+			std::cerr << "ERROR: Binding '" << le_get_argument_name_from_hash( b.name_hash ) << "' at set=" << std::dec << b.setIndex << ", binding=" << b.binding
+			          << " does not match bindless set layout: bindless sets may only hold a runtime-sized array of sampled textures at binding "
+			          << LE_BINDLESS_TEXTURE_BINDING << ", and a runtime-sized array of storage buffers at binding " << LE_BINDLESS_BUFFER_BINDING << "." << std::endl
+			          << std::flush;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Calculates pipeline layout info by first consolidating all bindings
+// over all referenced shader modules, and then ordering these by descriptor sets.
+//
+static le_pipeline_layout_info le_pipeline_cache_produce_pipeline_layout_info( le_pipeline_manager_o *self, le_shader_module_o const *const *shader_modules, size_t shader_modules_count ) {
+	le_pipeline_layout_info info{};
+
+	std::vector<le_shader_binding_info> combined_bindings = shader_modules_merge_bindings( shader_modules, shader_modules_count );
+
+	// -- Create array of DescriptorSetLayouts
+	std::array<vk::DescriptorSetLayout, 8> vkLayouts{};
+	{
+
+		// -- Create one vkDescriptorSetLayout for each set in bindings
+
+		std::vector<std::vector<le_shader_binding_info>> sets;
+
+		// Split combined bindings at set boundaries
+		uint32_t set_idx = 0;
+		for ( auto it = combined_bindings.begin(); it != combined_bindings.end(); ) {
+
+			// Find next element with different set id
+			auto itN = std::find_if( it, combined_bindings.end(), [ &set_idx ]( const le_shader_binding_info &el ) -> bool {
+				return el.setIndex != set_idx;
+			} );
 
 			sets.emplace_back( it, itN );
 
@@ -1679,6 +2516,10 @@ static le_pipeline_layout_info le_pipeline_cache_produce_pipeline_layout_info( l
 			// which combines various shader stages.
 			set_idx = 0;
 			for ( auto const &s : sets ) {
+				if ( shader_bindings_are_bindless( s ) ) {
+					set_idx++;
+					continue; // bindless sets may be sparse, their bindings get validated below.
+				}
 				uint32_t binding = 0;
 				for ( auto const &b : s ) {
 					assert( b.binding == binding );
@@ -1690,7 +2531,11 @@ static le_pipeline_layout_info le_pipeline_cache_produce_pipeline_layout_info( l
 		}
 
 		for ( size_t i = 0; i != sets.size(); ++i ) {
-			info.set_layout_keys[ i ] = le_pipeline_cache_produce_descriptor_set_layout( self, sets[ i ], &vkLayouts[ i ] );
+			if ( shader_bindings_are_bindless( sets[ i ] ) && shader_bindings_validate_bindless( self, sets[ i ] ) ) {
+				info.set_layout_keys[ i ] = le_pipeline_cache_produce_bindless_descriptor_set_layout( self, &vkLayouts[ i ] );
+			} else {
+				info.set_layout_keys[ i ] = le_pipeline_cache_produce_descriptor_set_layout( self, sets[ i ], &vkLayouts[ i ] );
+			}
 		}
 	}
 
@@ -1749,9 +2594,8 @@ static inline bool le_pipeline_manager_get_pipeline_layout_info(
 	} else {
 		// this will also create vulkan objects for pipeline layout / descriptor set layout and cache them
 		*pipeline_layout_info = le_pipeline_cache_produce_pipeline_layout_info( self, shader_modules, shader_modules_count );
-		// store in cache
-		bool result = self->pipelineLayoutInfos.try_insert( *pipeline_layout_hash, pipeline_layout_info );
-		assert( result && "pipeline layout info insertion must succeed" );
+		// store in cache - if another thread stored an identical info in the meantime, insertion fails, which is fine.
+		self->pipelineLayoutInfos.try_insert( *pipeline_layout_hash, pipeline_layout_info );
 	}
 
 	return result;
@@ -1759,15 +2603,479 @@ static inline bool le_pipeline_manager_get_pipeline_layout_info(
 
 // ----------------------------------------------------------------------
 
+// Called when another thread inserted a pipeline for pipeline_hash into the cache while we were
+// creating our own pipeline for the same hash: we destroy our pipeline, and return the cached one.
+static VkPipeline pipeline_cache_resolve_duplicate_pipeline( le_pipeline_manager_o *self, uint64_t pipeline_hash, VkPipeline duplicate ) {
+	self->device.destroyPipeline( duplicate );
+	auto p = self->pipelines.try_find( pipeline_hash );
+	assert( p && "pipeline must be in cache" );
+	return *p;
+}
+
+// ----------------------------------------------------------------------
+// Returns a renderpass which is compatible with `pass`, and which is owned by the pipeline manager.
+// Renderpasses held by a frame may be destroyed once the frame is recycled, but pipelines which
+// are created in the background may outlive the frame in which they were requested.
+static vk::RenderPass le_pipeline_manager_produce_compatible_renderpass( le_pipeline_manager_o *self, LeRenderPass const &pass ) {
+
+	auto p = self->compatibleRenderPasses.try_find( pass.renderpassHash );
+
+	if ( p ) {
+		return *p;
+	}
+
+	// ----------| invariant: no compatible renderpass in cache yet - we must create one.
+	//
+	// Only attachment formats, sample counts, and attachment references matter for renderpass
+	// compatibility, which is why we can use generic layouts, and no dependencies.
+
+	std::vector<vk::AttachmentDescription>   attachments;
+	std::vector<vk::AttachmentReference>     colorAttachmentReferences;
+	std::vector<vk::AttachmentReference>     resolveAttachmentReferences;
+	std::unique_ptr<vk::AttachmentReference> dsAttachmentReference;
+
+	auto const attachments_end = pass.attachments +
+	                             pass.numColorAttachments +
+	                             pass.numDepthStencilAttachments +
+	                             pass.numResolveAttachments;
+
+	for ( AttachmentInfo const *attachment = pass.attachments; attachment != attachments_end; attachment++ ) {
+
+		vk::ImageLayout layout = ( attachment->type == AttachmentInfo::Type::eDepthStencilAttachment )
+		                             ? vk::ImageLayout::eDepthStencilAttachmentOptimal
+		                             : vk::ImageLayout::eColorAttachmentOptimal;
+
+		vk::AttachmentDescription attachmentDescription{};
+		attachmentDescription
+		    .setFormat( attachment->format )
+		    .setSamples( attachment->numSamples )
+		    .setLoadOp( vk::AttachmentLoadOp::eDontCare )
+		    .setStoreOp( vk::AttachmentStoreOp::eDontCare )
+		    .setStencilLoadOp( vk::AttachmentLoadOp::eDontCare )
+		    .setStencilStoreOp( vk::AttachmentStoreOp::eDontCare )
+		    .setInitialLayout( vk::ImageLayout::eUndefined )
+		    .setFinalLayout( layout );
+
+		attachments.emplace_back( attachmentDescription );
+
+		switch ( attachment->type ) {
+		case AttachmentInfo::Type::eDepthStencilAttachment:
+			dsAttachmentReference = std::make_unique<vk::AttachmentReference>( attachments.size() - 1, layout );
+			break;
+		case AttachmentInfo::Type::eColorAttachment:
+			colorAttachmentReferences.emplace_back( attachments.size() - 1, layout );
+			break;
+		case AttachmentInfo::Type::eResolveAttachment:
+			resolveAttachmentReferences.emplace_back( attachments.size() - 1, layout );
+			break;
+		}
+	}
+
+	vk::SubpassDescription subpassDescription;
+	subpassDescription
+	    .setPipelineBindPoint( vk::PipelineBindPoint::eGraphics )
+	    .setColorAttachmentCount( uint32_t( colorAttachmentReferences.size() ) )
+	    .setPColorAttachments( colorAttachmentReferences.data() )
+	    .setPResolveAttachments( resolveAttachmentReferences.empty() ? nullptr : resolveAttachmentReferences.data() )
+	    .setPDepthStencilAttachment( dsAttachmentReference.get() );
+
+	vk::RenderPassCreateInfo renderpassCreateInfo;
+	renderpassCreateInfo
+	    .setAttachmentCount( uint32_t( attachments.size() ) )
+	    .setPAttachments( attachments.data() )
+	    .setSubpassCount( 1 )
+	    .setPSubpasses( &subpassDescription );
+
+	vk::RenderPass renderPass = self->device.createRenderPass( renderpassCreateInfo );
+
+	if ( false == self->compatibleRenderPasses.try_insert( pass.renderpassHash, &renderPass ) ) {
+		// Another thread inserted a compatible renderpass while we were creating ours - use theirs.
+		self->device.destroyRenderPass( renderPass );
+		renderPass = *self->compatibleRenderPasses.try_find( pass.renderpassHash );
+	}
+
+	return renderPass;
+}
+
+// ----------------------------------------------------------------------
+// Runs on a background thread: creates graphics pipelines in order of request, and
+// adds them to the pipeline cache, where produce_graphics_pipeline will find them.
+static void le_pipeline_manager_pipeline_worker( le_pipeline_manager_o *self ) {
+
+	for ( ;; ) {
+
+		le_pipeline_manager_o::GraphicsPipelineRequest request;
+
+		{
+			std::unique_lock lock( self->pipelineRequestsMtx );
+
+			self->pipelineRequestsCondition.wait( lock, [ self ] {
+				return self->pipelineWorkersShouldStop || !self->pipelineRequests.empty();
+			} );
+
+			if ( self->pipelineWorkersShouldStop ) {
+				return;
+			}
+
+			request = std::move( self->pipelineRequests.front() );
+			self->pipelineRequests.pop_front();
+		}
+
+		VkPipeline pipeline = nullptr;
+		{
+			// Shader modules must stay alive while we create a pipeline from them.
+			std::shared_lock shader_modules_lock( self->shaderModulesMtx );
+			pipeline = le_pipeline_cache_create_graphics_pipeline( self, request.pso, request.pass, request.subpass );
+		}
+
+		if ( false == self->pipelines.try_insert( request.pipeline_hash, &pipeline ) ) {
+			self->device.destroyPipeline( pipeline );
+		}
+
+		histogram_add_duration( self->pipelineRequestLatencyHistogram, request.t_requested );
+
+		{
+			std::scoped_lock lock( self->pipelineRequestsMtx );
+			self->pipelineRequestsPending.erase( request.pipeline_hash );
+		}
+
+		self->pipelineCreatedCondition.notify_all();
+
+		std::cout << "New VK Graphics Pipeline created: 0x" << std::hex << request.pipeline_hash << std::endl
+		          << std::flush;
+	}
+}
+
+// ----------------------------------------------------------------------
+// Queues up creation of a graphics pipeline on a background thread, unless this pipeline was already requested.
+static void le_pipeline_manager_request_graphics_pipeline( le_pipeline_manager_o *self, uint64_t pipeline_hash, graphics_pipeline_state_o const *pso, LeRenderPass const &pass, uint32_t subpass ) {
+
+	{
+		std::scoped_lock lock( self->pipelineRequestsMtx );
+		if ( false == self->pipelineRequestsPending.insert( pipeline_hash ).second ) {
+			return; // pipeline is already being created.
+		}
+	}
+
+	// ----------| invariant: this is the first request for this pipeline
+
+	le_pipeline_manager_o::GraphicsPipelineRequest request{};
+	request.pipeline_hash            = pipeline_hash;
+	request.pso                      = pso;
+	request.pass.numColorAttachments = pass.numColorAttachments;
+	request.pass.sampleCount         = pass.sampleCount;
+	request.pass.renderpassHash      = pass.renderpassHash;
+	request.pass.renderPass          = le_pipeline_manager_produce_compatible_renderpass( self, pass );
+	request.subpass                  = subpass;
+	request.t_requested              = std::chrono::high_resolution_clock::now();
+
+	{
+		std::scoped_lock lock( self->pipelineRequestsMtx );
+		self->pipelineRequests.emplace_back( std::move( request ) );
+	}
+
+	self->pipelineRequestsCondition.notify_one();
+}
+
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// Calculates a combined hash for pipeline, renderpass, and all contributing shader stages.
+static uint64_t graphics_pipeline_calculate_hash( le_gpso_handle gpso_handle, graphics_pipeline_state_o const *pso, uint64_t renderpass_hash, uint64_t pipeline_layout_hash ) {
+
+	uint64_t pso_renderpass_hash_data[ 12 ]       = {}; // we use a c-style array, with an entry count so that this is reliably allocated on the stack and not on the heap.
+	uint64_t pso_renderpass_hash_data_num_entries = 0;  // number of entries in pso_renderpass_hash_data
+
+	pso_renderpass_hash_data[ 0 ]        = reinterpret_cast<uint64_t>( gpso_handle ); // Hash associated with `pso`
+	pso_renderpass_hash_data[ 1 ]        = renderpass_hash;                           // Hash for *compatible* renderpass
+	pso_renderpass_hash_data_num_entries = 2;
+
+	for ( auto const &s : pso->shaderStages ) {
+		pso_renderpass_hash_data[ pso_renderpass_hash_data_num_entries++ ] = s->hash; // Module state - may have been recompiled, hash must be current
+	}
+
+	// -- create combined hash for pipeline, renderpass
+	return SpookyHash::Hash64( pso_renderpass_hash_data, sizeof( uint64_t ) * pso_renderpass_hash_data_num_entries, pipeline_layout_hash );
+}
+
+// ----------------------------------------------------------------------
+
+static constexpr char     LE_PIPELINE_MANIFEST_PATH[]  = "./local_resources/cache/pipeline_manifest.bin";
+static constexpr uint32_t LE_PIPELINE_MANIFEST_MAGIC   = 0x4d50454c; // 'LEPM', little endian
+static constexpr uint32_t LE_PIPELINE_MANIFEST_VERSION = 1;
+
+// Pipeline manifest files start with this header, followed by `num_entries` manifest entries.
+struct le_pipeline_manifest_file_header_t {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t num_entries;
+	uint64_t data_hash; // SpookyHash of all entries following this header
+};
+
+// ----------------------------------------------------------------------
+// Returns true if pipeline manifest data, including its header, is valid.
+static bool pipeline_manifest_data_is_valid( void const *file_data, size_t file_size ) {
+
+	if ( file_size < sizeof( le_pipeline_manifest_file_header_t ) ) {
+		return false;
+	}
+
+	le_pipeline_manifest_file_header_t header;
+	memcpy( &header, file_data, sizeof( header ) );
+
+	auto const *data = static_cast<char const *>( file_data ) + sizeof( header );
+
+	return header.magic == LE_PIPELINE_MANIFEST_MAGIC &&
+	       header.version == LE_PIPELINE_MANIFEST_VERSION &&
+	       header.num_entries * sizeof( le_pipeline_manifest_entry_t ) == file_size - sizeof( header ) &&
+	       header.data_hash == SpookyHash::Hash64( data, file_size - sizeof( header ), 0 );
+}
+
+// ----------------------------------------------------------------------
+// Loads manifest entries from file, so that pipelines can be warmed up as soon as their
+// pipeline state objects get introduced. Manifest file is memory-mapped.
+static void le_pipeline_manager_load_pipeline_manifest( le_pipeline_manager_o *self ) {
+
+	le_mapped_file_t file;
+
+	if ( !mapped_file_open( self->manifestPath, &file ) ) {
+		return;
+	}
+
+	if ( pipeline_manifest_data_is_valid( file.data, file.size ) ) {
+
+		size_t num_entries = ( file.size - sizeof( le_pipeline_manifest_file_header_t ) ) / sizeof( le_pipeline_manifest_entry_t );
+		auto   p_entry     = static_cast<char const *>( file.data ) + sizeof( le_pipeline_manifest_file_header_t );
+
+		std::scoped_lock lock( self->manifestMtx );
+
+		for ( size_t i = 0; i != num_entries; i++, p_entry += sizeof( le_pipeline_manifest_entry_t ) ) {
+			le_pipeline_manifest_entry_t entry;
+			memcpy( &entry, p_entry, sizeof( entry ) );
+			self->manifestLoaded.emplace( entry.gpso_handle, entry );
+		}
+
+		std::cout << "Loaded pipeline manifest: '" << self->manifestPath.string() << "' (" << std::dec << num_entries << " Pipelines)" << std::endl
+		          << std::flush;
+	} else {
+		std::cout << "WARNING: Discarding pipeline manifest: '" << self->manifestPath.string() << "' - manifest is corrupt, or outdated." << std::endl
+		          << std::flush;
+	}
+
+	mapped_file_close( &file );
+}
+
+// ----------------------------------------------------------------------
+// Records a pipeline into the manifest, so that it can be warmed up on next start.
+static void le_pipeline_manager_record_pipeline_manifest_entry( le_pipeline_manager_o *self, uint64_t pipeline_hash, le_gpso_handle gpso_handle, graphics_pipeline_state_o const *pso, LeRenderPass const &pass, uint32_t subpass ) {
+
+	if ( pso->shaderStages.size() > LE_PIPELINE_MANIFEST_MAX_SHADER_STAGES ) {
+		return;
+	}
+
+	{
+		std::scoped_lock lock( self->manifestMtx );
+		if ( self->manifestRecorded.count( pipeline_hash ) ) {
+			return; // already recorded
+		}
+	}
+
+	le_pipeline_manifest_entry_t entry{};
+
+	entry.gpso_handle                   = reinterpret_cast<uint64_t>( gpso_handle );
+	entry.renderpass_hash               = pass.renderpassHash;
+	entry.subpass                       = subpass;
+	entry.sample_count                  = uint32_t( pass.sampleCount );
+	entry.num_color_attachments         = pass.numColorAttachments;
+	entry.num_depth_stencil_attachments = pass.numDepthStencilAttachments;
+	entry.num_resolve_attachments       = pass.numResolveAttachments;
+	entry.num_shader_stages             = uint16_t( pso->shaderStages.size() );
+
+	for ( size_t i = 0; i != pso->shaderStages.size(); i++ ) {
+		entry.shader_module_hashes[ i ] = pso->shaderStages[ i ]->hash;
+	}
+
+	size_t num_attachments = size_t( pass.numColorAttachments ) + pass.numDepthStencilAttachments + pass.numResolveAttachments;
+
+	for ( size_t i = 0; i != num_attachments && i != VK_MAX_COLOR_ATTACHMENTS; i++ ) {
+		entry.attachments[ i ].format      = uint32_t( pass.attachments[ i ].format );
+		entry.attachments[ i ].num_samples = uint32_t( pass.attachments[ i ].numSamples );
+		entry.attachments[ i ].type        = uint32_t( pass.attachments[ i ].type );
+	}
+
+	std::scoped_lock lock( self->manifestMtx );
+	self->manifestRecorded.emplace( pipeline_hash, entry );
+	self->manifestDirty = true;
+}
+
+// ----------------------------------------------------------------------
+// Writes manifest to disk: all pipelines recorded during this session, plus any pipelines from
+// the previous manifest whose pipeline state objects were not used during this session.
+static bool le_pipeline_manager_save_pipeline_manifest( le_pipeline_manager_o *self ) {
+
+	std::vector<le_pipeline_manifest_entry_t> entries;
+
+	{
+		std::scoped_lock lock( self->manifestMtx );
+
+		if ( !self->manifestDirty || self->manifestPath.empty() ) {
+			return true; // nothing new to save
+		}
+
+		entries.reserve( self->manifestRecorded.size() + self->manifestLoaded.size() );
+
+		for ( auto const &e : self->manifestRecorded ) {
+			entries.push_back( e.second );
+		}
+
+		for ( auto const &e : self->manifestLoaded ) {
+			if ( nullptr == self->graphicsPso.try_find( reinterpret_cast<le_gpso_handle>( e.first ) ) ) {
+				entries.push_back( e.second );
+			}
+		}
+
+		self->manifestDirty = false;
+	}
+
+	le_pipeline_manifest_file_header_t header{};
+	header.magic       = LE_PIPELINE_MANIFEST_MAGIC;
+	header.version     = LE_PIPELINE_MANIFEST_VERSION;
+	header.num_entries = entries.size();
+	header.data_hash   = SpookyHash::Hash64( entries.data(), entries.size() * sizeof( le_pipeline_manifest_entry_t ), 0 );
+
+	std::error_code ec;
+	std::filesystem::create_directories( self->manifestPath.parent_path(), ec );
+
+	auto tmp_path = self->manifestPath;
+	tmp_path += ".tmp";
+
+	{
+		std::ofstream file( tmp_path, std::ios::out | std::ios::binary | std::ios::trunc );
+
+		if ( !file.is_open() ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not open file for writing: '" << tmp_path.string() << "'" << std::endl
+			          << std::flush;
+			return false;
+		}
+
+		file.write( reinterpret_cast<char const *>( &header ), sizeof( header ) );
+		file.write( reinterpret_cast<char const *>( entries.data() ), std::streamsize( entries.size() * sizeof( le_pipeline_manifest_entry_t ) ) );
+		file.close();
+
+		if ( file.fail() ) {
+			std::filesystem::remove( tmp_path, ec );
+			return false;
+		}
+	}
+
+	std::filesystem::rename( tmp_path, self->manifestPath, ec );
+
+	if ( ec ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not replace pipeline manifest file: " << ec.message() << std::endl
+		          << std::flush;
+		std::filesystem::remove( tmp_path, ec );
+		return false;
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Requests background creation for all pipelines which the manifest lists for this pso,
+// so that they are - ideally - available by the time the pso is first used.
+static void le_pipeline_manager_warm_up_graphics_pipeline_state( le_pipeline_manager_o *self, le_gpso_handle gpso_handle ) {
+
+	std::vector<le_pipeline_manifest_entry_t> entries;
+	{
+		std::scoped_lock lock( self->manifestMtx );
+		auto             range = self->manifestLoaded.equal_range( reinterpret_cast<uint64_t>( gpso_handle ) );
+		for ( auto it = range.first; it != range.second; it++ ) {
+			entries.push_back( it->second );
+		}
+	}
+
+	if ( entries.empty() ) {
+		return;
+	}
+
+	graphics_pipeline_state_o const *pso = self->graphicsPso.try_find( gpso_handle );
+	assert( pso );
+
+	for ( auto const &entry : entries ) {
+
+		// Shader modules must not have changed since this entry was recorded.
+		bool shader_stages_match = ( entry.num_shader_stages == pso->shaderStages.size() );
+
+		for ( size_t i = 0; shader_stages_match && i != pso->shaderStages.size(); i++ ) {
+			shader_stages_match = ( entry.shader_module_hashes[ i ] == pso->shaderStages[ i ]->hash );
+		}
+
+		size_t num_attachments = size_t( entry.num_color_attachments ) + entry.num_depth_stencil_attachments + entry.num_resolve_attachments;
+
+		if ( !shader_stages_match || num_attachments > VK_MAX_COLOR_ATTACHMENTS ) {
+			continue;
+		}
+
+		// ----------| invariant: manifest entry matches pso
+
+		LeRenderPass pass{};
+		pass.type                       = LE_RENDER_PASS_TYPE_DRAW;
+		pass.renderpassHash             = entry.renderpass_hash;
+		pass.sampleCount                = vk::SampleCountFlagBits( entry.sample_count );
+		pass.numColorAttachments        = entry.num_color_attachments;
+		pass.numDepthStencilAttachments = entry.num_depth_stencil_attachments;
+		pass.numResolveAttachments      = entry.num_resolve_attachments;
+
+		for ( size_t i = 0; i != num_attachments; i++ ) {
+			pass.attachments[ i ].format     = vk::Format( entry.attachments[ i ].format );
+			pass.attachments[ i ].numSamples = vk::SampleCountFlagBits( entry.attachments[ i ].num_samples );
+			pass.attachments[ i ].type       = AttachmentInfo::Type( entry.attachments[ i ].type );
+		}
+
+		le_pipeline_layout_info layout_info{};
+		uint64_t                pipeline_layout_hash{};
+		le_pipeline_manager_get_pipeline_layout_info( self, pso->shaderStages.data(), pso->shaderStages.size(), &layout_info, &pipeline_layout_hash );
+
+		uint64_t pipeline_hash = graphics_pipeline_calculate_hash( gpso_handle, pso, pass.renderpassHash, pipeline_layout_hash );
+
+		if ( nullptr == self->pipelines.try_find( pipeline_hash ) ) {
+			le_pipeline_manager_request_graphics_pipeline( self, pipeline_hash, pso, pass, entry.subpass );
+			self->pipelinesWarmedUp++;
+		}
+
+		// Keep this entry in the manifest - it is still valid.
+		le_pipeline_manager_record_pipeline_manifest_entry( self, pipeline_hash, gpso_handle, pso, pass, entry.subpass );
+	}
+}
+
+// ----------------------------------------------------------------------
+// Returns true if pipeline was being created in the background, after waiting for it to become available.
+static bool le_pipeline_manager_wait_for_pending_pipeline( le_pipeline_manager_o *self, uint64_t pipeline_hash ) {
+	std::unique_lock lock( self->pipelineRequestsMtx );
+
+	if ( 0 == self->pipelineRequestsPending.count( pipeline_hash ) ) {
+		return false;
+	}
+
+	self->pipelineCreatedCondition.wait( lock, [ self, pipeline_hash ] {
+		return self->pipelineWorkersShouldStop || 0 == self->pipelineRequestsPending.count( pipeline_hash );
+	} );
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
 /// \brief Creates - or loads a pipeline from cache - based on current pipeline state
 /// \note This method may lock the gpso/cpso cache and is therefore costly.
 //
 // + Only the 'command buffer recording'-slice of a frame shall be able to modify the cache.
 //   The cache must be exclusively accessed through this method
 //
-// + NOTE: Access to this method must be sequential - no two frames may access this method
-//   at the same time - and no two renderpasses may access this method at the same time.
-static le_pipeline_and_layout_info_t le_pipeline_manager_produce_graphics_pipeline( le_pipeline_manager_o *self, le_gpso_handle gpso_handle, const LeRenderPass &pass, uint32_t subpass ) {
+// + NOTE: This method may be called concurrently - renderpasses may be processed in parallel.
+//   Caches are internally synchronised, and if two threads happen to create the same object,
+//   only the first object makes it into the cache, and the second object gets destroyed.
+static le_pipeline_and_layout_info_t le_pipeline_manager_produce_graphics_pipeline_impl( le_pipeline_manager_o *self, le_gpso_handle gpso_handle, const LeRenderPass &pass, uint32_t subpass, bool allow_async ) {
 
 	le_pipeline_and_layout_info_t pipeline_and_layout_info = {};
 
@@ -1785,31 +3093,39 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_graphics_pipeli
 	// -- 2. get vk pipeline object
 	// we try to fetch it from the cache first, if it doesn't exist, we must create it, and add it to the cache.
 
-	uint64_t pipeline_hash = 0;
-	{
-		// Create a combined hash for pipeline, renderpass, and all contributing shader stages.
+	uint64_t pipeline_hash = graphics_pipeline_calculate_hash( gpso_handle, pso, pass.renderpassHash, pipeline_layout_hash );
 
-		uint64_t pso_renderpass_hash_data[ 12 ]       = {}; // we use a c-style array, with an entry count so that this is reliably allocated on the stack and not on the heap.
-		uint64_t pso_renderpass_hash_data_num_entries = 0;  // number of entries in pso_renderpass_hash_data
-
-		pso_renderpass_hash_data[ 0 ]        = reinterpret_cast<uint64_t>( gpso_handle ); // Hash associated with `pso`
-		pso_renderpass_hash_data[ 1 ]        = pass.renderpassHash;                       // Hash for *compatible* renderpass
-		pso_renderpass_hash_data_num_entries = 2;
-
-		for ( auto const &s : pso->shaderStages ) {
-			pso_renderpass_hash_data[ pso_renderpass_hash_data_num_entries++ ] = s->hash; // Module state - may have been recompiled, hash must be current
-		}
+	// -- look up if pipeline with this hash already exists in cache
+	auto p = self->pipelines.try_find( pipeline_hash );
 
-		// -- create combined hash for pipeline, renderpass
-		pipeline_hash = SpookyHash::Hash64( pso_renderpass_hash_data, sizeof( uint64_t ) * pso_renderpass_hash_data_num_entries, pipeline_layout_hash );
+	if ( !p && !allow_async && le_pipeline_manager_wait_for_pending_pipeline( self, pipeline_hash ) ) {
+		// Pipeline was being created in the background - because it was warmed up - and is now available.
+		p = self->pipelines.try_find( pipeline_hash );
 	}
 
-	// -- look up if pipeline with this hash already exists in cache
-	auto p = self->pipelines.try_find( pipeline_hash );
+	if ( !p ) {
+		// -- record pipeline into manifest, so that it can be warmed up next time
+		le_pipeline_manager_record_pipeline_manifest_entry( self, pipeline_hash, gpso_handle, pso, pass, subpass );
+	}
 
 	if ( p ) {
 		// pipeline exists
 		pipeline_and_layout_info.pipeline = *p;
+	} else if ( allow_async ) {
+		// -- if not, have pipeline created in the background, and use fallback pipeline - if any - in the meantime.
+		le_pipeline_manager_request_graphics_pipeline( self, pipeline_hash, pso, pass, subpass );
+
+		auto fallback = self->graphicsPsoFallbacks.try_find( reinterpret_cast<uint64_t>( gpso_handle ) );
+
+		if ( fallback ) {
+			self->fallbackPipelineRequests++;
+			// Fallback pipelines are created synchronously - they should be cheap to create, and are
+			// only ever created once.
+			return le_pipeline_manager_produce_graphics_pipeline_impl( self, *fallback, pass, subpass, false );
+		} else {
+			self->skippedPipelineRequests++;
+			pipeline_and_layout_info.pipeline = nullptr;
+		}
 	} else {
 		// -- if not, create pipeline in pipeline cache and store / retain it
 		pipeline_and_layout_info.pipeline = le_pipeline_cache_create_graphics_pipeline( self, pso, pass, subpass );
@@ -1817,22 +3133,30 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_graphics_pipeli
 		std::cout << "New VK Graphics Pipeline created: 0x" << std::hex << pipeline_hash << std::endl
 		          << std::flush;
 
-		bool result = self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline );
-
-		assert( result && " pipeline insertion must be successful " );
+		if ( false == self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline ) ) {
+			pipeline_and_layout_info.pipeline = pipeline_cache_resolve_duplicate_pipeline( self, pipeline_hash, pipeline_and_layout_info.pipeline );
+		}
 	}
 
 	return pipeline_and_layout_info;
 }
 
+// ----------------------------------------------------------------------
+// Returns a null pipeline if the pipeline is being created in the background, and there
+// is no fallback pipeline - in which case any draws using this pipeline must be skipped.
+static le_pipeline_and_layout_info_t le_pipeline_manager_produce_graphics_pipeline( le_pipeline_manager_o *self, le_gpso_handle gpso_handle, const LeRenderPass &pass, uint32_t subpass ) {
+	return le_pipeline_manager_produce_graphics_pipeline_impl( self, gpso_handle, pass, subpass, LE_PIPELINE_ASYNC );
+}
+
 /// \brief Creates - or loads a pipeline from cache - based on current pipeline state
 /// \note This method may lock the pso cache and is therefore costly.
 //
 // + Only the 'command buffer recording'-slice of a frame shall be able to modify the cache.
 //   The cache must be exclusively accessed through this method
 //
-// + NOTE: Access to this method must be sequential - no two frames may access this method
-//   at the same time - and no two renderpasses may access this method at the same time.
+// + NOTE: This method may be called concurrently - renderpasses may be processed in parallel.
+//   Caches are internally synchronised, and if two threads happen to create the same object,
+//   only the first object makes it into the cache, and the second object gets destroyed.
 static le_pipeline_and_layout_info_t le_pipeline_manager_produce_rtx_pipeline( le_pipeline_manager_o *self, le_rtxpso_handle pso_handle, char **maybe_shader_group_data ) {
 	le_pipeline_and_layout_info_t pipeline_and_layout_info = {};
 #ifdef LE_FEATURE_RTX
@@ -1886,9 +3210,9 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_rtx_pipeline( l
 		          << std::flush;
 
 		// Store pipeline in pipeline cache
-		bool result = self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline );
-
-		assert( result && "pipeline insertion must be successful" );
+		if ( false == self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline ) ) {
+			pipeline_and_layout_info.pipeline = pipeline_cache_resolve_duplicate_pipeline( self, pipeline_hash, pipeline_and_layout_info.pipeline );
+		}
 	}
 
 	if ( maybe_shader_group_data ) {
@@ -1929,7 +3253,11 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_rtx_pipeline( l
 			    0, uint32_t( pso->shaderGroups.size() ),
 			    dataSize, handles + sizeof( LeShaderGroupDataHeader ) );
 
-			self->rtx_shader_group_data.try_insert( pipeline_hash, &handles );
+			if ( false == self->rtx_shader_group_data.try_insert( pipeline_hash, &handles ) ) {
+				// Another thread stored shader group data for this pipeline in the meantime - use theirs.
+				free( handles );
+				handles = *self->rtx_shader_group_data.try_find( pipeline_hash );
+			}
 
 			// we need to store this buffer with the pipeline - or at least associate is to the pso
 
@@ -2002,8 +3330,9 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_compute_pipelin
 		std::cout << "New VK Compute Pipeline created: 0x" << std::hex << pipeline_hash << std::endl
 		          << std::flush;
 
-		bool result = self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline );
-		assert( result && "insertion must be successful" );
+		if ( false == self->pipelines.try_insert( pipeline_hash, &pipeline_and_layout_info.pipeline ) ) {
+			pipeline_and_layout_info.pipeline = pipeline_cache_resolve_duplicate_pipeline( self, pipeline_hash, pipeline_and_layout_info.pipeline );
+		}
 	}
 
 	return pipeline_and_layout_info;
@@ -2014,7 +3343,15 @@ static le_pipeline_and_layout_info_t le_pipeline_manager_produce_compute_pipelin
 // via RECORD in command buffer recording state
 // in SETUP
 bool le_pipeline_manager_introduce_graphics_pipeline_state( le_pipeline_manager_o *self, graphics_pipeline_state_o *pso, le_gpso_handle handle ) {
-	return self->graphicsPso.try_insert( handle, pso );
+
+	if ( false == self->graphicsPso.try_insert( handle, pso ) ) {
+		return false;
+	}
+
+	// -- start creating any pipelines which the manifest lists for this pso in the background.
+	le_pipeline_manager_warm_up_graphics_pipeline_state( self, handle );
+
+	return true;
 };
 
 // ----------------------------------------------------------------------
@@ -2055,19 +3392,133 @@ static le_shader_module_o *le_pipeline_manager_create_shader_module( le_pipeline
 
 // ----------------------------------------------------------------------
 
+static void le_pipeline_manager_create_shader_modules( le_pipeline_manager_o *self, char const *const *paths, LeShaderStageEnum const *moduleTypes, char const *const *macro_definitions, size_t num_modules, le_shader_module_o **modules ) {
+	le_shader_manager_create_shader_modules( self->shaderManager, paths, moduleTypes, macro_definitions, num_modules, modules );
+}
+
+// ----------------------------------------------------------------------
+
 static void le_pipeline_manager_update_shader_modules( le_pipeline_manager_o *self ) {
+	// Recompiled modules replace their vulkan shader modules - we must wait for any pipelines
+	// which are being created from these modules in the background.
+	std::unique_lock shader_modules_lock( self->shaderModulesMtx );
 	le_shader_manager_update_shader_modules( self->shaderManager );
 }
 
 // ----------------------------------------------------------------------
 
-static le_pipeline_manager_o *le_pipeline_manager_create( le_device_o *le_device ) {
-	auto self = new le_pipeline_manager_o();
+static void le_pipeline_manager_wait_for_pending_pipelines( le_pipeline_manager_o *self ) {
+	std::unique_lock lock( self->pipelineRequestsMtx );
+	self->pipelineCreatedCondition.wait( lock, [ self ] {
+		return self->pipelineWorkersShouldStop || self->pipelineRequestsPending.empty();
+	} );
+}
 
-	using namespace le_backend_vk;
-	self->le_device = le_device;
-	vk_device_i.increase_reference_count( le_device );
-	self->device = vk_device_i.get_vk_device( le_device );
+// ----------------------------------------------------------------------
+
+static bool le_pipeline_manager_set_graphics_pipeline_fallback( le_pipeline_manager_o *self, le_gpso_handle gpso_handle, le_gpso_handle fallback_handle ) {
+	assert( gpso_handle != fallback_handle && "pipeline cannot be its own fallback" );
+	return self->graphicsPsoFallbacks.try_insert( reinterpret_cast<uint64_t>( gpso_handle ), &fallback_handle );
+}
+
+// ----------------------------------------------------------------------
+
+static void le_pipeline_manager_get_pipeline_compile_stats( le_pipeline_manager_o *self, le_pipeline_compile_stats_t *stats ) {
+
+	for ( uint32_t i = 0; i != le_pipeline_compile_stats_t::NUM_HISTOGRAM_BUCKETS; i++ ) {
+		stats->creation_time_histogram[ i ]   = self->pipelineCreationTimeHistogram[ i ];
+		stats->request_latency_histogram[ i ] = self->pipelineRequestLatencyHistogram[ i ];
+	}
+
+	{
+		std::scoped_lock lock( self->pipelineRequestsMtx );
+		stats->num_pipelines_pending = self->pipelineRequestsPending.size();
+	}
+
+	stats->num_fallback_requests = self->fallbackPipelineRequests;
+	stats->num_skipped_requests  = self->skippedPipelineRequests;
+}
+
+// ----------------------------------------------------------------------
+
+static constexpr char     LE_PIPELINE_CACHE_PATH[]  = "./local_resources/cache/vk_pipeline_cache.bin";
+static constexpr uint32_t LE_PIPELINE_CACHE_MAGIC   = 0x4350454c; // 'LEPC', little endian
+static constexpr uint32_t LE_PIPELINE_CACHE_VERSION = 1;
+
+// Pipeline cache files start with this header, followed by `data_size` bytes of
+// data as returned by vkGetPipelineCacheData.
+struct le_pipeline_cache_file_header_t {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t vendor_id;                           // | must match physical device properties, otherwise
+	uint32_t device_id;                           // | cache gets discarded
+	uint32_t driver_version;                      // |
+	uint8_t  pipeline_cache_uuid[ VK_UUID_SIZE ]; // |
+	uint32_t padding;
+	uint64_t data_size; // number of bytes of cache data following this header
+	uint64_t data_hash; // SpookyHash of cache data following this header
+};
+
+// ----------------------------------------------------------------------
+// Returns true if pipeline cache data, including its header, is valid for the given device.
+static bool pipeline_cache_data_is_valid( void const *file_data, size_t file_size, VkPhysicalDeviceProperties const &props ) {
+
+	if ( file_size < sizeof( le_pipeline_cache_file_header_t ) ) {
+		return false;
+	}
+
+	le_pipeline_cache_file_header_t header;
+	memcpy( &header, file_data, sizeof( header ) );
+
+	if ( header.magic != LE_PIPELINE_CACHE_MAGIC ||
+	     header.version != LE_PIPELINE_CACHE_VERSION ||
+	     header.vendor_id != props.vendorID ||
+	     header.device_id != props.deviceID ||
+	     header.driver_version != props.driverVersion ||
+	     0 != memcmp( header.pipeline_cache_uuid, props.pipelineCacheUUID, VK_UUID_SIZE ) ||
+	     header.data_size != file_size - sizeof( header ) ) {
+		return false;
+	}
+
+	// ----------| invariant: our header matches device - now check vulkan's own header
+
+	auto const *data = static_cast<char const *>( file_data ) + sizeof( header );
+
+	if ( header.data_hash != SpookyHash::Hash64( data, header.data_size, 0 ) ) {
+		return false; // cache data is corrupt, or truncated
+	}
+
+	struct {
+		uint32_t header_size;
+		uint32_t header_version;
+		uint32_t vendor_id;
+		uint32_t device_id;
+		uint8_t  pipeline_cache_uuid[ VK_UUID_SIZE ];
+	} vk_header; // layout as in spec: "Layout for pipeline cache header version VK_PIPELINE_CACHE_HEADER_VERSION_ONE"
+
+	if ( header.data_size < sizeof( vk_header ) ) {
+		return false;
+	}
+
+	memcpy( &vk_header, data, sizeof( vk_header ) );
+
+	return vk_header.header_size >= sizeof( vk_header ) &&
+	       vk_header.header_version == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+	       vk_header.vendor_id == props.vendorID &&
+	       vk_header.device_id == props.deviceID &&
+	       0 == memcmp( vk_header.pipeline_cache_uuid, props.pipelineCacheUUID, VK_UUID_SIZE );
+}
+
+// ----------------------------------------------------------------------
+// Creates vulkan pipeline cache, seeded with data from pipeline cache file if the file
+// exists and holds valid data for the current device. Cache file is memory-mapped.
+static vk::PipelineCache pipeline_cache_create_from_file( vk::Device const &device, std::filesystem::path const &path, VkPhysicalDeviceProperties const &props ) {
+
+	le_mapped_file_t file;
+	mapped_file_open( path, &file );
+
+	void const *file_data = file.data;
+	size_t      file_size = file.size;
 
 	vk::PipelineCacheCreateInfo pipelineCacheInfo;
 	pipelineCacheInfo
@@ -2075,16 +3526,157 @@ static le_pipeline_manager_o *le_pipeline_manager_create( le_device_o *le_device
 	    .setInitialDataSize( 0 )
 	    .setPInitialData( nullptr );
 
-	self->vulkanCache   = self->device.createPipelineCache( pipelineCacheInfo );
-	self->shaderManager = le_shader_manager_create( self->device );
+	if ( file_data ) {
+		if ( pipeline_cache_data_is_valid( file_data, file_size, props ) ) {
+			pipelineCacheInfo
+			    .setInitialDataSize( file_size - sizeof( le_pipeline_cache_file_header_t ) )
+			    .setPInitialData( static_cast<char const *>( file_data ) + sizeof( le_pipeline_cache_file_header_t ) );
+			std::cout << "Loaded pipeline cache: '" << path.string() << "' (" << std::dec << pipelineCacheInfo.initialDataSize << " Bytes)" << std::endl
+			          << std::flush;
+		} else {
+			std::cout << "WARNING: Discarding pipeline cache: '" << path.string() << "' - cache does not match device, or is corrupt." << std::endl
+			          << std::flush;
+		}
+	}
+
+	auto pipelineCache = device.createPipelineCache( pipelineCacheInfo );
+
+	mapped_file_close( &file );
+
+	return pipelineCache;
+}
+
+// ----------------------------------------------------------------------
+// Writes vulkan pipeline cache to disk. We write to a temporary file first, which
+// we then rename, so that the cache file is replaced atomically - a crash while
+// writing can't leave us with a half-written cache file.
+static bool le_pipeline_manager_save_pipeline_cache( le_pipeline_manager_o *self ) {
+
+	le_pipeline_manager_save_pipeline_manifest( self );
+
+	if ( !self->vulkanCache || self->vulkanCachePath.empty() ) {
+		return false;
+	}
+
+	uint64_t num_new_pipelines = self->pipelinesCreatedSinceSave.exchange( 0 );
+
+	if ( num_new_pipelines == 0 ) {
+		return true; // nothing new to save
+	}
+
+	auto data = self->device.getPipelineCacheData( self->vulkanCache );
+
+	using namespace le_backend_vk;
+	VkPhysicalDeviceProperties const &props = vk_device_i.get_vk_physical_device_properties( self->le_device );
+
+	le_pipeline_cache_file_header_t header{};
+	header.magic          = LE_PIPELINE_CACHE_MAGIC;
+	header.version        = LE_PIPELINE_CACHE_VERSION;
+	header.vendor_id      = props.vendorID;
+	header.device_id      = props.deviceID;
+	header.driver_version = props.driverVersion;
+	header.data_size      = data.size();
+	header.data_hash      = SpookyHash::Hash64( data.data(), data.size(), 0 );
+	memcpy( header.pipeline_cache_uuid, props.pipelineCacheUUID, VK_UUID_SIZE );
+
+	std::error_code ec;
+	std::filesystem::create_directories( self->vulkanCachePath.parent_path(), ec );
+
+	auto tmp_path = self->vulkanCachePath;
+	tmp_path += ".tmp";
+
+	{
+		std::ofstream file( tmp_path, std::ios::out | std::ios::binary | std::ios::trunc );
+
+		if ( !file.is_open() ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not open file for writing: '" << tmp_path.string() << "'" << std::endl
+			          << std::flush;
+			self->pipelinesCreatedSinceSave += num_new_pipelines; // try again next time
+			return false;
+		}
+
+		file.write( reinterpret_cast<char const *>( &header ), sizeof( header ) );
+		file.write( reinterpret_cast<char const *>( data.data() ), std::streamsize( data.size() ) );
+		file.close();
+
+		if ( file.fail() ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not write file: '" << tmp_path.string() << "'" << std::endl
+			          << std::flush;
+			std::filesystem::remove( tmp_path, ec );
+			self->pipelinesCreatedSinceSave += num_new_pipelines;
+			return false;
+		}
+	}
+
+	std::filesystem::rename( tmp_path, self->vulkanCachePath, ec );
+
+	if ( ec ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not replace pipeline cache file: " << ec.message() << std::endl
+		          << std::flush;
+		std::filesystem::remove( tmp_path, ec );
+		self->pipelinesCreatedSinceSave += num_new_pipelines;
+		return false;
+	}
+
+	std::cout << "Saved pipeline cache: '" << self->vulkanCachePath.string() << "' (" << std::dec << data.size() << " Bytes)" << std::endl
+	          << std::flush;
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+static le_pipeline_manager_o *le_pipeline_manager_create( le_device_o *le_device, bool bindless_descriptors ) {
+	auto self = new le_pipeline_manager_o();
+
+	using namespace le_backend_vk;
+	self->le_device = le_device;
+	vk_device_i.increase_reference_count( le_device );
+	self->device              = vk_device_i.get_vk_device( le_device );
+	self->bindlessDescriptors = bindless_descriptors;
+
+	self->vulkanCachePath = LE_PIPELINE_CACHE_PATH;
+	self->vulkanCache     = pipeline_cache_create_from_file( self->device, self->vulkanCachePath, vk_device_i.get_vk_physical_device_properties( le_device ) );
+	self->shaderManager   = le_shader_manager_create( self->device );
+
+	self->manifestPath = LE_PIPELINE_MANIFEST_PATH;
+	le_pipeline_manager_load_pipeline_manifest( self );
+
+	// Background threads are used for asynchronous pipeline creation, and for warming
+	// up pipelines from the manifest.
+	for ( uint32_t i = 0; i != LE_PIPELINE_WORKER_COUNT; i++ ) {
+		self->pipelineWorkers.emplace_back( le_pipeline_manager_pipeline_worker, self );
+	}
 
 	return self;
 }
 
 // ----------------------------------------------------------------------
 
+static uint64_t le_pipeline_manager_produce_bindless_set_layout( le_pipeline_manager_o *self ) {
+	assert( self->bindlessDescriptors && "bindless set layout must only be requested if bindless mode is enabled" );
+	vk::DescriptorSetLayout layout;
+	return le_pipeline_cache_produce_bindless_descriptor_set_layout( self, &layout );
+}
+
+// ----------------------------------------------------------------------
+
 static void le_pipeline_manager_destroy( le_pipeline_manager_o *self ) {
 
+	// -- stop background pipeline creation - any requests which are still queued get dropped.
+	{
+		std::scoped_lock lock( self->pipelineRequestsMtx );
+		self->pipelineWorkersShouldStop = true;
+	}
+
+	self->pipelineRequestsCondition.notify_all();
+
+	for ( auto &w : self->pipelineWorkers ) {
+		w.join();
+	}
+
+	self->pipelineWorkers.clear();
+
 	le_shader_manager_destroy( self->shaderManager );
 	self->shaderManager = nullptr;
 
@@ -2132,15 +3724,43 @@ static void le_pipeline_manager_destroy( le_pipeline_manager_o *self ) {
 
 	self->pipelines.clear();
 
+	self->compatibleRenderPasses.iterator(
+	    []( vk::RenderPass *r, void *user_data ) {
+		    auto device = static_cast<vk::Device *>( user_data );
+		    device->destroyRenderPass( *r );
+	    },
+	    &self->device );
+
 	self->rtx_shader_group_data.iterator(
 	    []( char **p_buffer, void * ) {
 		    free( *p_buffer );
 	    },
 	    nullptr );
 
-	// Destroy Pipeline Cache
+	// Save, then destroy Pipeline Cache
+
+	std::cout << "Created " << std::dec << self->pipelinesCreated << " pipelines in "
+	          << double( self->pipelineCreationTimeNs ) / 1000000.0 << "ms" << std::endl
+	          << std::flush;
+
+	{
+		le_pipeline_compile_stats_t stats{};
+		le_pipeline_manager_get_pipeline_compile_stats( self, &stats );
+
+		std::cout << "Pipeline compile latency histogram (ms : created, requested):" << std::endl;
+		for ( uint32_t i = 0; i != le_pipeline_compile_stats_t::NUM_HISTOGRAM_BUCKETS; i++ ) {
+			std::cout << "  < " << std::setw( 5 ) << std::dec << ( 1u << i ) << " : "
+			          << std::setw( 6 ) << stats.creation_time_histogram[ i ] << ", "
+			          << std::setw( 6 ) << stats.request_latency_histogram[ i ] << std::endl;
+		}
+		std::cout << "Pipeline requests served with fallback: " << stats.num_fallback_requests
+		          << ", skipped: " << stats.num_skipped_requests
+		          << ", pipelines warmed up from manifest: " << self->pipelinesWarmedUp << std::endl
+		          << std::flush;
+	}
 
 	if ( self->vulkanCache ) {
+		le_pipeline_manager_save_pipeline_cache( self );
 		self->device.destroyPipelineCache( self->vulkanCache );
 	}
 
@@ -2162,12 +3782,18 @@ void register_le_pipeline_vk_api( void *api_ ) {
 		i.destroy = le_pipeline_manager_destroy;
 
 		i.create_shader_module              = le_pipeline_manager_create_shader_module;
+		i.create_shader_modules             = le_pipeline_manager_create_shader_modules;
 		i.update_shader_modules             = le_pipeline_manager_update_shader_modules;
+		i.save_pipeline_cache               = le_pipeline_manager_save_pipeline_cache;
+		i.set_graphics_pipeline_fallback    = le_pipeline_manager_set_graphics_pipeline_fallback;
+		i.get_pipeline_compile_stats        = le_pipeline_manager_get_pipeline_compile_stats;
+		i.wait_for_pending_pipelines        = le_pipeline_manager_wait_for_pending_pipelines;
 		i.introduce_graphics_pipeline_state = le_pipeline_manager_introduce_graphics_pipeline_state;
 		i.introduce_compute_pipeline_state  = le_pipeline_manager_introduce_compute_pipeline_state;
 		i.introduce_rtx_pipeline_state      = le_pipeline_manager_introduce_rtx_pipeline_state;
 		i.get_pipeline_layout               = le_pipeline_manager_get_pipeline_layout;
 		i.get_descriptor_set_layout         = le_pipeline_manager_get_descriptor_set_layout;
+		i.produce_bindless_set_layout       = le_pipeline_manager_produce_bindless_set_layout;
 		i.produce_graphics_pipeline         = le_pipeline_manager_produce_graphics_pipeline;
 		i.produce_rtx_pipeline              = le_pipeline_manager_produce_rtx_pipeline;
 		i.produce_compute_pipeline          = le_pipeline_manager_produce_compute_pipeline;
@@ -0,0 +1,38 @@
+#ifndef LE_STAGING_RING_H
+#define LE_STAGING_RING_H
+
+// Note: this header is internal to le_backend_vk - it lives in a header of its own so
+// that apps/benchmarks/staging_ring may exercise the same code as le_backend_vk.cpp.
+
+#include <stdint.h>
+#include <atomic>
+
+// Reserves `num_bytes` from a staging ring of `ring_capacity` bytes, whose next free byte
+// is at `ring_offset`. Any number of threads may reserve from the same ring concurrently.
+//
+// Returns true, and the offset of the reserved range in `*offset`, if the ring had space.
+// Returns false otherwise - in which case the ring is left untouched: a reservation which
+// does not fit consumes no ring space, and `ring_offset` never runs past `ring_capacity`.
+// This is what allows smaller reservations to still succeed after a larger one has failed.
+inline bool le_staging_ring_reserve( std::atomic<uint64_t> &ring_offset, uint64_t ring_capacity, uint64_t num_bytes, uint64_t *offset ) {
+
+	if ( num_bytes > ring_capacity ) {
+		return false;
+	}
+
+	// ----------| invariant: num_bytes <= ring_capacity, and ring_offset <= ring_capacity - sums can't overflow.
+
+	uint64_t current = ring_offset.load( std::memory_order_relaxed );
+
+	do {
+		if ( current + num_bytes > ring_capacity ) {
+			return false;
+		}
+	} while ( !ring_offset.compare_exchange_weak( current, current + num_bytes, std::memory_order_relaxed ) );
+
+	*offset = current;
+
+	return true;
+}
+
+#endif // LE_STAGING_RING_H
@@ -12,6 +12,9 @@
 #include <atomic>
 #include <algorithm>
 #include <string.h> // for memcpy
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
 
 #ifndef _WIN32
 #	include <sys/mman.h>
@@ -293,6 +296,64 @@ ISL_API_ATTR char const *le_get_argument_name_from_hash( uint64_t value ) {
 	return "<< Argument name could not be resolved. >>";
 }
 
+/* Provide storage for a lookup table for resource names - resource handles only
+ * store a hash of their name, so that they fit into 64 bits. Any resource handle
+ * created via LE_RESOURCE() will have its name placed in this table, unless
+ * LE_RESOURCE_NAME_REGISTRY is set to 0. Each call site of LE_RESOURCE() only
+ * registers a name the first time it sees it.
+ *
+ * Resource handles may be created from any thread, which is why access to this
+ * table is protected. Entries are never removed, so that names which we hand out
+ * stay valid - even if the module which created the handle gets reloaded.
+ *
+ */
+struct ResourceNameTable {
+	std::shared_mutex                         mtx;
+	std::unordered_map<uint64_t, std::string> names;
+};
+
+// Resource handles may be created during static initialisation, which is why
+// we must make sure the table exists before anyone accesses it.
+static ResourceNameTable &get_resource_names_table() {
+	static ResourceNameTable table{};
+	return table;
+}
+
+// ----------------------------------------------------------------------
+
+ISL_API_ATTR void le_update_resource_name_table( const char *name, uint64_t value ) {
+
+	auto &table = get_resource_names_table();
+
+	{
+		std::shared_lock lock( table.mtx );
+		if ( table.names.find( value ) != table.names.end() ) {
+			// Most common case: name has already been registered.
+			return;
+		}
+	}
+
+	std::unique_lock lock( table.mtx );
+	table.names.try_emplace( value, name );
+}
+
+// ----------------------------------------------------------------------
+
+ISL_API_ATTR char const *le_get_resource_name_from_hash( uint64_t value ) {
+
+	auto &table = get_resource_names_table();
+
+	std::shared_lock lock( table.mtx );
+
+	auto it = table.names.find( value );
+
+	if ( it == table.names.end() ) {
+		return "<< Resource name could not be resolved. >>";
+	}
+
+	return it->second.c_str();
+}
+
 // callback forwarding --------------------------------------------------
 
 #if !defined( NDEBUG ) && defined( __x86_64__ )
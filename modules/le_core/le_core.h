@@ -46,6 +46,8 @@ ISL_API_ATTR DLL_CORE_API bool  le_core_load_library_persistently( char const *l
 
 ISL_API_ATTR DLL_CORE_API void le_update_argument_name_table( const char *source, uint64_t value );
 ISL_API_ATTR DLL_CORE_API char const *le_get_argument_name_from_hash( uint64_t value );
+ISL_API_ATTR DLL_CORE_API void le_update_resource_name_table( const char *name, uint64_t value );
+ISL_API_ATTR DLL_CORE_API char const *le_get_resource_name_from_hash( uint64_t value );
 
 // ---------- utilities
 
@@ -69,6 +69,60 @@ struct le_rtx_pipeline_builder_o {
 	le_pipeline_manager_o *pipelineCache = nullptr;
 };
 
+// ----------------------------------------------------------------------
+// Sets value for specialization constant with given id, overwriting any previous value.
+// We keep entries sorted by constant id, and lay out data in the same order, so that
+// constants which were set in a different order still produce the same hash.
+static void specialization_constants_set( le_specialization_constants_t &constants, uint32_t constant_id, void const *value, uint32_t value_size ) {
+
+	std::vector<vk::SpecializationMapEntry> entries;
+	std::vector<uint8_t>                    data;
+
+	entries.reserve( constants.entries.size() + 1 );
+	data.reserve( constants.data.size() + value_size );
+
+	auto append = [ & ]( uint32_t id, void const *src, size_t src_size ) {
+		entries.emplace_back( id, uint32_t( data.size() ), src_size );
+		data.insert( data.end(), static_cast<uint8_t const *>( src ), static_cast<uint8_t const *>( src ) + src_size );
+	};
+
+	bool was_set = false;
+
+	for ( auto const &e : constants.entries ) {
+		if ( !was_set && constant_id <= e.constantID ) {
+			append( constant_id, value, value_size );
+			was_set = true;
+			if ( constant_id == e.constantID ) {
+				continue; // previous value gets replaced
+			}
+		}
+		append( e.constantID, constants.data.data() + e.offset, e.size );
+	}
+
+	if ( !was_set ) {
+		append( constant_id, value, value_size );
+	}
+
+	constants.entries = std::move( entries );
+	constants.data    = std::move( data );
+}
+
+// ----------------------------------------------------------------------
+// Mixes specialization constants, if any, into given hash value.
+static uint64_t specialization_constants_hash( le_specialization_constants_t const &constants, uint64_t hash_value ) {
+
+	if ( constants.entries.empty() ) {
+		return hash_value;
+	}
+
+	hash_value = SpookyHash::Hash64( constants.entries.data(), constants.entries.size() * sizeof( vk::SpecializationMapEntry ), hash_value );
+	hash_value = SpookyHash::Hash64( constants.data.data(), constants.data.size(), hash_value );
+
+	return hash_value;
+}
+
+// ----------------------------------------------------------------------
+
 static le_compute_pipeline_builder_o *le_compute_pipeline_builder_create( le_pipeline_manager_o *pipelineCache ) {
 	auto self           = new le_compute_pipeline_builder_o();
 	self->pipelineCache = pipelineCache;
@@ -102,6 +156,7 @@ static le_cpso_handle le_compute_pipeline_builder_build( le_compute_pipeline_bui
 	using namespace le_backend_vk;
 
 	uint64_t hash_value = le_shader_module_i.get_hash( self->obj->shaderStage );
+	hash_value          = specialization_constants_hash( self->obj->specializationConstants, hash_value );
 	pipeline_handle     = reinterpret_cast<le_cpso_handle>( hash_value );
 
 	// Introduce pipeline state object to manager so that it may be cached.
@@ -122,6 +177,12 @@ static void le_compute_pipeline_builder_set_shader_stage( le_compute_pipeline_bu
 
 // ----------------------------------------------------------------------
 
+static void le_compute_pipeline_builder_set_specialization_constant( le_compute_pipeline_builder_o *self, uint32_t constant_id, void const *value, uint32_t value_size ) {
+	specialization_constants_set( self->obj->specializationConstants, constant_id, value, value_size );
+}
+
+// ----------------------------------------------------------------------
+
 static le_rtx_pipeline_builder_o *le_rtx_pipeline_builder_create( le_pipeline_manager_o *pipelineCache ) {
 	auto self           = new le_rtx_pipeline_builder_o();
 	self->pipelineCache = pipelineCache;
@@ -491,6 +552,11 @@ static le_gpso_handle le_graphics_pipeline_builder_build( le_graphics_pipeline_b
 			                                 hash_value );
 		}
 
+		// -- If pipeline has specialization constants, these must be factored in with the hash,
+		//    so that pipelines which share shader modules, but differ in constants, are distinct.
+
+		hash_value = specialization_constants_hash( self->obj->specializationConstants, hash_value );
+
 		// Cast hash_value to a pipeline handle, so we can use the type system with it
 		// its value, of course, is still equivalent to hash_value.
 
@@ -540,6 +606,12 @@ static void le_graphics_pipeline_builder_add_shader_stage( le_graphics_pipeline_
 
 // ----------------------------------------------------------------------
 
+static void le_graphics_pipeline_builder_set_specialization_constant( le_graphics_pipeline_builder_o *self, uint32_t constant_id, void const *value, uint32_t value_size ) {
+	specialization_constants_set( self->obj->specializationConstants, constant_id, value, value_size );
+}
+
+// ----------------------------------------------------------------------
+
 static void input_assembly_state_set_primitive_restart_enable( le_graphics_pipeline_builder_o *self, uint32_t const &primitiveRestartEnable ) {
 	self->obj->data.inputAssemblyState.setPrimitiveRestartEnable( primitiveRestartEnable );
 }
@@ -836,6 +908,7 @@ LE_MODULE_REGISTER_IMPL( le_pipeline_builder, api ) {
 		i.set_vertex_input_binding_descriptions   = le_graphics_pipeline_builder_set_vertex_input_binding_descriptions;
 		i.set_multisample_info                    = le_graphics_pipeline_builder_set_multisample_info;
 		i.set_depth_stencil_info                  = le_graphics_pipeline_builder_set_depth_stencil_info;
+		i.set_specialization_constant             = le_graphics_pipeline_builder_set_specialization_constant;
 
 		i.attribute_binding_state_i.add_binding                 = le_graphics_pipeline_builder_add_binding;
 		i.attribute_binding_state_i.set_binding_input_rate      = le_graphics_pipeline_builder_set_binding_input_rate;
@@ -905,11 +978,12 @@ LE_MODULE_REGISTER_IMPL( le_pipeline_builder, api ) {
 
 	{
 		// setup compute pipleine builder api
-		auto &i            = static_cast<le_pipeline_builder_api *>( api )->le_compute_pipeline_builder_i;
-		i.create           = le_compute_pipeline_builder_create;
-		i.destroy          = le_compute_pipeline_builder_destroy;
-		i.build            = le_compute_pipeline_builder_build;
-		i.set_shader_stage = le_compute_pipeline_builder_set_shader_stage;
+		auto &i                       = static_cast<le_pipeline_builder_api *>( api )->le_compute_pipeline_builder_i;
+		i.create                      = le_compute_pipeline_builder_create;
+		i.destroy                     = le_compute_pipeline_builder_destroy;
+		i.build                       = le_compute_pipeline_builder_build;
+		i.set_shader_stage            = le_compute_pipeline_builder_set_shader_stage;
+		i.set_specialization_constant = le_compute_pipeline_builder_set_specialization_constant;
 	}
 
 	{
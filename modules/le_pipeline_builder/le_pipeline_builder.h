@@ -54,6 +54,9 @@ struct le_pipeline_builder_api {
 		void     ( * set_multisample_info                    ) ( le_graphics_pipeline_builder_o *self, const VkPipelineMultisampleStateCreateInfo &multisampleInfo );
 		void     ( * set_depth_stencil_info                  ) ( le_graphics_pipeline_builder_o *self, const VkPipelineDepthStencilStateCreateInfo &depthStencilInfo );
 
+		// Specialization constants apply to all shader stages - value_size must match size of constant in shader (4, or 8 bytes).
+		void     ( * set_specialization_constant             ) ( le_graphics_pipeline_builder_o *self, uint32_t constant_id, void const *value, uint32_t value_size );
+
 		le_gpso_handle_t* ( * build             ) ( le_graphics_pipeline_builder_o* self );
 
 		struct attribute_binding_state_t{
@@ -151,6 +154,8 @@ struct le_pipeline_builder_api {
 		void                            ( * destroy          ) ( le_compute_pipeline_builder_o* self );
 		void                            ( * set_shader_stage ) ( le_compute_pipeline_builder_o* self,  le_shader_module_o* shaderStage);
 		le_cpso_handle_t*               ( * build            ) ( le_compute_pipeline_builder_o* self );
+
+		void ( * set_specialization_constant ) ( le_compute_pipeline_builder_o *self, uint32_t constant_id, void const *value, uint32_t value_size );
 	};
 
 	le_compute_pipeline_builder_interface_t le_compute_pipeline_builder_i;
@@ -210,6 +215,14 @@ class LeComputePipelineBuilder : NoCopy, NoMove {
 		le_pipeline_builder::le_compute_pipeline_builder_i.set_shader_stage( self, shaderModule );
 		return *this;
 	}
+
+	// Note: use uint32_t for boolean constants, as these are 32 bit in SPIR-V.
+	template <typename T>
+	LeComputePipelineBuilder &setSpecializationConstant( uint32_t constant_id, T const &value ) {
+		static_assert( sizeof( T ) == 4 || sizeof( T ) == 8, "specialization constants must be 32 or 64 bit of size." );
+		le_pipeline_builder::le_compute_pipeline_builder_i.set_specialization_constant( self, constant_id, &value, uint32_t( sizeof( T ) ) );
+		return *this;
+	}
 };
 
 // ----------------------------------------------------------------------
@@ -836,6 +849,14 @@ class LeGraphicsPipelineBuilder : NoCopy, NoMove {
 		return *this;
 	}
 
+	// Note: use uint32_t for boolean constants, as these are 32 bit in SPIR-V.
+	template <typename T>
+	LeGraphicsPipelineBuilder &setSpecializationConstant( uint32_t constant_id, T const &value ) {
+		static_assert( sizeof( T ) == 4 || sizeof( T ) == 8, "specialization constants must be 32 or 64 bit of size." );
+		le_pipeline_builder::le_graphics_pipeline_builder_i.set_specialization_constant( self, constant_id, &value, uint32_t( sizeof( T ) ) );
+		return *this;
+	}
+
 	AttributeBindingState &withAttributeBindingState() {
 		return mAttributeBindingState;
 	}
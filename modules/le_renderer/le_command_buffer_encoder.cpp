@@ -5,7 +5,10 @@
 
 #include "le_backend_vk/le_backend_vk.h" // for GPU allocators
 
+#include "3rdparty/src/spooky/SpookyV2.h" // for hashing argument data
+
 #include <cstring>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <assert.h>
@@ -43,9 +46,129 @@ static inline le_allocator_o *fetch_allocator( le_allocator_o **ppAlloc ) {
 	return result;
 }
 
+// ----------------------------------------------------------------------
+// Commands are recorded into a linked list of chunks, which are drawn from -
+// and returned to - a chunk pool which is owned by the rendergraph of the
+// current frame.
+//
+// A command never straddles a chunk boundary: if a command does not fit into
+// the current chunk, we place a CommandNextChunk into the space which each
+// chunk keeps in reserve at its end, and continue recording into a fresh chunk.
+//
+// Chunks never move in memory, which means that pointers into command payloads
+// (see bind_vertex_buffers) stay valid for the lifetime of the encoder.
+
+constexpr size_t LE_COMMAND_STREAM_CHUNK_SIZE = 1 << 16; // 64KB
+
+struct alignas( 16 ) le_command_stream_chunk_t {
+	le_command_stream_chunk_t *next;     // next chunk in command stream, or next free chunk if chunk sits in pool
+	size_t                     capacity; // number of bytes available for commands, not counting reserve for CommandNextChunk
+	size_t                     size;     // number of bytes used by commands
+
+	char *data() {
+		return reinterpret_cast<char *>( this + 1 );
+	}
+};
+
+// Remembers where argument data was placed in transient memory during the current
+// frame, so that identical argument data may share one allocation.
+//
+// The cache has a fixed number of entries, and entries are addressed by the hash
+// of their data. Entries are never removed individually - they become stale once
+// the pool which owns the cache gets reset. Once the cache is full, new entries
+// replace existing entries.
+
+constexpr size_t LE_ARGUMENT_DATA_CACHE_SIZE        = 1024; // must be a power of two
+constexpr size_t LE_ARGUMENT_DATA_CACHE_PROBE_COUNT = 8;    // max number of entries to look at for each lookup
+
+struct le_argument_data_cache_entry_t {
+	uint64_t             hash;
+	uint64_t             generation; // entry is only valid if this matches the generation of the cache
+	le_allocator_o *     allocator;  // allocator which holds the data
+	le_resource_handle_t buffer;     // buffer which backs allocator
+	uint64_t             offset;     // offset into buffer
+	uint64_t             num_bytes;
+	void const *         mem_addr;   // cpu-visible address of data
+};
+
+static_assert( ( LE_ARGUMENT_DATA_CACHE_SIZE & ( LE_ARGUMENT_DATA_CACHE_SIZE - 1 ) ) == 0, "argument data cache size must be a power of two" );
+
+// Pools encoders and command stream chunks for one frame, so that we don't
+// have to allocate encoders (or their command streams) from the heap on
+// every frame.
+//
+// Encoders acquired from the pool are owned by the pool, and remain valid
+// until the pool is reset. Resetting the pool is O(1): encoders keep their
+// chunks and shader binding tables, and reset themselves lazily when they
+// get re-acquired.
+struct le_command_buffer_encoder_pool_o {
+	le_command_stream_chunk_t *                free_list                      = nullptr; // singly-linked list of available chunks
+	size_t                                     chunks_allocated               = 0;       // total number of pooled chunks, including chunks in use
+	std::vector<le_command_buffer_encoder_o *> encoders;                                 // owning
+	size_t                                     encoders_in_use                = 0;       // encoders[0..encoders_in_use) are in use for the current frame
+	uint64_t                                   heap_allocation_count          = 0;       // running count of heap allocations made by pool, and by encoders from this pool
+	uint64_t                                   argument_data_cache_generation = 1;       // bumped on reset, which invalidates all cache entries at once
+	le_argument_data_cache_entry_t             argument_data_cache[ LE_ARGUMENT_DATA_CACHE_SIZE ];
+};
+
+// ----------------------------------------------------------------------
+// Returns a chunk which can hold at least num_bytes of commands.
+//
+// Commands which are larger than the default chunk size receive their own, dedicated
+// chunk - dedicated chunks are not pooled, they get freed once they are released.
+static le_command_stream_chunk_t *chunk_pool_acquire( le_command_buffer_encoder_pool_o *self, size_t num_bytes ) {
+
+	le_command_stream_chunk_t *chunk = nullptr;
+
+	if ( num_bytes <= LE_COMMAND_STREAM_CHUNK_SIZE && self && self->free_list ) {
+		chunk           = self->free_list;
+		self->free_list = chunk->next;
+	} else {
+		size_t capacity = std::max( num_bytes, LE_COMMAND_STREAM_CHUNK_SIZE );
+		chunk           = static_cast<le_command_stream_chunk_t *>( malloc( sizeof( le_command_stream_chunk_t ) + capacity + sizeof( le::CommandNextChunk ) ) );
+
+		if ( chunk == nullptr ) {
+			return nullptr;
+		}
+
+		chunk->capacity = capacity;
+
+		if ( self ) {
+			self->heap_allocation_count++;
+			if ( capacity == LE_COMMAND_STREAM_CHUNK_SIZE ) {
+				self->chunks_allocated++;
+			}
+		}
+	}
+
+	chunk->next = nullptr;
+	chunk->size = 0;
+
+	return chunk;
+}
+
+// ----------------------------------------------------------------------
+// Returns a list of chunks to the pool.
+static void chunk_pool_release( le_command_buffer_encoder_pool_o *self, le_command_stream_chunk_t *chunk ) {
+	while ( chunk ) {
+		auto next = chunk->next;
+
+		if ( self && chunk->capacity == LE_COMMAND_STREAM_CHUNK_SIZE ) {
+			chunk->next     = self->free_list;
+			self->free_list = chunk;
+		} else {
+			free( chunk );
+		}
+
+		chunk = next;
+	}
+}
+
 // ----------------------------------------------------------------------
 
-#define EMPLACE_CMD( x ) new ( &self->mCommandStream[ 0 ] + self->mCommandStreamSize )( x )
+// Both macros evaluate to nullptr if the command could not be reserved - callers must then drop the command.
+#define EMPLACE_CMD( x ) cbe_emplace_cmd<x>( self, 0 )
+#define EMPLACE_CMD_WITH_PAYLOAD( x, payload_size ) cbe_emplace_cmd<x>( self, ( payload_size ) )
 
 // ----------------------------------------------------------------------
 
@@ -72,27 +195,218 @@ struct le_shader_binding_table_o {
 	shader_record *last_shader_record = nullptr;
 };
 
+// ----------------------------------------------------------------------
+// Mirrors state which has been recorded into the command stream, so that
+// we may drop commands which would not change state in the backend.
+//
+// Only a limited amount of state is tracked - anything which does not fit
+// is recorded as before, without filtering.
+
+constexpr size_t LE_ENCODER_MAX_TRACKED_VIEWPORTS       = 4; // applies to viewports and scissors
+constexpr size_t LE_ENCODER_MAX_TRACKED_VERTEX_BINDINGS = 16;
+constexpr size_t LE_ENCODER_MAX_TRACKED_ARGUMENTS       = 16;
+
+struct le_encoder_bound_state_t {
+
+	struct argument_t {
+		uint64_t             name;      // hash id of argument name
+		le_resource_handle_t buffer;    // buffer bound to this argument
+		uint64_t             offset;    // offset into buffer
+		uint64_t             range;     // number of bytes bound
+		void const *         mem_addr;  // cpu-visible address of data, if data was set via set_argument_data, otherwise nullptr
+	};
+
+	le_gpso_handle gpso = nullptr; // currently bound graphics pipeline
+
+	uint32_t     viewport_first = 0;
+	uint32_t     viewport_count = 0; // 0 means: viewport state unknown
+	le::Viewport viewports[ LE_ENCODER_MAX_TRACKED_VIEWPORTS ];
+
+	uint32_t   scissor_first = 0;
+	uint32_t   scissor_count = 0; // 0 means: scissor state unknown
+	le::Rect2D scissors[ LE_ENCODER_MAX_TRACKED_VIEWPORTS ];
+
+	uint32_t             vertex_bindings_mask = 0; // one bit per tracked vertex binding which holds a valid buffer
+	le_resource_handle_t vertex_buffers[ LE_ENCODER_MAX_TRACKED_VERTEX_BINDINGS ];
+	uint64_t             vertex_offsets[ LE_ENCODER_MAX_TRACKED_VERTEX_BINDINGS ];
+
+	bool                 has_index_buffer = false;
+	le_resource_handle_t index_buffer;
+	uint64_t             index_offset;
+	le::IndexType        index_type;
+
+	argument_t arguments[ LE_ENCODER_MAX_TRACKED_ARGUMENTS ];
+	uint32_t   arguments_count = 0;
+	uint32_t   arguments_evict = 0; // index of argument to evict next, once arguments are full
+};
+
+static_assert( LE_ENCODER_MAX_TRACKED_VERTEX_BINDINGS <= 32, "vertex bindings mask must have one bit per tracked vertex binding" );
+
+// ----------------------------------------------------------------------
+// While an encoder records into a draw list, commands are captured into a side buffer,
+// grouped into items - one item per sort key. When the draw list ends, items are sorted
+// by their key, and their commands are replayed into the command stream in sorted order.
+
+struct le_draw_list_item_t {
+	uint64_t sort_key;
+	size_t   offset; // byte offset of first command of this item, relative to start of draw list data
+	size_t   size;   // number of bytes used by commands of this item
+};
+
 // ----------------------------------------------------------------------
 
 struct le_command_buffer_encoder_o {
-	char                                     mCommandStream[ 4096 * 512 ]; // 512 pages of memory = 2MB
-	size_t                                   mCommandStreamSize = 0;
+	le_command_stream_chunk_t *              mFirstChunk        = nullptr; // first chunk in command stream
+	le_command_stream_chunk_t *              mCurrentChunk      = nullptr; // chunk into which we currently record
+	size_t                                   mCommandStreamSize = 0;       // total number of bytes used by commands, over all chunks
 	size_t                                   mCommandCount      = 0;
+	le_command_buffer_encoder_pool_o *       pool               = nullptr; // Borrowed from rendergraph - source for command stream chunks
+	bool                                     isOwnedByPool      = false;   // true if encoder was acquired from pool, in which case pool owns encoder
 	le_allocator_o **                        ppAllocator        = nullptr; // allocator list is owned by backend, externally
 	le_pipeline_manager_o *                  pipelineManager    = nullptr;
 	le_staging_allocator_o *                 stagingAllocator   = nullptr; // Borrowed from backend - used for larger, permanent resources, shared amongst encoders
 	le::Extent2D                             extent             = {};      // Renderpass extent, otherwise swapchain extent inferred via renderer, this may be queried by users of encoder.
 	std::vector<le_shader_binding_table_o *> shader_binding_tables;        // owning
+	size_t                                   shaderBindingTablesInUse = 0; // shader_binding_tables[0..shaderBindingTablesInUse) are in use, the rest is kept for re-use
+	le_encoder_bound_state_t                 boundState;                   // state as seen by the backend, used to filter redundant commands
+	size_t                                   mElidedCommandCount = 0;      // number of redundant commands which were not recorded
+	size_t                                   mArgumentBytesSaved = 0;      // number of argument data bytes which did not need to be written to transient memory
+
+	bool                                     isRecordingDrawList          = false;
+	le_encoder_bound_state_t                 drawListSavedState;                     // bound state at the time when draw list began
+	std::vector<char>                        drawListData;                           // captured commands - size() is used as capacity, kept for re-use
+	size_t                                   drawListDataSize             = 0;       // number of bytes in use in drawListData
+	std::vector<le_draw_list_item_t>         drawListItems;                          // kept for re-use
+	std::vector<le_draw_list_item_t>         drawListItemsScratch;                   // used for sorting, kept for re-use
+	void *                                   drawListLastDraw             = nullptr; // last draw replayed into command stream - candidate for merging
+	size_t                                   drawListLastDrawCommandCount = 0;       // command count right after drawListLastDraw was recorded
 };
 
 // ----------------------------------------------------------------------
 
-static le_command_buffer_encoder_o *cbe_create( le_allocator_o **allocator, le_pipeline_manager_o *pipelineManager, le_staging_allocator_o *stagingAllocator, le::Extent2D const &extent = {} ) {
-	auto self              = new le_command_buffer_encoder_o;
-	self->ppAllocator      = allocator;
-	self->pipelineManager  = pipelineManager;
-	self->stagingAllocator = stagingAllocator;
-	self->extent           = extent;
+// Returns address at which a command of num_bytes (including its payload) may be placed.
+//
+// Note that this does not advance the command stream: a command only becomes part of the
+// stream once it has been committed via cbe_commit_cmd. A command which is reserved, but
+// not committed, will be overwritten by the next command.
+//
+// Returns nullptr if memory for the command could not be allocated.
+static void *cbe_reserve_cmd( le_command_buffer_encoder_o *self, size_t num_bytes ) {
+
+	if ( self->isRecordingDrawList ) {
+
+		auto &data = self->drawListData;
+
+		if ( self->drawListDataSize + num_bytes > data.size() ) {
+			// Note that growing the draw list invalidates pointers into it - this is
+			// why we must not rely on pointers into captured command payloads.
+			data.resize( std::max( data.size() * 2, self->drawListDataSize + num_bytes + 4096 ) );
+			if ( self->pool ) {
+				self->pool->heap_allocation_count++;
+			}
+		}
+
+		return data.data() + self->drawListDataSize;
+	}
+
+	// ---------| invariant: we record directly into the command stream
+
+	auto chunk = self->mCurrentChunk;
+
+	if ( chunk && chunk->size + num_bytes <= chunk->capacity ) {
+		return chunk->data() + chunk->size;
+	}
+
+	// ---------| invariant: command does not fit into current chunk
+
+	// If this encoder has been re-used, it may still hold on to chunks from
+	// a previous frame - we want to use these first.
+	auto next_chunk = chunk ? chunk->next : nullptr;
+
+	if ( next_chunk && num_bytes <= next_chunk->capacity ) {
+		next_chunk->size = 0;
+	} else {
+		auto fresh_chunk = chunk_pool_acquire( self->pool, num_bytes );
+
+		if ( fresh_chunk == nullptr ) {
+			std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not allocate command stream chunk for " << num_bytes << " Bytes - dropping command." << std::endl
+			          << std::flush;
+			return nullptr;
+		}
+
+		fresh_chunk->next = next_chunk; // keep any remaining chunks linked
+		next_chunk        = fresh_chunk;
+	}
+
+	if ( chunk ) {
+		// Link current chunk to next chunk - there is always space for this command at the end of a chunk.
+		auto cmd             = new ( chunk->data() + chunk->size ) le::CommandNextChunk;
+		cmd->info.next_chunk = next_chunk->data();
+		chunk->next          = next_chunk;
+	} else {
+		self->mFirstChunk = next_chunk;
+	}
+
+	self->mCurrentChunk = next_chunk;
+
+	return next_chunk->data();
+}
+
+// ----------------------------------------------------------------------
+// Reserves space for a command of type T followed by `payload_size` bytes, and constructs
+// the command in place. Returns nullptr if space could not be reserved.
+template <typename T>
+static inline T *cbe_emplace_cmd( le_command_buffer_encoder_o *self, size_t payload_size ) {
+	void *mem = cbe_reserve_cmd( self, sizeof( T ) + payload_size );
+	return mem ? new ( mem ) T : nullptr;
+}
+
+// ----------------------------------------------------------------------
+// Adds the most recently reserved command to the command stream.
+static inline void cbe_commit_cmd( le_command_buffer_encoder_o *self, size_t num_bytes ) {
+
+	if ( self->isRecordingDrawList ) {
+		assert( self->drawListDataSize + num_bytes <= self->drawListData.size() && "command must have been reserved" );
+		self->drawListDataSize += num_bytes;
+		self->drawListItems.back().size += num_bytes;
+		return;
+	}
+
+	assert( self->mCurrentChunk && self->mCurrentChunk->size + num_bytes <= self->mCurrentChunk->capacity && "command must have been reserved" );
+	self->mCurrentChunk->size += num_bytes;
+	self->mCommandStreamSize += num_bytes;
+	self->mCommandCount++;
+}
+
+// ----------------------------------------------------------------------
+// Puts encoder into its initial state, without releasing any memory it holds on to.
+static void cbe_reset( le_command_buffer_encoder_o *self, le_allocator_o **allocator, le_pipeline_manager_o *pipelineManager, le_staging_allocator_o *stagingAllocator, le::Extent2D const &extent ) {
+	self->mCurrentChunk = self->mFirstChunk;
+	if ( self->mCurrentChunk ) {
+		self->mCurrentChunk->size = 0;
+	}
+	self->mCommandStreamSize       = 0;
+	self->mCommandCount            = 0;
+	self->shaderBindingTablesInUse = 0;
+	self->boundState               = {};
+	self->mElidedCommandCount      = 0;
+	self->mArgumentBytesSaved      = 0;
+	self->isRecordingDrawList      = false;
+	self->drawListDataSize         = 0;
+	self->drawListLastDraw         = nullptr;
+	self->drawListItems.clear(); // keeps capacity
+	self->ppAllocator              = allocator;
+	self->pipelineManager          = pipelineManager;
+	self->stagingAllocator         = stagingAllocator;
+	self->extent                   = extent;
+}
+
+// ----------------------------------------------------------------------
+
+static le_command_buffer_encoder_o *cbe_create( le_command_buffer_encoder_pool_o *pool, le_allocator_o **allocator, le_pipeline_manager_o *pipelineManager, le_staging_allocator_o *stagingAllocator, le::Extent2D const &extent = {} ) {
+	auto self  = new le_command_buffer_encoder_o;
+	self->pool = pool;
+	cbe_reset( self, allocator, pipelineManager, stagingAllocator, extent );
 	//	std::cout << "encoder create : " << std::hex << self << std::endl
 	//	          << std::flush;
 	return self;
@@ -104,13 +418,86 @@ static void cbe_destroy( le_command_buffer_encoder_o *self ) {
 	//	std::cout << "encoder destroy: " << std::hex << self << std::endl
 	//	          << std::flush;
 
+	assert( !self->isOwnedByPool && "encoders acquired from a pool must not be destroyed - they are owned by the pool" );
+
 	for ( auto sbt : self->shader_binding_tables ) {
 		delete ( sbt );
 	}
 
+	chunk_pool_release( self->pool, self->mFirstChunk );
+
 	delete ( self );
 }
 
+// ----------------------------------------------------------------------
+
+static le_command_buffer_encoder_pool_o *encoder_pool_create() {
+	auto self = new le_command_buffer_encoder_pool_o{};
+	return self;
+}
+
+// ----------------------------------------------------------------------
+
+static void encoder_pool_destroy( le_command_buffer_encoder_pool_o *self ) {
+
+	for ( auto e : self->encoders ) {
+		e->isOwnedByPool = false;
+		cbe_destroy( e ); // returns chunks to free list
+	}
+
+	size_t num_freed = 0;
+
+	for ( auto c = self->free_list; c != nullptr; ) {
+		auto next = c->next;
+		free( c );
+		c = next;
+		num_freed++;
+	}
+
+	assert( num_freed == self->chunks_allocated && "chunks must be returned to pool before pool gets destroyed" );
+
+	delete self;
+}
+
+// ----------------------------------------------------------------------
+// Makes all encoders available again - any encoders previously acquired from
+// this pool must not be used after the pool has been reset.
+static void encoder_pool_reset( le_command_buffer_encoder_pool_o *self ) {
+	self->encoders_in_use = 0;
+	self->argument_data_cache_generation++; // transient memory gets reset together with the pool, cached argument data is stale from now on
+}
+
+// ----------------------------------------------------------------------
+// Returns an encoder which is owned by the pool, and which stays valid until the pool gets reset.
+static le_command_buffer_encoder_o *encoder_pool_acquire( le_command_buffer_encoder_pool_o *self, le_allocator_o **allocator, le_pipeline_manager_o *pipelineManager, le_staging_allocator_o *stagingAllocator, le::Extent2D const &extent ) {
+
+	if ( self->encoders_in_use == self->encoders.size() ) {
+		if ( self->encoders.size() == self->encoders.capacity() ) {
+			self->heap_allocation_count++; // vector is about to grow
+		}
+		auto encoder           = cbe_create( self, allocator, pipelineManager, stagingAllocator, extent );
+		encoder->isOwnedByPool = true;
+		self->encoders.push_back( encoder );
+		self->heap_allocation_count++;
+		self->encoders_in_use++;
+		return encoder;
+	}
+
+	// ---------| invariant: there is an encoder available for re-use
+
+	auto encoder = self->encoders[ self->encoders_in_use++ ];
+	cbe_reset( encoder, allocator, pipelineManager, stagingAllocator, extent );
+
+	return encoder;
+}
+
+// ----------------------------------------------------------------------
+// Returns running count of heap allocations made by this pool, and by encoders which
+// were acquired from this pool. This count should not change over steady-state frames.
+static uint64_t encoder_pool_get_heap_allocation_count( le_command_buffer_encoder_pool_o *self ) {
+	return self->heap_allocation_count;
+}
+
 // ----------------------------------------------------------------------
 // Returns extent to which this encoder has been set up to
 static le::Extent2D const &cbe_get_extent( le_command_buffer_encoder_o *self ) {
@@ -121,32 +508,44 @@ static le::Extent2D const &cbe_get_extent( le_command_buffer_encoder_o *self ) {
 
 static void cbe_set_line_width( le_command_buffer_encoder_o *self, float lineWidth ) {
 
-	auto cmd        = EMPLACE_CMD( le::CommandSetLineWidth ); // placement new into data array
+	auto cmd = EMPLACE_CMD( le::CommandSetLineWidth ); // placement new into data array
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.width = lineWidth;
 
-	self->mCommandStreamSize += sizeof( le::CommandSetLineWidth );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandSetLineWidth ) );
 }
 
 // ----------------------------------------------------------------------
 
 static void cbe_dispatch( le_command_buffer_encoder_o *self, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ ) {
 
-	auto cmd  = EMPLACE_CMD( le::CommandDispatch ); // placement new!
+	auto cmd = EMPLACE_CMD( le::CommandDispatch ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info = { groupCountX, groupCountY, groupCountZ, 0 };
 
-	self->mCommandStreamSize += sizeof( le::CommandDispatch );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandDispatch ) );
 }
 
 // ----------------------------------------------------------------------
 static void cbe_trace_rays( le_command_buffer_encoder_o *self, uint32_t width, uint32_t height, uint32_t depth ) {
 
-	auto cmd  = EMPLACE_CMD( le::CommandTraceRays ); // placement new!
+	auto cmd = EMPLACE_CMD( le::CommandTraceRays ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info = { width, height, depth };
 
-	self->mCommandStreamSize += sizeof( le::CommandTraceRays );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandTraceRays ) );
 }
 // ----------------------------------------------------------------------
 
@@ -156,11 +555,15 @@ static void cbe_draw( le_command_buffer_encoder_o *self,
                       uint32_t                     firstVertex,
                       uint32_t                     firstInstance ) {
 
-	auto cmd  = EMPLACE_CMD( le::CommandDraw ); // placement new!
+	auto cmd = EMPLACE_CMD( le::CommandDraw ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info = { vertexCount, instanceCount, firstVertex, firstInstance };
 
-	self->mCommandStreamSize += sizeof( le::CommandDraw );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandDraw ) );
 }
 
 // ----------------------------------------------------------------------
@@ -172,7 +575,12 @@ static void cbe_draw_indexed( le_command_buffer_encoder_o *self,
                               int32_t                      vertexOffset,
                               uint32_t                     firstInstance ) {
 
-	auto cmd  = EMPLACE_CMD( le::CommandDrawIndexed );
+	auto cmd = EMPLACE_CMD( le::CommandDrawIndexed );
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info = {
 	    indexCount,
 	    instanceCount,
@@ -182,8 +590,7 @@ static void cbe_draw_indexed( le_command_buffer_encoder_o *self,
 	    0 // padding must be set to zero
 	};
 
-	self->mCommandStreamSize += sizeof( le::CommandDrawIndexed );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandDrawIndexed ) );
 }
 
 // ----------------------------------------------------------------------
@@ -191,11 +598,15 @@ static void cbe_draw_mesh_tasks( le_command_buffer_encoder_o *self,
                                  uint32_t                     taskCount,
                                  uint32_t                     firstTask ) {
 
-	auto cmd  = EMPLACE_CMD( le::CommandDrawMeshTasks ); // placement new!
+	auto cmd = EMPLACE_CMD( le::CommandDrawMeshTasks ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info = { taskCount, firstTask };
 
-	self->mCommandStreamSize += sizeof( le::CommandDrawMeshTasks );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandDrawMeshTasks ) );
 }
 // ----------------------------------------------------------------------
 
@@ -204,12 +615,36 @@ static void cbe_set_viewport( le_command_buffer_encoder_o *self,
                               const uint32_t               viewportCount,
                               const le::Viewport *         pViewports ) {
 
-	auto cmd = EMPLACE_CMD( le::CommandSetViewport ); // placement new!
+	auto &state = self->boundState;
+
+	if ( viewportCount != 0 &&
+	     state.viewport_first == firstViewport &&
+	     state.viewport_count == viewportCount &&
+	     0 == memcmp( state.viewports, pViewports, sizeof( le::Viewport ) * viewportCount ) ) {
+		self->mElidedCommandCount++;
+		return;
+	}
+
+	// ---------| invariant: viewport state changes
+
+	if ( viewportCount <= LE_ENCODER_MAX_TRACKED_VIEWPORTS ) {
+		state.viewport_first = firstViewport;
+		state.viewport_count = viewportCount;
+		memcpy( state.viewports, pViewports, sizeof( le::Viewport ) * viewportCount );
+	} else {
+		state.viewport_count = 0;
+	}
+
+	size_t dataSize = sizeof( le::Viewport ) * viewportCount;
+	auto   cmd      = EMPLACE_CMD_WITH_PAYLOAD( le::CommandSetViewport, dataSize ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
 
 	// We point data to the next available position in the data stream
 	// so that we can store the data for viewports inline.
-	void * data     = ( cmd + 1 ); // note: this increments a le::CommandSetViewport pointer by one time its object size, then gets the address
-	size_t dataSize = sizeof( le::Viewport ) * viewportCount;
+	void *data = ( cmd + 1 ); // note: this increments a le::CommandSetViewport pointer by one time its object size, then gets the address
 
 	cmd->info = { firstViewport, viewportCount };
 	cmd->header.info.size += dataSize; // we must increase the size of this command by its payload size
@@ -237,8 +672,7 @@ static void cbe_set_viewport( le_command_buffer_encoder_o *self,
 		}
 	}
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 };
 
 // ----------------------------------------------------------------------
@@ -248,20 +682,43 @@ static void cbe_set_scissor( le_command_buffer_encoder_o *self,
                              const uint32_t               scissorCount,
                              le::Rect2D const *           pScissors ) {
 
-	auto cmd = EMPLACE_CMD( le::CommandSetScissor ); // placement new!
+	auto &state = self->boundState;
+
+	if ( scissorCount != 0 &&
+	     state.scissor_first == firstScissor &&
+	     state.scissor_count == scissorCount &&
+	     0 == memcmp( state.scissors, pScissors, sizeof( le::Rect2D ) * scissorCount ) ) {
+		self->mElidedCommandCount++;
+		return;
+	}
+
+	// ---------| invariant: scissor state changes
+
+	if ( scissorCount <= LE_ENCODER_MAX_TRACKED_VIEWPORTS ) {
+		state.scissor_first = firstScissor;
+		state.scissor_count = scissorCount;
+		memcpy( state.scissors, pScissors, sizeof( le::Rect2D ) * scissorCount );
+	} else {
+		state.scissor_count = 0;
+	}
+
+	size_t dataSize = sizeof( le::Rect2D ) * scissorCount;
+	auto   cmd      = EMPLACE_CMD_WITH_PAYLOAD( le::CommandSetScissor, dataSize ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
 
 	// We point to the next available position in the data stream
 	// so that we can store the data for scissors inline.
-	void * data     = ( cmd + 1 );
-	size_t dataSize = sizeof( le::Rect2D ) * scissorCount;
+	void *data = ( cmd + 1 );
 
 	cmd->info = { firstScissor, scissorCount };
 	cmd->header.info.size += dataSize; // we must increase the size of this command by its payload size
 
 	memcpy( data, pScissors, dataSize );
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 }
 
 // ----------------------------------------------------------------------
@@ -276,11 +733,50 @@ static void cbe_bind_vertex_buffers( le_command_buffer_encoder_o *self,
 	// in the backend to actual vulkan buffer ids.
 	// Buffer must be annotated whether it is transient or not
 
-	auto cmd = EMPLACE_CMD( le::CommandBindVertexBuffers ); // placement new!
+	auto &state = self->boundState;
+
+	if ( bindingCount == 0 ) {
+		return;
+	}
+
+	if ( firstBinding + bindingCount <= LE_ENCODER_MAX_TRACKED_VERTEX_BINDINGS ) {
+
+		uint32_t const bindings_mask = uint32_t( ( uint64_t( 1 ) << ( firstBinding + bindingCount ) ) - ( uint64_t( 1 ) << firstBinding ) );
+		bool           is_redundant  = ( state.vertex_bindings_mask & bindings_mask ) == bindings_mask;
+
+		for ( uint32_t i = 0; is_redundant && i != bindingCount; i++ ) {
+			is_redundant = state.vertex_buffers[ firstBinding + i ] == pBuffers[ i ] &&
+			               state.vertex_offsets[ firstBinding + i ] == pOffsets[ i ];
+		}
+
+		if ( is_redundant ) {
+			self->mElidedCommandCount++;
+			return;
+		}
+
+		// ---------| invariant: vertex buffer bindings change
+
+		for ( uint32_t i = 0; i != bindingCount; i++ ) {
+			state.vertex_buffers[ firstBinding + i ] = pBuffers[ i ];
+			state.vertex_offsets[ firstBinding + i ] = pOffsets[ i ];
+		}
+
+		state.vertex_bindings_mask |= bindings_mask;
+	} else {
+		// We can't track bindings outside our range - but we must not
+		// keep any stale state for bindings which we do track.
+		state.vertex_bindings_mask = 0;
+	}
 
 	size_t dataBuffersSize = ( sizeof( le_resource_handle_t ) ) * bindingCount;
 	size_t dataOffsetsSize = ( sizeof( uint64_t ) ) * bindingCount;
 
+	auto cmd = EMPLACE_CMD_WITH_PAYLOAD( le::CommandBindVertexBuffers, dataBuffersSize + dataOffsetsSize ); // placement new!
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	void *dataBuffers = ( cmd + 1 );
 	void *dataOffsets = ( static_cast<char *>( dataBuffers ) + dataBuffersSize ); // start address for offset data
 
@@ -290,8 +786,7 @@ static void cbe_bind_vertex_buffers( le_command_buffer_encoder_o *self,
 	memcpy( dataBuffers, pBuffers, dataBuffersSize );
 	memcpy( dataOffsets, pOffsets, dataOffsetsSize );
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 }
 
 // ----------------------------------------------------------------------
@@ -300,13 +795,31 @@ static void cbe_bind_index_buffer( le_command_buffer_encoder_o *self,
                                    uint64_t                     offset,
                                    le::IndexType const &        indexType ) {
 
+	auto &state = self->boundState;
+
+	if ( state.has_index_buffer &&
+	     state.index_buffer == buffer &&
+	     state.index_offset == offset &&
+	     state.index_type == indexType ) {
+		self->mElidedCommandCount++;
+		return;
+	}
+
+	state.has_index_buffer = true;
+	state.index_buffer     = buffer;
+	state.index_offset     = offset;
+	state.index_type       = indexType;
+
 	auto cmd = EMPLACE_CMD( le::CommandBindIndexBuffer );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	// Note: indexType==0 means uint16, indexType==1 means uint32
 	cmd->info = { buffer, offset, indexType, 0 };
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 }
 
 // ----------------------------------------------------------------------
@@ -396,20 +909,121 @@ static void cbe_set_index_data( le_command_buffer_encoder_o *
 
 // ----------------------------------------------------------------------
 
-static void cbe_bind_argument_buffer( le_command_buffer_encoder_o *self, le_resource_handle_t const bufferId, uint64_t argumentName, uint64_t offset, uint64_t range ) {
+// Returns tracked state for argument with given name, or nullptr if argument is not tracked.
+static le_encoder_bound_state_t::argument_t *cbe_find_bound_argument( le_command_buffer_encoder_o *self, uint64_t argumentName ) {
+	auto &state = self->boundState;
+	for ( uint32_t i = 0; i != state.arguments_count; i++ ) {
+		if ( state.arguments[ i ].name == argumentName ) {
+			return &state.arguments[ i ];
+		}
+	}
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------
+// Records argument binding, and returns whether a command must be emitted for it.
+static bool cbe_update_bound_argument( le_command_buffer_encoder_o *self, uint64_t argumentName, le_resource_handle_t const &bufferId, uint64_t offset, uint64_t range, void const *memAddr ) {
+
+	auto &state    = self->boundState;
+	auto  argument = cbe_find_bound_argument( self, argumentName );
+
+	if ( argument &&
+	     argument->buffer == bufferId &&
+	     argument->offset == offset &&
+	     argument->range == range ) {
+		self->mElidedCommandCount++;
+		return false;
+	}
+
+	if ( argument == nullptr ) {
+		if ( state.arguments_count < LE_ENCODER_MAX_TRACKED_ARGUMENTS ) {
+			argument = &state.arguments[ state.arguments_count++ ];
+		} else {
+			argument              = &state.arguments[ state.arguments_evict ];
+			state.arguments_evict = ( state.arguments_evict + 1 ) % LE_ENCODER_MAX_TRACKED_ARGUMENTS;
+		}
+	}
+
+	*argument = { argumentName, bufferId, offset, range, memAddr };
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+static void cbe_emit_bind_argument_buffer( le_command_buffer_encoder_o *self, le_resource_handle_t const bufferId, uint64_t argumentName, uint64_t offset, uint64_t range ) {
 
 	auto cmd = EMPLACE_CMD( le::CommandBindArgumentBuffer );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.argument_name_id = argumentName;
 	cmd->info.buffer_id        = bufferId;
 	cmd->info.offset           = offset;
 	cmd->info.range            = range;
 
-	self->mCommandStreamSize += sizeof( le::CommandBindArgumentBuffer );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandBindArgumentBuffer ) );
+}
+
+// ----------------------------------------------------------------------
+
+static void cbe_bind_argument_buffer( le_command_buffer_encoder_o *self, le_resource_handle_t const bufferId, uint64_t argumentName, uint64_t offset, uint64_t range ) {
+
+	if ( false == cbe_update_bound_argument( self, argumentName, bufferId, offset, range, nullptr ) ) {
+		return;
+	}
+
+	cbe_emit_bind_argument_buffer( self, bufferId, argumentName, offset, range );
+}
+
+// ----------------------------------------------------------------------
+// Looks up argument data in the current frame's argument data cache.
+// Returns an entry which holds identical data, or nullptr if no such entry was found.
+static le_argument_data_cache_entry_t const *argument_data_cache_find( le_command_buffer_encoder_pool_o const *pool, le_allocator_o const *allocator, uint64_t hash, void const *data, size_t numBytes ) {
+
+	for ( size_t i = 0; i != LE_ARGUMENT_DATA_CACHE_PROBE_COUNT; i++ ) {
+		auto const &entry = pool->argument_data_cache[ ( hash + i ) & ( LE_ARGUMENT_DATA_CACHE_SIZE - 1 ) ];
+
+		if ( entry.generation != pool->argument_data_cache_generation ) {
+			// Entries are inserted into the first free slot, which means there
+			// can't be a matching entry beyond a free slot.
+			return nullptr;
+		}
+
+		if ( entry.hash == hash &&
+		     entry.num_bytes == numBytes &&
+		     entry.allocator == allocator &&
+		     0 == memcmp( entry.mem_addr, data, numBytes ) ) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------
+// Stores an entry into the current frame's argument data cache. If all slots
+// which we may probe are taken, we replace the entry in the first slot.
+static void argument_data_cache_insert( le_command_buffer_encoder_pool_o *pool, le_argument_data_cache_entry_t const &entry ) {
+
+	le_argument_data_cache_entry_t *slot = &pool->argument_data_cache[ entry.hash & ( LE_ARGUMENT_DATA_CACHE_SIZE - 1 ) ];
+
+	for ( size_t i = 0; i != LE_ARGUMENT_DATA_CACHE_PROBE_COUNT; i++ ) {
+		auto &candidate = pool->argument_data_cache[ ( entry.hash + i ) & ( LE_ARGUMENT_DATA_CACHE_SIZE - 1 ) ];
+		if ( candidate.generation != pool->argument_data_cache_generation ) {
+			slot = &candidate;
+			break;
+		}
+	}
+
+	*slot            = entry;
+	slot->generation = pool->argument_data_cache_generation;
 }
 
 // ----------------------------------------------------------------------
+
 static void cbe_set_argument_data( le_command_buffer_encoder_o *self,
                                    uint64_t                     argumentNameId, // hash id of argument name
                                    void const *                 data,
@@ -422,11 +1036,47 @@ static void cbe_set_argument_data( le_command_buffer_encoder_o *self,
 
 	// --------| invariant: there are some bytes to set
 
-	void *   memAddr;
-	uint64_t bufferOffset = 0;
+	{
+		// If the argument is still bound to identical data, we don't need to
+		// allocate and bind again - we compare against the data which we
+		// previously wrote to scratch memory, as this stays valid for the frame.
+		auto argument = cbe_find_bound_argument( self, argumentNameId );
+		if ( argument &&
+		     argument->mem_addr &&
+		     argument->range == numBytes &&
+		     0 == memcmp( argument->mem_addr, data, numBytes ) ) {
+			self->mElidedCommandCount++;
+			self->mArgumentBytesSaved += numBytes;
+			return;
+		}
+	}
 
 	le_allocator_o *allocator = fetch_allocator( self->ppAllocator );
 
+	// If identical data has already been written to transient memory during this
+	// frame - by any encoder which shares our pool, and which uses the same
+	// allocator - we bind the existing allocation instead of allocating again.
+	//
+	// Encoders which were not acquired from a pool don't deduplicate.
+
+	uint64_t hash = 0;
+
+	if ( self->pool ) {
+		hash = SpookyHash::Hash64( data, numBytes, 0 );
+
+		auto entry = argument_data_cache_find( self->pool, allocator, hash, data, numBytes );
+
+		if ( entry ) {
+			self->mArgumentBytesSaved += numBytes;
+			cbe_update_bound_argument( self, argumentNameId, entry->buffer, entry->offset, entry->num_bytes, entry->mem_addr );
+			cbe_emit_bind_argument_buffer( self, entry->buffer, argumentNameId, uint32_t( entry->offset ), uint32_t( entry->num_bytes ) );
+			return;
+		}
+	}
+
+	void *   memAddr;
+	uint64_t bufferOffset = 0;
+
 	// -- Allocate memory on scratch buffer for ubo
 	//
 	// Note that we might want to have specialised ubo memory eventually if that
@@ -438,7 +1088,19 @@ static void cbe_set_argument_data( le_command_buffer_encoder_o *self,
 
 		le_resource_handle_t allocatorBuffer = le_allocator_linear_i.get_le_resource_id( allocator );
 
-		cbe_bind_argument_buffer( self, allocatorBuffer, argumentNameId, uint32_t( bufferOffset ), uint32_t( numBytes ) );
+		if ( self->pool ) {
+			le_argument_data_cache_entry_t entry{};
+			entry.hash      = hash;
+			entry.allocator = allocator;
+			entry.buffer    = allocatorBuffer;
+			entry.offset    = bufferOffset;
+			entry.num_bytes = numBytes;
+			entry.mem_addr  = memAddr;
+			argument_data_cache_insert( self->pool, entry );
+		}
+
+		cbe_update_bound_argument( self, argumentNameId, allocatorBuffer, uint32_t( bufferOffset ), uint32_t( numBytes ), memAddr );
+		cbe_emit_bind_argument_buffer( self, allocatorBuffer, argumentNameId, uint32_t( bufferOffset ), uint32_t( numBytes ) );
 
 	} else {
 		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << " could not allocate " << numBytes << " Bytes." << std::endl
@@ -453,12 +1115,15 @@ static void cbe_set_argument_texture( le_command_buffer_encoder_o *self, le_text
 
 	auto cmd = EMPLACE_CMD( le::CommandSetArgumentTexture );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.argument_name_id = argumentName;
 	cmd->info.texture_id       = textureId;
 	cmd->info.array_index      = arrayIndex;
 
-	self->mCommandStreamSize += sizeof( le::CommandSetArgumentTexture );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandSetArgumentTexture ) );
 }
 
 // ----------------------------------------------------------------------
@@ -467,12 +1132,15 @@ static void cbe_set_argument_image( le_command_buffer_encoder_o *self, le_resour
 
 	auto cmd = EMPLACE_CMD( le::CommandSetArgumentImage );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.argument_name_id = argumentName;
 	cmd->info.image_id         = imageId;
 	cmd->info.array_index      = arrayIndex;
 
-	self->mCommandStreamSize += sizeof( le::CommandSetArgumentImage );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandSetArgumentImage ) );
 }
 
 // ----------------------------------------------------------------------
@@ -481,34 +1149,64 @@ static void cbe_set_argument_tlas( le_command_buffer_encoder_o *self, le_resourc
 
 	auto cmd = EMPLACE_CMD( le::CommandSetArgumentTlas );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.argument_name_id = argumentName;
 	cmd->info.tlas_id          = tlasId;
 	cmd->info.array_index      = arrayIndex;
 
-	self->mCommandStreamSize += sizeof( le::CommandSetArgumentTlas );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandSetArgumentTlas ) );
 }
 
 // ----------------------------------------------------------------------
 
 static void cbe_bind_graphics_pipeline( le_command_buffer_encoder_o *self, le_gpso_handle gpsoHandle ) {
 
+	auto &state = self->boundState;
+
+	if ( state.gpso == gpsoHandle ) {
+		// Note that this means that dynamic offsets for arguments are not reset, as they
+		// would be if the pipeline got re-bound in the backend - argument state therefore
+		// stays exactly as it was recorded.
+		self->mElidedCommandCount++;
+		return;
+	}
+
+	// Binding a different pipeline resets all argument bindings in the backend.
+	state.gpso            = gpsoHandle;
+	state.arguments_count = 0;
+	state.arguments_evict = 0;
+
 	// -- insert graphics PSO pointer into command stream
 	auto cmd = EMPLACE_CMD( le::CommandBindGraphicsPipeline );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.gpsoHandle = gpsoHandle;
 
-	self->mCommandStreamSize += sizeof( le::CommandBindGraphicsPipeline );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandBindGraphicsPipeline ) );
 }
 
 // ----------------------------------------------------------------------
 
 static void cbe_bind_rtx_pipeline( le_command_buffer_encoder_o *self, le_shader_binding_table_o *sbt ) {
 
+	// Binding a pipeline resets all argument bindings in the backend.
+	self->boundState.gpso            = nullptr;
+	self->boundState.arguments_count = 0;
+	self->boundState.arguments_evict = 0;
+
 	// -- insert rtx PSO pointer into command stream
 	auto cmd = EMPLACE_CMD( le::CommandBindRtxPipeline );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	using namespace le_backend_vk;
 
 	// -- query pipeline for shader group data
@@ -697,21 +1395,28 @@ static void cbe_bind_rtx_pipeline( le_command_buffer_encoder_o *self, le_shader_
 	// query handles from pipeline manager.
 	// allocate data, point to data.
 
-	self->mCommandStreamSize += sizeof( le::CommandBindRtxPipeline );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandBindRtxPipeline ) );
 }
 
 // ----------------------------------------------------------------------
 
 static void cbe_bind_compute_pipeline( le_command_buffer_encoder_o *self, le_cpso_handle cpsoHandle ) {
 
+	// Binding a pipeline resets all argument bindings in the backend.
+	self->boundState.gpso            = nullptr;
+	self->boundState.arguments_count = 0;
+	self->boundState.arguments_evict = 0;
+
 	// -- insert compute PSO pointer into command stream
 	auto cmd = EMPLACE_CMD( le::CommandBindComputePipeline );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	cmd->info.cpsoHandle = cpsoHandle;
 
-	self->mCommandStreamSize += sizeof( le::CommandBindComputePipeline );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandBindComputePipeline ) );
 }
 
 // ----------------------------------------------------------------------
@@ -720,9 +1425,14 @@ static void cbe_write_to_buffer( le_command_buffer_encoder_o *self, le_resource_
 
 	auto cmd = EMPLACE_CMD( le::CommandWriteToBuffer );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	using namespace le_backend_vk; // for le_allocator_linear_i
 	void *               memAddr;
 	le_resource_handle_t srcResourceId;
+	uint64_t             srcOffset = 0;
 
 	// -- Allocate memory using staging allocator
 	//
@@ -731,12 +1441,12 @@ static void cbe_write_to_buffer( le_command_buffer_encoder_o *self, le_resource_
 	// allocated so that it is only used for TRANSFER_SRC, and shared amongst encoders so that we
 	// use available memory more efficiently.
 	//
-	if ( le_staging_allocator_i.map( self->stagingAllocator, numBytes, &memAddr, &srcResourceId ) ) {
+	if ( le_staging_allocator_i.map( self->stagingAllocator, numBytes, &memAddr, &srcResourceId, &srcOffset ) ) {
 		// -- Write data to scratch memory now
 		memcpy( memAddr, data, numBytes );
 
 		cmd->info.src_buffer_id = srcResourceId;
-		cmd->info.src_offset    = 0; // staging allocator will give us a fresh buffer, and src memory will be placed at its start
+		cmd->info.src_offset    = srcOffset; // staging memory is typically sub-allocated from the frame's staging ring
 		cmd->info.dst_offset    = offset;
 		cmd->info.numBytes      = numBytes;
 		cmd->info.dst_buffer_id = resourceId;
@@ -746,8 +1456,7 @@ static void cbe_write_to_buffer( le_command_buffer_encoder_o *self, le_resource_
 		return;
 	}
 
-	self->mCommandStreamSize += sizeof( le::CommandWriteToBuffer );
-	self->mCommandCount++;
+	cbe_commit_cmd( self, sizeof( le::CommandWriteToBuffer ) );
 }
 
 // ----------------------------------------------------------------------
@@ -764,9 +1473,14 @@ static void cbe_write_to_image( le_command_buffer_encoder_o *       self,
 
 	auto cmd = EMPLACE_CMD( le::CommandWriteToImage );
 
+	if ( nullptr == cmd ) {
+		return;
+	}
+
 	using namespace le_backend_vk; // for le_allocator_linear_i
 	void *               memAddr;
 	le_resource_handle_t stagingBufferId;
+	uint64_t             stagingOffset = 0;
 
 	// -- Allocate memory using staging allocator
 	//
@@ -775,14 +1489,15 @@ static void cbe_write_to_image( le_command_buffer_encoder_o *       self,
 	// allocated so that it is only used for TRANSFER_SRC, and shared amongst encoders so that we
 	// use available memory more efficiently.
 	//
-	if ( le_staging_allocator_i.map( self->stagingAllocator, numBytes, &memAddr, &stagingBufferId ) ) {
+	if ( le_staging_allocator_i.map( self->stagingAllocator, numBytes, &memAddr, &stagingBufferId, &stagingOffset ) ) {
 
-		// -- Write data to the freshly allocated buffer
+		// -- Write data to the freshly allocated staging memory
 		memcpy( memAddr, data, numBytes );
 
 		assert( writeInfo.num_miplevels != 0 ); // number of miplevels must be at least 1.
 
 		cmd->info.src_buffer_id   = stagingBufferId;           // resource id of staging buffer
+		cmd->info.src_offset      = stagingOffset;             // offset of image data within staging buffer
 		cmd->info.numBytes        = numBytes;                  // total number of bytes from staging buffer which need to be synchronised.
 		cmd->info.dst_image_id    = imageId;                   // resouce id for target image resource
 		cmd->info.dst_miplevel    = writeInfo.dst_miplevel;    // default 0, use higher number to manually upload higher mip levels.
@@ -801,8 +1516,7 @@ static void cbe_write_to_image( le_command_buffer_encoder_o *       self,
 		return;
 	}
 	// increase command stream size by size of command, plus size of regions attached to command.
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 }
 
 // ----------------------------------------------------------------------
@@ -817,9 +1531,14 @@ static void cbe_build_rtx_blas( le_command_buffer_encoder_o *     self,
 		return;
 	}
 
-	auto   cmd       = EMPLACE_CMD( le::CommandBuildRtxBlas );
-	void * data      = cmd + 1;
 	size_t data_size = sizeof( le_resource_handle_t ) * handles_count;
+	auto   cmd       = EMPLACE_CMD_WITH_PAYLOAD( le::CommandBuildRtxBlas, data_size );
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
+	void *data = cmd + 1;
 
 	cmd->info                    = {};
 	cmd->info.blas_handles_count = handles_count;
@@ -827,8 +1546,7 @@ static void cbe_build_rtx_blas( le_command_buffer_encoder_o *     self,
 
 	memcpy( data, p_blas_handles, data_size );
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
 }
 
 // ----------------------------------------------------------------------
@@ -839,7 +1557,12 @@ void cbe_build_rtx_tlas( le_command_buffer_encoder_o *     self,
                          le_resource_handle_t const *      blas_handles,
                          uint32_t                          instances_count ) {
 
-	auto cmd = EMPLACE_CMD( le::CommandBuildRtxTlas );
+	// blas handles are stored inline with the command, see below.
+	auto cmd = EMPLACE_CMD_WITH_PAYLOAD( le::CommandBuildRtxTlas, sizeof( le_resource_handle_t ) * instances_count );
+
+	if ( nullptr == cmd ) {
+		return;
+	}
 
 	cmd->info                          = {};
 	cmd->info.tlas_handle              = *tlas_handle;
@@ -888,8 +1611,254 @@ void cbe_build_rtx_tlas( le_command_buffer_encoder_o *     self,
 	void *memAddr = cmd + 1; // move to position just after command
 	memcpy( memAddr, blas_handles, payload_size );
 
-	self->mCommandStreamSize += cmd->header.info.size;
-	self->mCommandCount++;
+	cbe_commit_cmd( self, cmd->header.info.size );
+}
+
+// ----------------------------------------------------------------------
+// Resets bound state so that no command gets filtered against state which was set
+// by a different draw list item - items may be re-ordered, which means that only
+// state set within the same item is guaranteed to be in effect.
+static void cbe_invalidate_bound_state( le_command_buffer_encoder_o *self ) {
+	auto &state                = self->boundState;
+	state.gpso                 = nullptr;
+	state.viewport_count       = 0;
+	state.scissor_count        = 0;
+	state.vertex_bindings_mask = 0;
+	state.has_index_buffer     = false;
+	state.arguments_count      = 0;
+	state.arguments_evict      = 0;
+}
+
+// ----------------------------------------------------------------------
+// Begins recording into a draw list: commands are captured, and only get added to the command
+// stream once the draw list ends - sorted by the sort key that was set for each draw item.
+//
+// Each draw item must set all state which it depends upon, as items may get re-ordered.
+// Redundant state changes between items get filtered when the draw list is flushed.
+static void cbe_begin_draw_list( le_command_buffer_encoder_o *self ) {
+
+	if ( self->isRecordingDrawList ) {
+		std::cout << "WARNING: " << __PRETTY_FUNCTION__ << ": Encoder is already recording a draw list." << std::endl
+		          << std::flush;
+		return;
+	}
+
+	self->drawListSavedState = self->boundState;
+	self->drawListDataSize   = 0;
+	self->drawListItems.clear();
+
+	if ( self->drawListItems.capacity() == 0 && self->pool ) {
+		self->pool->heap_allocation_count++;
+	}
+
+	self->drawListItems.push_back( { 0, 0, 0 } ); // commands recorded before the first sort key is set use key 0
+
+	self->isRecordingDrawList = true;
+
+	cbe_invalidate_bound_state( self );
+}
+
+// ----------------------------------------------------------------------
+// Starts a new draw item - all commands recorded until the next call to this method
+// belong to this item, and are sorted using the given key.
+static void cbe_set_draw_sort_key( le_command_buffer_encoder_o *self, uint64_t sort_key ) {
+
+	if ( false == self->isRecordingDrawList ) {
+		assert( false && "sort keys may only be set while recording a draw list" );
+		return;
+	}
+
+	auto &current_item = self->drawListItems.back();
+
+	if ( current_item.size == 0 ) {
+		// current item is still empty, we may re-use it.
+		current_item.sort_key = sort_key;
+		return;
+	}
+
+	if ( self->drawListItems.size() == self->drawListItems.capacity() && self->pool ) {
+		self->pool->heap_allocation_count++; // vector is about to grow
+	}
+
+	self->drawListItems.push_back( { sort_key, self->drawListDataSize, 0 } );
+
+	cbe_invalidate_bound_state( self );
+}
+
+// ----------------------------------------------------------------------
+// Stable least-significant-digit radix sort over 64bit sort keys, using 8 bits per pass.
+// Passes over bytes which are identical for all keys are skipped.
+static void radix_sort_draw_list_items( std::vector<le_draw_list_item_t> &items, std::vector<le_draw_list_item_t> &scratch ) {
+
+	if ( items.size() < 2 ) {
+		return;
+	}
+
+	scratch.resize( items.size() );
+
+	// Find out which bytes differ between keys - we only need to sort by these.
+	uint64_t differing_bits = 0;
+	for ( auto const &item : items ) {
+		differing_bits |= item.sort_key ^ items[ 0 ].sort_key;
+	}
+
+	for ( uint32_t shift = 0; shift != 64; shift += 8 ) {
+
+		if ( 0 == ( ( differing_bits >> shift ) & 0xff ) ) {
+			continue;
+		}
+
+		size_t offsets[ 256 ] = {};
+
+		for ( auto const &item : items ) {
+			offsets[ ( item.sort_key >> shift ) & 0xff ]++;
+		}
+
+		size_t sum = 0;
+		for ( auto &o : offsets ) {
+			size_t count = o;
+			o            = sum;
+			sum += count;
+		}
+
+		for ( auto const &item : items ) {
+			scratch[ offsets[ ( item.sort_key >> shift ) & 0xff ]++ ] = item;
+		}
+
+		std::swap( items, scratch );
+	}
+}
+
+// ----------------------------------------------------------------------
+// Adds a captured command to the command stream. State commands are passed through
+// state filtering, and draws get merged with the previous draw if they continue
+// its instance range with otherwise identical parameters, and no other command
+// has been recorded in-between.
+static void cbe_replay_draw_list_cmd( le_command_buffer_encoder_o *self, le::CommandHeader const *header ) {
+
+	switch ( header->info.type ) {
+	case le::CommandType::eBindGraphicsPipeline: {
+		auto cmd = reinterpret_cast<le::CommandBindGraphicsPipeline const *>( header );
+		cbe_bind_graphics_pipeline( self, cmd->info.gpsoHandle );
+		return;
+	}
+	case le::CommandType::eSetViewport: {
+		auto cmd = reinterpret_cast<le::CommandSetViewport const *>( header );
+		cbe_set_viewport( self, cmd->info.firstViewport, cmd->info.viewportCount, reinterpret_cast<le::Viewport const *>( cmd + 1 ) );
+		return;
+	}
+	case le::CommandType::eSetScissor: {
+		auto cmd = reinterpret_cast<le::CommandSetScissor const *>( header );
+		cbe_set_scissor( self, cmd->info.firstScissor, cmd->info.scissorCount, reinterpret_cast<le::Rect2D const *>( cmd + 1 ) );
+		return;
+	}
+	case le::CommandType::eBindVertexBuffers: {
+		// Note that we must not use the payload pointers stored with the command, as these
+		// point into the draw list buffer at the time of capture, which may have since moved.
+		auto cmd      = reinterpret_cast<le::CommandBindVertexBuffers const *>( header );
+		auto pBuffers = reinterpret_cast<le_resource_handle_t const *>( cmd + 1 );
+		auto pOffsets = reinterpret_cast<uint64_t const *>( pBuffers + cmd->info.bindingCount );
+		cbe_bind_vertex_buffers( self, cmd->info.firstBinding, cmd->info.bindingCount, pBuffers, pOffsets );
+		return;
+	}
+	case le::CommandType::eBindIndexBuffer: {
+		auto cmd = reinterpret_cast<le::CommandBindIndexBuffer const *>( header );
+		cbe_bind_index_buffer( self, cmd->info.buffer, cmd->info.offset, cmd->info.indexType );
+		return;
+	}
+	case le::CommandType::eBindArgumentBuffer: {
+		auto cmd = reinterpret_cast<le::CommandBindArgumentBuffer const *>( header );
+		cbe_bind_argument_buffer( self, cmd->info.buffer_id, cmd->info.argument_name_id, cmd->info.offset, cmd->info.range );
+		return;
+	}
+	case le::CommandType::eDraw: {
+		auto cmd  = reinterpret_cast<le::CommandDraw const *>( header );
+		auto last = static_cast<le::CommandDraw *>( self->drawListLastDraw );
+		if ( last &&
+		     self->drawListLastDrawCommandCount == self->mCommandCount &&
+		     last->header.info.type == le::CommandType::eDraw &&
+		     last->info.vertexCount == cmd->info.vertexCount &&
+		     last->info.firstVertex == cmd->info.firstVertex &&
+		     last->info.firstInstance + last->info.instanceCount == cmd->info.firstInstance ) {
+			last->info.instanceCount += cmd->info.instanceCount;
+			self->mElidedCommandCount++;
+			return;
+		}
+		break;
+	}
+	case le::CommandType::eDrawIndexed: {
+		auto cmd  = reinterpret_cast<le::CommandDrawIndexed const *>( header );
+		auto last = static_cast<le::CommandDrawIndexed *>( self->drawListLastDraw );
+		if ( last &&
+		     self->drawListLastDrawCommandCount == self->mCommandCount &&
+		     last->header.info.type == le::CommandType::eDrawIndexed &&
+		     last->info.indexCount == cmd->info.indexCount &&
+		     last->info.firstIndex == cmd->info.firstIndex &&
+		     last->info.vertexOffset == cmd->info.vertexOffset &&
+		     last->info.firstInstance + last->info.instanceCount == cmd->info.firstInstance ) {
+			last->info.instanceCount += cmd->info.instanceCount;
+			self->mElidedCommandCount++;
+			return;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	// ---------| invariant: command must be copied verbatim
+
+	void *cmd = cbe_reserve_cmd( self, header->info.size );
+
+	if ( nullptr == cmd ) {
+		return;
+	}
+
+	memcpy( cmd, header, header->info.size );
+	cbe_commit_cmd( self, header->info.size );
+
+	if ( header->info.type == le::CommandType::eDraw ||
+	     header->info.type == le::CommandType::eDrawIndexed ) {
+		self->drawListLastDraw             = cmd;
+		self->drawListLastDrawCommandCount = self->mCommandCount;
+	}
+}
+
+// ----------------------------------------------------------------------
+// Sorts draw list items by their sort keys, and adds their commands to the command stream.
+static void cbe_end_draw_list( le_command_buffer_encoder_o *self ) {
+
+	if ( false == self->isRecordingDrawList ) {
+		std::cout << "WARNING: " << __PRETTY_FUNCTION__ << ": Encoder is not recording a draw list." << std::endl
+		          << std::flush;
+		return;
+	}
+
+	// ---------| invariant: we are recording a draw list
+
+	self->isRecordingDrawList = false;
+	self->boundState          = self->drawListSavedState;
+	self->drawListLastDraw    = nullptr;
+
+	if ( self->drawListItemsScratch.capacity() < self->drawListItems.size() && self->pool ) {
+		self->pool->heap_allocation_count++; // scratch is about to grow
+	}
+
+	radix_sort_draw_list_items( self->drawListItems, self->drawListItemsScratch );
+
+	for ( auto const &item : self->drawListItems ) {
+		char const *it  = self->drawListData.data() + item.offset;
+		char const *end = it + item.size;
+		while ( it != end ) {
+			auto header = reinterpret_cast<le::CommandHeader const *>( it );
+			cbe_replay_draw_list_cmd( self, header );
+			it += header->info.size;
+		}
+	}
+
+	self->drawListItems.clear();
+	self->drawListDataSize = 0;
+	self->drawListLastDraw = nullptr;
 }
 
 // ----------------------------------------------------------------------
@@ -899,7 +1868,15 @@ static void cbe_get_encoded_data( le_command_buffer_encoder_o *self,
                                   size_t *                     numBytes,
                                   size_t *                     numCommands ) {
 
-	*data        = self->mCommandStream;
+	if ( self->isRecordingDrawList ) {
+		std::cout << "WARNING: " << __PRETTY_FUNCTION__ << ": Draw list was not ended - ending draw list implicitly." << std::endl
+		          << std::flush;
+		cbe_end_draw_list( self );
+	}
+
+	// Note that data points to the first chunk of the command stream - consumers must
+	// follow CommandNextChunk commands to reach any subsequent chunks.
+	*data        = self->mFirstChunk ? self->mFirstChunk->data() : nullptr;
 	*numBytes    = self->mCommandStreamSize;
 	*numCommands = self->mCommandCount;
 }
@@ -910,12 +1887,46 @@ static le_pipeline_manager_o *cbe_get_pipeline_manager( le_command_buffer_encode
 	return self->pipelineManager;
 }
 
+// ----------------------------------------------------------------------
+// Returns number of commands which were not recorded because they would not have changed state.
+static size_t cbe_get_elided_command_count( le_command_buffer_encoder_o *self ) {
+	return self->mElidedCommandCount;
+}
+
+// ----------------------------------------------------------------------
+// Returns number of argument data bytes which were not written to transient memory,
+// either because the argument was already bound to identical data, or because
+// identical data had already been written during the current frame.
+static size_t cbe_get_argument_bytes_saved( le_command_buffer_encoder_o *self ) {
+	return self->mArgumentBytesSaved;
+}
+
 // ----------------------------------------------------------------------
 
 le_shader_binding_table_o *cbe_build_shader_binding_table( le_command_buffer_encoder_o *self, le_rtxpso_handle pipeline ) {
+
+	if ( self->shaderBindingTablesInUse < self->shader_binding_tables.size() ) {
+		// Re-use shader binding table from a previous frame - clear() keeps capacity.
+		auto sbt = self->shader_binding_tables[ self->shaderBindingTablesInUse++ ];
+		sbt->ray_gen.parameters.clear();
+		sbt->hit.clear();
+		sbt->miss.clear();
+		sbt->callable.clear();
+		sbt->has_ray_gen        = false;
+		sbt->last_shader_record = nullptr;
+		sbt->pipeline           = pipeline;
+		return sbt;
+	}
+
 	auto sbt      = new le_shader_binding_table_o{};
 	sbt->pipeline = pipeline;
 	self->shader_binding_tables.emplace_back( sbt );
+	self->shaderBindingTablesInUse++;
+
+	if ( self->pool ) {
+		self->pool->heap_allocation_count++;
+	}
+
 	return sbt;
 }
 
@@ -962,6 +1973,7 @@ void register_le_command_buffer_encoder_api( void *api_ ) {
 	auto &cbe_i = static_cast<le_renderer_api *>( api_ )->le_command_buffer_encoder_i;
 
 	cbe_i.create                 = cbe_create;
+
 	cbe_i.destroy                = cbe_destroy;
 	cbe_i.draw                   = cbe_draw;
 	cbe_i.draw_indexed           = cbe_draw_indexed;
@@ -999,4 +2011,16 @@ void register_le_command_buffer_encoder_api( void *api_ ) {
 	cbe_i.sbt_add_u32_param = sbt_add_u32_param;
 	cbe_i.sbt_add_f32_param = sbt_add_f32_param;
 	cbe_i.sbt_validate      = sbt_validate;
+
+	cbe_i.get_elided_command_count = cbe_get_elided_command_count;
+	cbe_i.get_argument_bytes_saved = cbe_get_argument_bytes_saved;
+	cbe_i.begin_draw_list          = cbe_begin_draw_list;
+	cbe_i.set_draw_sort_key        = cbe_set_draw_sort_key;
+	cbe_i.end_draw_list            = cbe_end_draw_list;
+
+	cbe_i.create_pool                    = encoder_pool_create;
+	cbe_i.destroy_pool                   = encoder_pool_destroy;
+	cbe_i.reset_pool                     = encoder_pool_reset;
+	cbe_i.acquire_from_pool              = encoder_pool_acquire;
+	cbe_i.get_pool_heap_allocation_count = encoder_pool_get_heap_allocation_count;
 }
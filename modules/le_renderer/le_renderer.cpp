@@ -8,11 +8,13 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 #include <chrono>
 #include <vector>
 #include "assert.h"
 #include <mutex>
 #include <algorithm>
+#include <array>
 
 const uint64_t LE_RENDERPASS_MARKER_EXTERNAL = hash_64_fnv1a_const( "rp-external" );
 
@@ -24,6 +26,8 @@ using NanoTime = std::chrono::time_point<std::chrono::high_resolution_clock>;
 #	define LE_MT 0
 #endif
 
+constexpr size_t LE_RENDERER_STATS_HISTORY_LENGTH = 128; // number of most recent frames for which we keep statistics
+
 // ----------------------------------------------------------------------
 
 struct FrameData {
@@ -73,6 +77,11 @@ struct le_texture_handle_store_t {
 
 static le_texture_handle_store_t *texture_handle_library{ nullptr };
 
+struct FrameStats {
+	le_frame_stats_t                   frame;
+	std::vector<le_renderpass_stats_t> passes;
+};
+
 // ----------------------------------------------------------------------
 
 struct le_renderer_o {
@@ -81,17 +90,24 @@ struct le_renderer_o {
 
 	std::vector<FrameData>               frames;
 	size_t                               numSwapchainImages = 0;
+	size_t                               pipelineDepth      = 3;            // number of frames in flight, from record until frame has come back from gpu
 	size_t                               currentFrameNumber = size_t( ~0 ); // ever increasing number of current frame
 	std::vector<le_swapchain_settings_t> swapchain_settings{};              // default swapchain settings
+
+	std::vector<FrameStats> stats_history;           // ring buffer of stats for frames which came back from the gpu
+	size_t                  stats_history_head  = 0; // index of slot which will receive stats for the next frame
+	size_t                  stats_history_count = 0; // number of valid entries in stats_history
 };
 
-static void renderer_clear_frame( le_renderer_o *self, size_t frameIndex ); // ffdecl
+static bool renderer_clear_frame( le_renderer_o *self, size_t frameIndex, bool may_block ); // ffdecl
 
 // ----------------------------------------------------------------------
 
 static le_renderer_o *renderer_create() {
 	auto obj = new le_renderer_o();
 
+	obj->stats_history.resize( LE_RENDERER_STATS_HISTORY_LENGTH );
+
 	texture_handle_library = new le_texture_handle_store_t();
 	// we store back into the api, so that it will survive reload of this module.
 	const_cast<le_renderer_api *>( le_renderer_api_i )->le_renderer_i.le_texture_handle_store = texture_handle_library;
@@ -155,7 +171,7 @@ static void renderer_destroy( le_renderer_o *self ) {
 
 	for ( size_t i = 0; i != self->frames.size(); ++i ) {
 		auto index = ( lastIndex + i ) % self->frames.size();
-		renderer_clear_frame( self, index );
+		renderer_clear_frame( self, index, true );
 		// -- FIXME: delete graph builders which we added in create.
 		// This is not elegant.
 		rendergraph_i.destroy( self->frames[ index ].rendergraph );
@@ -198,6 +214,14 @@ static le_shader_module_o *renderer_create_shader_module( le_renderer_o *self, c
 	return vk_backend_i.create_shader_module( self->backend, path, moduleType, macro_definitions );
 }
 
+// ----------------------------------------------------------------------
+/// \brief declare a number of shader modules at once - modules are compiled concurrently
+/// \details writes one shader module handle per path into `modules`, nullptr for any module which failed
+static void renderer_create_shader_modules( le_renderer_o *self, char const *const *paths, LeShaderStageEnum const *moduleTypes, char const *const *macro_definitions, size_t num_modules, le_shader_module_o **modules ) {
+	using namespace le_backend_vk;
+	vk_backend_i.create_shader_modules( self->backend, paths, moduleTypes, macro_definitions, num_modules, modules );
+}
+
 // ----------------------------------------------------------------------
 
 static le_rtx_blas_info_handle renderer_create_rtx_blas_info_handle( le_renderer_o *self, le_rtx_geometry_t *geometries, uint32_t geometries_count, LeBuildAccelerationStructureFlags const *flags ) {
@@ -236,6 +260,12 @@ static void renderer_setup( le_renderer_o *self, le_renderer_settings_t const &s
 	    settings.swapchain_settings,
 	    settings.swapchain_settings + settings.num_swapchain_settings );
 
+	// Each frame in flight needs its own swapchain image - we hint at
+	// this so that the swapchain may provide enough images.
+	for ( auto &s : self->swapchain_settings ) {
+		s.imagecount_hint = std::max( s.imagecount_hint, settings.pipeline_depth );
+	}
+
 	{
 		// Set up the backend
 
@@ -247,6 +277,7 @@ static void renderer_setup( le_renderer_o *self, le_renderer_settings_t const &s
 		backend_settings.num_swapchain_settings       = self->swapchain_settings.size();
 		backend_settings.requestedDeviceExtensions    = settings.requested_device_extensions;
 		backend_settings.numRequestedDeviceExtensions = settings.requested_device_extensions_count;
+		backend_settings.bindlessDescriptors          = settings.bindless_descriptors;
 
 #if ( LE_MT > 0 )
 		backend_settings.concurrency_count = LE_MT;
@@ -261,10 +292,20 @@ static void renderer_setup( le_renderer_o *self, le_renderer_settings_t const &s
 	// we may now query the available number of swapchain images.
 	self->numSwapchainImages = vk_backend_i.get_num_swapchain_images( self->backend );
 
+	// Backend keeps one set of frame data per swapchain image - this limits our
+	// pipeline depth, as each frame in flight needs its own frame data.
+	self->pipelineDepth = std::min<size_t>( std::max<uint32_t>( 2, settings.pipeline_depth ), self->numSwapchainImages );
+
+	if ( self->pipelineDepth != settings.pipeline_depth ) {
+		std::cout << "WARNING: Requested pipeline depth (" << settings.pipeline_depth << ") not available, "
+		          << "using pipeline depth: " << self->pipelineDepth << std::endl
+		          << std::flush;
+	}
+
 	using namespace le_renderer; // for rendergraph_i
-	self->frames.reserve( self->numSwapchainImages );
+	self->frames.reserve( self->pipelineDepth );
 
-	for ( size_t i = 0; i != self->numSwapchainImages; ++i ) {
+	for ( size_t i = 0; i != self->pipelineDepth; ++i ) {
 		auto frameData        = FrameData();
 		frameData.rendergraph = rendergraph_i.create();
 		self->frames.push_back( std::move( frameData ) );
@@ -275,7 +316,340 @@ static void renderer_setup( le_renderer_o *self, le_renderer_settings_t const &s
 
 // ----------------------------------------------------------------------
 
-static void renderer_clear_frame( le_renderer_o *self, size_t frameIndex ) {
+static inline uint64_t duration_in_ns( NanoTime const &start, NanoTime const &end ) {
+	return uint64_t( std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count() );
+}
+
+// ----------------------------------------------------------------------
+// Store stats for frame at frameIndex into the stats history ring buffer.
+// Frame must have been dispatched, and its frame fence must have been crossed.
+static void renderer_collect_frame_stats( le_renderer_o *self, size_t frameIndex ) {
+
+	using namespace le_backend_vk; // for vk_backend_i
+	using namespace le_renderer;   // for rendergraph_i
+
+	auto const &frame = self->frames[ frameIndex ];
+	auto &      stats = self->stats_history[ self->stats_history_head ];
+
+	stats.frame                  = {};
+	stats.frame.frame_number     = frame.frameNumber;
+	stats.frame.record_time_ns   = duration_in_ns( frame.meta.time_record_frame_start, frame.meta.time_record_frame_end );
+	stats.frame.acquire_time_ns  = duration_in_ns( frame.meta.time_acquire_frame_start, frame.meta.time_acquire_frame_end );
+	stats.frame.process_time_ns  = duration_in_ns( frame.meta.time_process_frame_start, frame.meta.time_process_frame_end );
+	stats.frame.dispatch_time_ns = duration_in_ns( frame.meta.time_dispatch_frame_start, frame.meta.time_dispatch_frame_end );
+
+	le_renderpass_stats_t const *pass_stats       = nullptr;
+	size_t                       pass_stats_count = 0;
+	rendergraph_i.get_pass_stats( frame.rendergraph, &pass_stats, &pass_stats_count );
+
+	// Note that assign() re-uses capacity, which means we don't allocate once the ring buffer has been filled.
+	stats.passes.assign( pass_stats, pass_stats + pass_stats_count );
+
+	uint64_t const *gpu_pass_ids        = nullptr;
+	uint64_t const *gpu_durations       = nullptr;
+	size_t          gpu_durations_count = 0;
+	vk_backend_i.get_frame_gpu_timings( self->backend, frameIndex, &gpu_pass_ids, &gpu_durations, &gpu_durations_count );
+
+	// Match gpu timings to passes via pass id - there are only ever a handful of passes per frame.
+	for ( size_t i = 0; i != gpu_durations_count; i++ ) {
+		stats.frame.gpu_time_ns += gpu_durations[ i ];
+		for ( auto &p : stats.passes ) {
+			if ( p.pass_id == gpu_pass_ids[ i ] ) {
+				p.gpu_time_ns = gpu_durations[ i ];
+				break;
+			}
+		}
+	}
+
+	vk_backend_i.get_frame_descriptor_set_cache_stats( self->backend, frameIndex, &stats.frame.descriptor_set_cache_hits, &stats.frame.descriptor_set_cache_misses );
+
+	le_allocator_linear_stats_t transient_stats{};
+	vk_backend_i.get_frame_transient_allocator_stats( self->backend, frameIndex, &transient_stats );
+
+	stats.frame.transient_bytes_used     = transient_stats.bytes_used;
+	stats.frame.transient_bytes_capacity = transient_stats.bytes_capacity;
+	stats.frame.transient_block_count    = transient_stats.num_blocks;
+
+	le_staging_allocator_stats_t staging_stats{};
+	vk_backend_i.get_frame_staging_allocator_stats( self->backend, frameIndex, &staging_stats );
+
+	stats.frame.staging_bytes           = staging_stats.bytes_requested;
+	stats.frame.staging_dedicated_bytes = staging_stats.bytes_dedicated;
+	stats.frame.staging_dedicated_count = staging_stats.num_dedicated_allocations;
+
+	for ( auto const &p : stats.passes ) {
+		stats.frame.command_bytes += p.command_bytes;
+		stats.frame.peak_command_bytes = std::max( stats.frame.peak_command_bytes, p.command_bytes );
+		stats.frame.heap_allocations += p.heap_allocations;
+		stats.frame.argument_bytes_saved += p.argument_bytes_saved;
+	}
+
+	stats.frame.pass_count     = uint32_t( stats.passes.size() );
+	stats.frame.latency_frames = uint32_t( self->currentFrameNumber - frame.frameNumber );
+
+	self->stats_history_head  = ( self->stats_history_head + 1 ) % self->stats_history.size();
+	self->stats_history_count = std::min( self->stats_history_count + 1, self->stats_history.size() );
+}
+
+// ----------------------------------------------------------------------
+
+static uint32_t renderer_get_stats_history_count( le_renderer_o *self ) {
+	return uint32_t( self->stats_history_count );
+}
+
+// ----------------------------------------------------------------------
+
+static uint32_t renderer_get_gpu_frames_in_flight( le_renderer_o *self ) {
+	using namespace le_backend_vk;
+	return vk_backend_i.get_gpu_frames_in_flight( self->backend );
+}
+
+// ----------------------------------------------------------------------
+
+static uint32_t renderer_register_bindless_texture( le_renderer_o *self, le_texture_handle texture ) {
+	using namespace le_backend_vk;
+	return vk_backend_i.register_bindless_texture( self->backend, texture );
+}
+
+// ----------------------------------------------------------------------
+
+static uint32_t renderer_register_bindless_buffer( le_renderer_o *self, le_resource_handle_t const &buffer ) {
+	using namespace le_backend_vk;
+	return vk_backend_i.register_bindless_buffer( self->backend, buffer );
+}
+
+// ----------------------------------------------------------------------
+
+static void renderer_request_frame_capture( le_renderer_o *self, char const *path ) {
+	using namespace le_backend_vk;
+	vk_backend_i.request_frame_capture( self->backend, path );
+}
+
+// ----------------------------------------------------------------------
+
+static bool renderer_load_frame_capture( le_renderer_o *self, char const *path ) {
+	using namespace le_backend_vk;
+	return vk_backend_i.load_frame_capture( self->backend, path );
+}
+
+// ----------------------------------------------------------------------
+
+static uint32_t renderer_get_pipeline_depth( le_renderer_o *self ) {
+	return uint32_t( self->pipelineDepth );
+}
+
+// ----------------------------------------------------------------------
+// Returns average number of renderer updates between recording a frame and recycling it,
+// taken over stats history. Returns 0 if no frame has made it back from the gpu yet.
+static float renderer_get_achieved_latency( le_renderer_o *self ) {
+
+	if ( self->stats_history_count == 0 ) {
+		return 0.f;
+	}
+
+	uint64_t latency_sum = 0;
+
+	for ( size_t i = 0; i != self->stats_history_count; i++ ) {
+		latency_sum += self->stats_history[ i ].frame.latency_frames;
+	}
+
+	return float( double( latency_sum ) / double( self->stats_history_count ) );
+}
+
+// ----------------------------------------------------------------------
+// history_index 0 is most recent frame
+static FrameStats const &renderer_get_frame_stats_entry( le_renderer_o const *self, uint32_t history_index ) {
+	auto const &num_slots = self->stats_history.size();
+	return self->stats_history[ ( self->stats_history_head + num_slots - 1 - history_index ) % num_slots ];
+}
+
+// ----------------------------------------------------------------------
+
+static bool renderer_get_frame_stats( le_renderer_o *self, uint32_t history_index, le_frame_stats_t *p_frame_stats, le_renderpass_stats_t *p_pass_stats, uint32_t *p_pass_stats_count ) {
+
+	if ( history_index >= self->stats_history_count ) {
+		return false;
+	}
+
+	// ---------| invariant: history index refers to a valid entry
+
+	auto const &stats = renderer_get_frame_stats_entry( self, history_index );
+
+	if ( p_frame_stats ) {
+		*p_frame_stats = stats.frame;
+	}
+
+	if ( p_pass_stats_count ) {
+		if ( *p_pass_stats_count < stats.passes.size() || p_pass_stats == nullptr ) {
+			*p_pass_stats_count = uint32_t( stats.passes.size() );
+			return p_pass_stats == nullptr;
+		}
+		std::copy( stats.passes.begin(), stats.passes.end(), p_pass_stats );
+		*p_pass_stats_count = uint32_t( stats.passes.size() );
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+// Write a string as a json string literal (RFC 8259) - debug names are
+// user-provided, so we must escape them.
+static void write_json_string( std::ostream &os, char const *str ) {
+	static constexpr char hex_digits[] = "0123456789abcdef";
+
+	os << '"';
+	for ( char const *c = str; *c != 0; c++ ) {
+		unsigned char const ch = static_cast<unsigned char>( *c );
+		if ( ch == '"' || ch == '\\' ) {
+			os << '\\' << *c;
+		} else if ( ch < 0x20 ) {
+			// control characters must be escaped - we use the generic \u00XX form for all of them.
+			os << "\\u00" << hex_digits[ ch >> 4 ] << hex_digits[ ch & 0xf ];
+		} else {
+			os << *c;
+		}
+	}
+	os << '"';
+}
+
+// ----------------------------------------------------------------------
+// Write a string as a quoted csv field (RFC 4180) - embedded quotes get
+// doubled. Line breaks and commas may appear verbatim within quotes.
+static void write_csv_string( std::ostream &os, char const *str ) {
+	os << '"';
+	for ( char const *c = str; *c != 0; c++ ) {
+		if ( *c == '"' ) {
+			os << '"';
+		}
+		os << *c;
+	}
+	os << '"';
+}
+
+// ----------------------------------------------------------------------
+// Write stats history for all available frames, oldest frame first.
+static bool renderer_write_stats( le_renderer_o *self, char const *path, LeRendererStatsFormat const &format ) {
+
+	std::ofstream os( path, std::ios::out | std::ios::trunc );
+
+	if ( !os.is_open() ) {
+		std::cerr << "ERROR " << __PRETTY_FUNCTION__ << ": Could not open file for writing: '" << path << "'" << std::endl
+		          << std::flush;
+		return false;
+	}
+
+	// ---------| invariant: file is open for writing
+
+	if ( format == LeRendererStatsFormat::eCSV ) {
+
+		// One row per pass - frame columns are repeated for each pass.
+		os << "frame_number,latency_frames,record_ns,acquire_ns,process_ns,dispatch_ns,gpu_ns,command_bytes,peak_command_bytes,heap_allocations,argument_bytes_saved,descriptor_set_cache_hits,descriptor_set_cache_misses,transient_bytes_used,transient_bytes_capacity,transient_block_count,staging_bytes,staging_dedicated_bytes,staging_dedicated_count,"
+		   << "pass_name,pass_record_ns,pass_command_count,pass_command_bytes,pass_elided_command_count,pass_argument_bytes_saved,pass_gpu_ns"
+		   << std::endl;
+
+		for ( uint32_t i = uint32_t( self->stats_history_count ); i != 0; i-- ) {
+			auto const &stats = renderer_get_frame_stats_entry( self, i - 1 );
+			auto const &f     = stats.frame;
+
+			for ( size_t j = 0; j != std::max<size_t>( 1, stats.passes.size() ); j++ ) {
+
+				os << f.frame_number << ','
+				   << f.latency_frames << ','
+				   << f.record_time_ns << ','
+				   << f.acquire_time_ns << ','
+				   << f.process_time_ns << ','
+				   << f.dispatch_time_ns << ','
+				   << f.gpu_time_ns << ','
+				   << f.command_bytes << ','
+				   << f.peak_command_bytes << ','
+				   << f.heap_allocations << ','
+				   << f.argument_bytes_saved << ','
+				   << f.descriptor_set_cache_hits << ','
+				   << f.descriptor_set_cache_misses << ','
+				   << f.transient_bytes_used << ','
+				   << f.transient_bytes_capacity << ','
+				   << f.transient_block_count << ','
+				   << f.staging_bytes << ','
+				   << f.staging_dedicated_bytes << ','
+				   << f.staging_dedicated_count << ',';
+
+				if ( j < stats.passes.size() ) {
+					auto const &p = stats.passes[ j ];
+					write_csv_string( os, p.debug_name );
+					os << ','
+					   << p.record_time_ns << ','
+					   << p.command_count << ','
+					   << p.command_bytes << ','
+					   << p.elided_command_count << ','
+					   << p.argument_bytes_saved << ','
+					   << p.gpu_time_ns;
+				} else {
+					os << ",,,,,,"; // frame without passes
+				}
+
+				os << std::endl;
+			}
+		}
+
+	} else {
+
+		os << "[" << std::endl;
+
+		for ( uint32_t i = uint32_t( self->stats_history_count ); i != 0; i-- ) {
+			auto const &stats = renderer_get_frame_stats_entry( self, i - 1 );
+			auto const &f     = stats.frame;
+
+			os << "\t{ \"frame_number\": " << f.frame_number
+			   << ", \"latency_frames\": " << f.latency_frames
+			   << ", \"record_ns\": " << f.record_time_ns
+			   << ", \"acquire_ns\": " << f.acquire_time_ns
+			   << ", \"process_ns\": " << f.process_time_ns
+			   << ", \"dispatch_ns\": " << f.dispatch_time_ns
+			   << ", \"gpu_ns\": " << f.gpu_time_ns
+			   << ", \"command_bytes\": " << f.command_bytes
+			   << ", \"peak_command_bytes\": " << f.peak_command_bytes
+			   << ", \"heap_allocations\": " << f.heap_allocations
+			   << ", \"argument_bytes_saved\": " << f.argument_bytes_saved
+			   << ", \"descriptor_set_cache_hits\": " << f.descriptor_set_cache_hits
+			   << ", \"descriptor_set_cache_misses\": " << f.descriptor_set_cache_misses
+			   << ", \"transient_bytes_used\": " << f.transient_bytes_used
+			   << ", \"transient_bytes_capacity\": " << f.transient_bytes_capacity
+			   << ", \"transient_block_count\": " << f.transient_block_count
+			   << ", \"staging_bytes\": " << f.staging_bytes
+			   << ", \"staging_dedicated_bytes\": " << f.staging_dedicated_bytes
+			   << ", \"staging_dedicated_count\": " << f.staging_dedicated_count
+			   << ", \"passes\": [";
+
+			for ( size_t j = 0; j != stats.passes.size(); j++ ) {
+				auto const &p = stats.passes[ j ];
+				os << ( j ? ", " : " " ) << "{ \"name\": ";
+				write_json_string( os, p.debug_name );
+				os << ", \"record_ns\": " << p.record_time_ns
+				   << ", \"command_count\": " << p.command_count
+				   << ", \"command_bytes\": " << p.command_bytes
+				   << ", \"elided_command_count\": " << p.elided_command_count
+				   << ", \"argument_bytes_saved\": " << p.argument_bytes_saved
+				   << ", \"gpu_ns\": " << p.gpu_time_ns
+				   << " }";
+			}
+
+			os << " ] }" << ( i > 1 ? "," : "" ) << std::endl;
+		}
+
+		os << "]" << std::endl;
+	}
+
+	return os.good();
+}
+
+// ----------------------------------------------------------------------
+
+// Recycles frame resources once the gpu has finished processing the frame.
+//
+// If `may_block` is false, and the gpu has not yet finished processing the frame,
+// we return false immediately, and the frame stays in flight - it will then be
+// cleared by a later call. Returns true if frame is cleared.
+static bool renderer_clear_frame( le_renderer_o *self, size_t frameIndex, bool may_block ) {
 
 	auto &frame = self->frames[ frameIndex ];
 
@@ -283,7 +657,7 @@ static void renderer_clear_frame( le_renderer_o *self, size_t frameIndex ) {
 	using namespace le_renderer;   // for rendergraph_i
 
 	if ( frame.state == FrameData::State::eCleared ) {
-		return;
+		return true;
 	}
 
 	// ----------| invariant: frame was not yet cleared
@@ -293,18 +667,35 @@ static void renderer_clear_frame( le_renderer_o *self, size_t frameIndex ) {
 	     frame.state == FrameData::State::eFailedDispatch ||
 	     frame.state == FrameData::State::eFailedClear ) {
 
-		while ( false == vk_backend_i.poll_frame_fence( self->backend, frameIndex ) ) {
-			// Note: this call may block until the fence has been reached.
+		if ( false == vk_backend_i.poll_frame_fence( self->backend, frameIndex ) ) {
+
+			if ( false == may_block ) {
+				// Frame is still in flight.
+				return false;
+			}
+
+			// We wait in short intervals if we may yield to other jobs, otherwise
+			// we let the driver block until the fence has been reached.
+			while ( false == vk_backend_i.wait_frame_fence( self->backend, frameIndex, LE_MT > 0 ? 100'000 : 1'000'000'000 ) ) {
 #if ( LE_MT > 0 )
-			le_jobs::yield();
+				le_jobs::yield();
 #endif
+			}
 		}
 
+		// ----------| invariant: frame fence has been reached
+
 		bool result = vk_backend_i.clear_frame( self->backend, frameIndex );
 
 		if ( result != true ) {
 			frame.state = FrameData::State::eFailedClear;
-			return;
+			return false;
+		}
+
+		if ( frame.state == FrameData::State::eDispatched ) {
+			// Frame has made the full round trip - we must collect its stats before
+			// the rendergraph gets reset.
+			renderer_collect_frame_stats( self, frameIndex );
 		}
 	}
 
@@ -314,6 +705,8 @@ static void renderer_clear_frame( le_renderer_o *self, size_t frameIndex ) {
 	//	          << std::flush;
 
 	frame.state = FrameData::State::eCleared;
+
+	return true;
 }
 
 // ----------------------------------------------------------------------
@@ -516,12 +909,70 @@ static void renderer_get_swapchain_extent( le_renderer_o *self, uint32_t index,
 
 // ----------------------------------------------------------------------
 
+// Stages which renderer_update may run on a frame. If more than one stage applies to
+// the same frame, stages execute in the order in which they are listed here.
+enum FrameStageFlagBits : uint32_t {
+	FRAME_STAGE_PROCESS = 1u << 0, // acquire backend resources, process, and dispatch
+	FRAME_STAGE_CLEAR   = 1u << 1, // wait for frame to come back from gpu, and recycle its resources
+	FRAME_STAGE_RECORD  = 1u << 2, // record a new frame
+};
+
+struct frame_update_params_t {
+	le_renderer_o *     renderer;
+	size_t              frame_index;
+	uint32_t            stages; // FrameStageFlagBits
+	le_render_module_o *module;
+	size_t              frame_number;
+	le_jobs::counter_t *shader_counter; // recording must wait for this counter (if not nullptr)
+};
+
+// ----------------------------------------------------------------------
+
+static void renderer_update_frame( void *param_ ) {
+	auto p = static_cast<frame_update_params_t *>( param_ );
+
+	if ( p->stages & FRAME_STAGE_PROCESS ) {
+		// acquire external backend resources such as swapchain
+		// and create any temporary resources
+		renderer_acquire_backend_resources( p->renderer, p->frame_index );
+		// generate api commands for the frame
+		renderer_process_frame( p->renderer, p->frame_index );
+		// send api commands to GPU queue for processing
+		renderer_dispatch_frame( p->renderer, p->frame_index );
+	}
+
+	if ( p->stages & FRAME_STAGE_CLEAR ) {
+		// recycle frame if it has come back from the gpu - this does not block,
+		// frames which are still in flight get cleared before they are recorded.
+		renderer_clear_frame( p->renderer, p->frame_index, false );
+	}
+
+	if ( p->stages & FRAME_STAGE_RECORD ) {
+
+		// We must wait for the frame to come back from the gpu if it was not cleared yet.
+		// This is the only place where waiting for the gpu may block an update.
+		renderer_clear_frame( p->renderer, p->frame_index, true );
+
+#if ( LE_MT > 0 )
+		if ( p->shader_counter ) {
+			le_jobs::wait_for_counter_and_free( p->shader_counter, 0 );
+		}
+#endif
+		// generate an intermediary, api-agnostic, representation of the frame
+		renderer_record_frame( p->renderer, p->frame_index, p->module, p->frame_number );
+	}
+}
+
+// ----------------------------------------------------------------------
+
 static void renderer_update( le_renderer_o *self, le_render_module_o *module_ ) {
 
 	using namespace le_backend_vk; // for vk_backend_i
 
 	const auto &index     = self->currentFrameNumber;
-	const auto &numFrames = self->frames.size();
+	const auto &numFrames = self->frames.size(); // equals pipeline depth
+
+	le_jobs::counter_t *shader_counter = nullptr;
 
 	// If necessary, recompile and reload shader modules
 	// - this must be complete before the record_frame step
@@ -532,8 +983,7 @@ static void renderer_update( le_renderer_o *self, le_render_module_o *module_ )
 		vk_backend_i.update_shader_modules( static_cast<le_backend_o *>( backend ) );
 	};
 
-	le_jobs::job_t      j{ update_shader_modules_fun, self->backend };
-	le_jobs::counter_t *shader_counter;
+	le_jobs::job_t j{ update_shader_modules_fun, self->backend };
 
 	le_jobs::run_jobs( &j, 1, &shader_counter );
 
@@ -541,73 +991,61 @@ static void renderer_update( le_renderer_o *self, le_render_module_o *module_ )
 	vk_backend_i.update_shader_modules( self->backend );
 #endif
 
-	if ( LE_MT > 0 ) {
-#if ( LE_MT > 0 )
-		// use task system (experimental)
+	// Each frame moves through the pipeline one slot per update:
+	//
+	// + the frame at slot index+0 gets recorded,
+	// + the frame which was recorded in the previous update gets processed and dispatched,
+	// + the frame which will be recorded in the next update gets cleared, if it has
+	//   come back from the gpu - otherwise it gets cleared just before it is recorded.
+	//
+	// Any other frames are in flight on the gpu. With a pipeline depth of 2, the frame
+	// which gets dispatched is also the frame which gets cleared.
+
+	const size_t slot_record  = ( index + 0 ) % numFrames;
+	const size_t slot_process = ( index + numFrames - 1 ) % numFrames;
+	const size_t slot_clear   = ( index + 1 ) % numFrames;
+
+	// We keep slots in the order in which they run on the main thread.
+	std::array<frame_update_params_t, 3> updates{};
+	size_t                               num_updates = 0;
+
+	for ( auto const &[ slot, stage ] : { std::pair{ slot_record, FRAME_STAGE_RECORD },
+	                                      std::pair{ slot_process, FRAME_STAGE_PROCESS },
+	                                      std::pair{ slot_clear, FRAME_STAGE_CLEAR } } ) {
+		auto u = std::find_if( updates.begin(), updates.begin() + num_updates,
+		                       [ slot = slot ]( frame_update_params_t const &rhs ) { return rhs.frame_index == slot; } );
+		if ( u == updates.begin() + num_updates ) {
+			*u             = {};
+			u->renderer    = self;
+			u->frame_index = slot;
+			num_updates++;
+		}
+		u->stages |= stage;
+	}
 
-		struct frame_params_t {
-			le_renderer_o *renderer;
-			size_t         frame_index;
-		};
+	{
+		// Only the update which records may pick up module and shader counter
+		auto &u          = updates[ 0 ];
+		u.module         = module_;
+		u.frame_number   = self->currentFrameNumber;
+		u.shader_counter = shader_counter;
+	}
 
-		struct record_params_t {
-			le_renderer_o *     renderer;
-			size_t              frame_index;
-			le_render_module_o *module;
-			size_t              current_frame_number;
-			le_jobs::counter_t *shader_counter;
-		};
+	if ( LE_MT > 0 ) {
+#if ( LE_MT > 0 )
+		// use task system (experimental) - one job per frame which needs updating
 
-		auto record_frame_fun = []( void *param_ ) {
-			auto p = static_cast<record_params_t *>( param_ );
-			// generate an intermediary, api-agnostic, representation of the frame
+		std::array<le_jobs::job_t, 3> jobs;
 
-			le_jobs::wait_for_counter_and_free( p->shader_counter, 0 );
-			renderer_record_frame( p->renderer, p->frame_index, p->module, p->current_frame_number );
-		};
-
-		auto process_frame_fun = []( void *param_ ) {
-			auto p = static_cast<frame_params_t *>( param_ );
-			// acquire external backend resources such as swapchain
-			// and create any temporary resources
-			renderer_acquire_backend_resources( p->renderer, p->frame_index );
-			// generate api commands for the frame
-			renderer_process_frame( p->renderer, p->frame_index );
-			// send api commands to GPU queue for processing
-			renderer_dispatch_frame( p->renderer, p->frame_index );
-		};
-
-		auto clear_frame_fun = []( void *param_ ) {
-			auto p = static_cast<frame_params_t *>( param_ );
-			renderer_clear_frame( p->renderer, p->frame_index );
-		};
-
-		le_jobs::job_t jobs[ 3 ];
-
-		record_params_t record_frame_params;
-		record_frame_params.renderer             = self;
-		record_frame_params.frame_index          = ( index + 0 ) % numFrames;
-		record_frame_params.module               = module_;
-		record_frame_params.current_frame_number = self->currentFrameNumber;
-		record_frame_params.shader_counter       = shader_counter;
-
-		frame_params_t process_frame_params;
-		process_frame_params.renderer    = self;
-		process_frame_params.frame_index = ( index + 2 ) % numFrames;
-
-		frame_params_t clear_frame_params;
-		clear_frame_params.renderer    = self;
-		clear_frame_params.frame_index = ( index + 1 ) % numFrames;
-
-		jobs[ 0 ] = { process_frame_fun, &process_frame_params };
-		jobs[ 1 ] = { clear_frame_fun, &clear_frame_params };
-		jobs[ 2 ] = { record_frame_fun, &record_frame_params };
+		for ( size_t i = 0; i != num_updates; i++ ) {
+			jobs[ i ] = { renderer_update_frame, &updates[ i ] };
+		}
 
 		le_jobs::counter_t *counter;
 
 		assert( self->backend );
 
-		le_jobs::run_jobs( jobs, 3, &counter );
+		le_jobs::run_jobs( jobs.data(), uint32_t( num_updates ), &counter );
 
 		// we could theoretically do some more work on the main thread here...
 
@@ -617,18 +1055,9 @@ static void renderer_update( le_renderer_o *self, le_render_module_o *module_ )
 
 		// render on the main thread
 
-		renderer_record_frame( self, ( index + 0 ) % numFrames, module_, self->currentFrameNumber ); // generate an intermediary, api-agnostic, representation of the frame
-
-		// acquire external backend resources such as swapchain
-		// and create any temporary resources
-		renderer_acquire_backend_resources( self, ( index + 2 ) % numFrames );
-
-		// generate api commands for the frame
-		renderer_process_frame( self, ( index + 2 ) % numFrames );
-
-		renderer_dispatch_frame( self, ( index + 2 ) % numFrames );
-
-		renderer_clear_frame( self, ( index + 1 ) % numFrames ); // wait for frame to come back (important to do this last, as it may block...)
+		for ( size_t i = 0; i != num_updates; i++ ) {
+			renderer_update_frame( &updates[ i ] );
+		}
 	}
 
 	if ( self->swapchainDirty ) {
@@ -643,9 +1072,9 @@ static void renderer_update( le_renderer_o *self, le_render_module_o *module_ )
 		for ( size_t i = 0; i != self->frames.size(); ++i ) {
 			if ( self->frames[ i ].state == FrameData::State::eProcessed ) {
 				renderer_dispatch_frame( self, i );
-				renderer_clear_frame( self, i );
+				renderer_clear_frame( self, i, true );
 			} else if ( self->frames[ i ].state != FrameData::State::eDispatched ) {
-				renderer_clear_frame( self, i );
+				renderer_clear_frame( self, i, true );
 			}
 		}
 
@@ -710,6 +1139,7 @@ LE_MODULE_REGISTER_IMPL( le_renderer, api ) {
 	le_renderer_i.setup                  = renderer_setup;
 	le_renderer_i.update                 = renderer_update;
 	le_renderer_i.create_shader_module   = renderer_create_shader_module;
+	le_renderer_i.create_shader_modules  = renderer_create_shader_modules;
 	le_renderer_i.get_swapchain_count    = renderer_get_swapchain_count;
 	le_renderer_i.get_swapchain_resource = renderer_get_swapchain_resource;
 	le_renderer_i.get_swapchain_extent   = renderer_get_swapchain_extent;
@@ -722,6 +1152,20 @@ LE_MODULE_REGISTER_IMPL( le_renderer, api ) {
 	le_renderer_i.create_rtx_blas_info   = renderer_create_rtx_blas_info_handle;
 	le_renderer_i.create_rtx_tlas_info   = renderer_create_rtx_tlas_info_handle;
 
+	le_renderer_i.register_bindless_texture = renderer_register_bindless_texture;
+	le_renderer_i.register_bindless_buffer  = renderer_register_bindless_buffer;
+
+	le_renderer_i.get_stats_history_count = renderer_get_stats_history_count;
+	le_renderer_i.get_frame_stats         = renderer_get_frame_stats;
+	le_renderer_i.write_stats             = renderer_write_stats;
+	le_renderer_i.get_pipeline_depth      = renderer_get_pipeline_depth;
+	le_renderer_i.get_achieved_latency    = renderer_get_achieved_latency;
+
+	le_renderer_i.get_gpu_frames_in_flight = renderer_get_gpu_frames_in_flight;
+
+	le_renderer_i.request_frame_capture = renderer_request_frame_capture;
+	le_renderer_i.load_frame_capture    = renderer_load_frame_capture;
+
 	auto &helpers_i = le_renderer_api_i->helpers_i;
 
 	helpers_i.get_default_resource_info_for_buffer = get_default_resource_info_for_buffer;
@@ -730,6 +1174,15 @@ LE_MODULE_REGISTER_IMPL( le_renderer, api ) {
 	if ( le_renderer_i.le_texture_handle_store ) {
 		texture_handle_library = le_renderer_i.le_texture_handle_store;
 	}
+
+#if ( LE_RESOURCE_NAME_REGISTRY )
+	// Handles declared in le_renderer_types.h don't register their own names - we do this here, once.
+	for ( auto const &name : LE_SWAPCHAIN_IMAGE_NAMES ) {
+		le_update_resource_name_table( name, hash_32_fnv1a_const( name ) );
+	}
+	le_update_resource_name_table( LE_RTX_SCRATCH_BUFFER_NAME, hash_32_fnv1a_const( LE_RTX_SCRATCH_BUFFER_NAME ) );
+#endif
+
 	// register sub-components of this api
 	register_le_rendergraph_api( api );
 
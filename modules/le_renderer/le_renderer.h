@@ -11,6 +11,7 @@ struct le_render_module_o;
 struct le_renderpass_o;
 struct le_rendergraph_o;
 struct le_command_buffer_encoder_o;
+struct le_command_buffer_encoder_pool_o; ///< pools encoders and their command stream memory, one pool per frame
 struct le_backend_o;
 struct le_shader_module_o; ///< shader module, 1:1 relationship with a shader source file
 struct le_pipeline_manager_o;
@@ -29,6 +30,7 @@ struct le_renderer_api {
 		void                           ( *setup                                 )( le_renderer_o *obj, le_renderer_settings_t const & settings );
 		void                           ( *update                                )( le_renderer_o *obj, le_render_module_o *module );
         le_shader_module_o*            ( *create_shader_module                  )( le_renderer_o *self, char const *path, const LeShaderStageEnum& mtype, char const * macro_definitions );
+        void                           ( *create_shader_modules                 )( le_renderer_o *self, char const * const *paths, LeShaderStageEnum const * mtypes, char const * const * macro_definitions, size_t num_modules, le_shader_module_o** modules );
 
 		/// returns the image resource handle for a swapchain at given index
 		uint32_t                       ( *get_swapchain_count                   )( le_renderer_o* self);
@@ -44,6 +46,29 @@ struct le_renderer_api {
 
 		le_rtx_blas_info_handle        ( *create_rtx_blas_info ) (le_renderer_o* self, le_rtx_geometry_t* geometries, uint32_t geometries_count, LeBuildAccelerationStructureFlags const * flags);
 		le_rtx_tlas_info_handle        ( *create_rtx_tlas_info ) (le_renderer_o* self, uint32_t instances_count, LeBuildAccelerationStructureFlags const * flags);
+
+		/// Bindless mode: returns a stable array index for a texture (or buffer) in the global bindless descriptor set,
+		/// which shaders may use to index into the set's runtime-sized arrays. Textures must still be declared via
+		/// `sampleTexture`, and buffers must still be used by the pass which accesses them, so that they get synchronised.
+		uint32_t                       ( *register_bindless_texture             )( le_renderer_o* self, le_texture_handle texture );
+		uint32_t                       ( *register_bindless_buffer              )( le_renderer_o* self, le_resource_handle_t const & buffer );
+
+		/// Frame statistics are kept for the most recent frames which made it back from the gpu. `history_index` 0 is the most recent frame.
+		/// If `p_pass_stats_count` is smaller than the number of available pass stats, it gets updated to the required count, and we return false.
+		uint32_t                       ( *get_stats_history_count               )( le_renderer_o* self );
+		bool                           ( *get_frame_stats                       )( le_renderer_o* self, uint32_t history_index, le_frame_stats_t* p_frame_stats, le_renderpass_stats_t* p_pass_stats, uint32_t* p_pass_stats_count );
+		bool                           ( *write_stats                           )( le_renderer_o* self, char const * path, LeRendererStatsFormat const & format );
+
+		/// pipeline depth is the number of frames in flight, from record until the frame has come back from the gpu.
+		uint32_t                       ( *get_pipeline_depth                    )( le_renderer_o* self );
+		float                          ( *get_achieved_latency                  )( le_renderer_o* self ); // average, in frames
+		uint32_t                       ( *get_gpu_frames_in_flight              )( le_renderer_o* self ); // frames submitted to, but not yet completed by the gpu
+
+		/// Frame capture: command streams, and transient data of the next frame to be processed get written to `path`.
+		/// Once a capture is loaded, frames which have the same passes as the capture get processed using the captured
+		/// command streams instead of their own. Captures may only be loaded by the process which wrote them. nullptr unloads.
+		void                           ( *request_frame_capture                 )( le_renderer_o* self, char const * path );
+		bool                           ( *load_frame_capture                    )( le_renderer_o* self, char const * path );
 	};
 
 
@@ -115,6 +140,7 @@ struct le_renderer_api {
 
 		void                 ( *get_passes             ) ( le_rendergraph_o *self, le_renderpass_o ***pPasses, size_t *pNumPasses );
 		void                 ( *get_declared_resources ) ( le_rendergraph_o *self, le_resource_handle_t const **p_resource_handles, le_resource_info_t const **p_resource_infos, size_t *p_resource_count );
+		void                 ( *get_pass_stats         ) ( le_rendergraph_o *self, le_renderpass_stats_t const **p_stats, size_t *p_stats_count );
 	};
 
 	struct command_buffer_encoder_interface_t {
@@ -125,7 +151,7 @@ struct le_renderer_api {
    	         uint64_t             offset;
         };
 
-		le_command_buffer_encoder_o *( *create                 )( le_allocator_o **allocator, le_pipeline_manager_o* pipeline_cache, le_staging_allocator_o* stagingAllocator, le::Extent2D const& extent );
+		le_command_buffer_encoder_o *( *create                 )( le_command_buffer_encoder_pool_o* pool, le_allocator_o **allocator, le_pipeline_manager_o* pipeline_cache, le_staging_allocator_o* stagingAllocator, le::Extent2D const& extent );
 		void                         ( *destroy                )( le_command_buffer_encoder_o *obj );
 
 		void                         ( *draw                   )( le_command_buffer_encoder_o *self, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance );
@@ -180,6 +206,28 @@ struct le_renderer_api {
 
 		le_pipeline_manager_o*       ( *get_pipeline_manager   )( le_command_buffer_encoder_o *self );
 		void                         ( *get_encoded_data       )( le_command_buffer_encoder_o *self, void **data, size_t *numBytes, size_t *numCommands );
+
+		// Returns number of commands which were dropped because they would not have changed any state - e.g. re-binding the currently bound pipeline.
+		size_t                       ( *get_elided_command_count )( le_command_buffer_encoder_o *self );
+
+		// Returns number of bytes of argument data which did not have to be written to transient memory, because identical data had been written before during the same frame.
+		size_t                       ( *get_argument_bytes_saved )( le_command_buffer_encoder_o *self );
+
+		// Draw lists: commands recorded between begin_draw_list and end_draw_list are grouped into draw items,
+		// one item per call to set_draw_sort_key. Items are sorted by key when the draw list ends, and only then
+		// added to the command stream. Each item must set all state it depends upon - see le::make_draw_sort_key.
+		void                         ( *begin_draw_list        )( le_command_buffer_encoder_o *self );
+		void                         ( *set_draw_sort_key      )( le_command_buffer_encoder_o *self, uint64_t sort_key );
+		void                         ( *end_draw_list          )( le_command_buffer_encoder_o *self );
+
+		// Encoder pools are not thread-safe: a pool must only be used by one thread at a time.
+		// Encoders acquired from a pool are owned by the pool, and stay valid until the pool gets reset.
+		// Encoders created via create() may optionally draw their command stream memory from a pool, too.
+		le_command_buffer_encoder_pool_o* ( *create_pool                    )();
+		void                              ( *destroy_pool                   )( le_command_buffer_encoder_pool_o* pool );
+		void                              ( *reset_pool                     )( le_command_buffer_encoder_pool_o* pool ); // O(1), keeps capacity
+		le_command_buffer_encoder_o*      ( *acquire_from_pool              )( le_command_buffer_encoder_pool_o* pool, le_allocator_o **allocator, le_pipeline_manager_o* pipeline_cache, le_staging_allocator_o* stagingAllocator, le::Extent2D const& extent );
+		uint64_t                          ( *get_pool_heap_allocation_count )( le_command_buffer_encoder_pool_o* pool ); // running count, should not change over steady-state frames
 	};
 
 	renderer_interface_t               le_renderer_i;
@@ -239,6 +287,12 @@ class Renderer {
 		return le_renderer::renderer_i.create_shader_module( self, path, { moduleType }, macro_definitions );
 	}
 
+	// Compiles shader modules concurrently - prefer this over repeated calls to createShaderModule
+	// when creating many modules, or many permutations of a module, at once.
+	void createShaderModules( char const *const *paths, LeShaderStageEnum const *moduleTypes, char const *const *macro_definitions, size_t numModules, le_shader_module_o **modules ) const {
+		le_renderer::renderer_i.create_shader_modules( self, paths, moduleTypes, macro_definitions, numModules, modules );
+	}
+
 	uint32_t getSwapchainCount() const {
 		return le_renderer::renderer_i.get_swapchain_count( self );
 	}
@@ -265,6 +319,26 @@ class Renderer {
 		return le_renderer::renderer_i.produce_texture_handle( maybe_name );
 	}
 
+	uint32_t registerBindlessTexture( le_texture_handle texture ) const {
+		return le_renderer::renderer_i.register_bindless_texture( self, texture );
+	}
+
+	uint32_t registerBindlessBuffer( le_resource_handle_t const &buffer ) const {
+		return le_renderer::renderer_i.register_bindless_buffer( self, buffer );
+	}
+
+	bool writeStats( char const *path, LeRendererStatsFormat const &format = LeRendererStatsFormat::eCSV ) const {
+		return le_renderer::renderer_i.write_stats( self, path, format );
+	}
+
+	void requestFrameCapture( char const *path ) const {
+		le_renderer::renderer_i.request_frame_capture( self, path );
+	}
+
+	bool loadFrameCapture( char const *path ) const {
+		return le_renderer::renderer_i.load_frame_capture( self, path );
+	}
+
 	operator auto() {
 		return self;
 	}
@@ -684,6 +758,25 @@ class Encoder {
 		return *this;
 	}
 
+	/// \brief Begin recording draw items into a draw list - draw items get sorted by their sort key once the draw list ends.
+	/// \note Each draw item must set all state it depends upon, as items may get re-ordered.
+	Encoder &beginDrawList() {
+		le_renderer::encoder_i.begin_draw_list( self );
+		return *this;
+	}
+
+	/// \brief Start a new draw item, all following commands until the next call to setDrawSortKey() belong to this item.
+	Encoder &setDrawSortKey( uint64_t const &sortKey ) {
+		le_renderer::encoder_i.set_draw_sort_key( self, sortKey );
+		return *this;
+	}
+
+	/// \brief Sort draw items, and add their commands to the command stream.
+	Encoder &endDrawList() {
+		le_renderer::encoder_i.end_draw_list( self );
+		return *this;
+	}
+
 	class ShaderBindingTableBuilder {
 		Encoder const &            parent;
 		le_shader_binding_table_o *sbt = nullptr;
@@ -12,6 +12,8 @@
 #include <filesystem>
 #include <sstream>
 #include <array>
+#include <chrono>
+#include <cstring>
 
 #include "le_renderer/private/le_renderer_types.h"
 
@@ -95,10 +97,12 @@ struct le_render_module_o : NoCopy, NoMove {
 // ----------------------------------------------------------------------
 
 struct le_rendergraph_o : NoCopy, NoMove {
-	std::vector<le_renderpass_o *>    passes;
-	std::vector<uint32_t>             sortIndices;
-	std::vector<le_resource_handle_t> declared_resources_id;   // | pre-declared resources (declared via module)
-	std::vector<le_resource_info_t>   declared_resources_info; // | pre-declared resources (declared via module)
+	std::vector<le_renderpass_o *>     passes;
+	std::vector<uint32_t>              sortIndices;
+	std::vector<le_resource_handle_t>  declared_resources_id;   // | pre-declared resources (declared via module)
+	std::vector<le_resource_info_t>    declared_resources_info; // | pre-declared resources (declared via module)
+	std::vector<le_renderpass_stats_t> pass_stats;              // one entry per pass which was recorded in execute()
+	le_command_buffer_encoder_pool_o * encoder_pool = nullptr;  // owning: encoders for passes recorded in execute(), reset with rendergraph
 };
 
 // ----------------------------------------------------------------------
@@ -125,10 +129,8 @@ static le_renderpass_o *renderpass_clone( le_renderpass_o const *rhs ) {
 
 static void renderpass_destroy( le_renderpass_o *self ) {
 
-	if ( self->encoder ) {
-		using namespace le_renderer;
-		encoder_i.destroy( self->encoder );
-	}
+	// Note that we don't destroy the encoder, as encoders are owned
+	// by the rendergraph's encoder pool.
 
 	delete self;
 }
@@ -221,7 +223,7 @@ static void renderpass_use_resource( le_renderpass_o *self, const le_resource_ha
 
 		// Resource already exists.
 
-		std::cerr << "FATAL: Resource '" << resource_id.debug_name << "' declared more than once for renderpass : '"
+		std::cerr << "FATAL: Resource '" << resource_id.getDebugName() << "' declared more than once for renderpass : '"
 		          << self->debugName << "'. There can only be one declaration per resource per renderpass." << std::endl
 		          << std::flush;
 
@@ -447,7 +449,7 @@ static bool renderpass_has_setup_callback( const le_renderpass_o *self ) {
 	return self->callbackSetup != nullptr;
 }
 
-/// @warning Encoder becomes the thief's worry to destroy!
+/// @note Encoder remains owned by the rendergraph's encoder pool, and stays valid until the rendergraph gets reset.
 /// @returns null if encoder was already stolen, otherwise a pointer to an encoder object
 le_command_buffer_encoder_o *renderpass_steal_encoder( le_renderpass_o *self ) {
 	auto result   = self->encoder;
@@ -458,7 +460,9 @@ le_command_buffer_encoder_o *renderpass_steal_encoder( le_renderpass_o *self ) {
 // ----------------------------------------------------------------------
 
 static le_rendergraph_o *rendergraph_create() {
-	auto obj = new le_rendergraph_o();
+	using namespace le_renderer; // for encoder_i
+	auto obj          = new le_rendergraph_o();
+	obj->encoder_pool = encoder_i.create_pool();
 	return obj;
 }
 
@@ -474,12 +478,18 @@ static void rendergraph_reset( le_rendergraph_o *self ) {
 
 	self->declared_resources_id.clear();
 	self->declared_resources_info.clear();
+	self->pass_stats.clear();
+
+	using namespace le_renderer; // for encoder_i
+	encoder_i.reset_pool( self->encoder_pool ); // O(1) - encoders keep their memory for the next frame
 }
 
 // ----------------------------------------------------------------------
 
 static void rendergraph_destroy( le_rendergraph_o *self ) {
+	using namespace le_renderer; // for encoder_i
 	rendergraph_reset( self );
+	encoder_i.destroy_pool( self->encoder_pool );
 	delete self;
 }
 
@@ -656,7 +666,7 @@ generate_dot_file_for_rendergraph(
 		for ( size_t j = 0; j != p->resources.size(); j++ ) {
 			os << "<td cellpadding='3' port=\"";
 			auto const &r = p->resources[ j ];
-			os << r.debug_name << "\">";
+			os << r.getDebugName() << "\">";
 
 			{
 				auto const needle = r;
@@ -672,9 +682,9 @@ generate_dot_file_for_rendergraph(
 				// if resource is being written to, then underline resource name
 
 				if ( tasks[ i ].writes[ res_idx ] ) {
-					os << "<u>" << r.debug_name << "</u>";
+					os << "<u>" << r.getDebugName() << "</u>";
 				} else {
-					os << "" << r.debug_name << "";
+					os << "" << r.getDebugName() << "";
 				}
 			}
 
@@ -750,10 +760,10 @@ generate_dot_file_for_rendergraph(
 				     ( tasks[ k ].writes & tasks[ k ].reads & res_filter ).any() ) {
 
 					os << "\"" << p->debugName << "\":"
-					   << "\"" << needle.debug_name << "\""
+					   << "\"" << needle.getDebugName() << "\""
 					   << ":s"
 					   << " -> \"" << self->passes[ k ]->debugName << "\":"
-					   << "\"" << needle.debug_name << "\""
+					   << "\"" << needle.getDebugName() << "\""
 					   << ":n"
 					   << ( self->sortIndices[ k ] == ( ~0u ) ? "[style=dashed]" : "" )
 					   << ";" << std::endl;
@@ -986,7 +996,7 @@ static void rendergraph_execute( le_rendergraph_o *self, size_t frameIndex, le_b
 			renderpass_get_image_attachments( pass, &pImageAttachments, &pResources, &numImageAttachments );
 
 			for ( size_t i = 0; i != numImageAttachments; ++i ) {
-				msg << "\t Attachment: '" << pResources[ i ].debug_name << std::endl; //"', last written to in pass: '" << pass_id_to_handle[ attachment->source_id ] << "'" << std::endl;
+				msg << "\t Attachment: '" << pResources[ i ].getDebugName() << std::endl; //"', last written to in pass: '" << pass_id_to_handle[ attachment->source_id ] << "'" << std::endl;
 				msg << "\t load : " << std::setw( 10 ) << to_str( pImageAttachments[ i ].loadOp ) << std::endl;
 				msg << "\t store: " << std::setw( 10 ) << to_str( pImageAttachments[ i ].storeOp ) << std::endl
 				    << std::endl;
@@ -1080,7 +1090,9 @@ static void rendergraph_execute( le_rendergraph_o *self, size_t frameIndex, le_b
 				pass->height = pass_extents.height = swapchain_image_height[ matching_swapchain_idx ];
 			}
 
-			pass->encoder = encoder_i.create( ppAllocators, pipelineCache, stagingAllocator, pass_extents ); // NOTE: we must manually track the lifetime of encoder!
+			uint64_t const heap_allocation_count_start = encoder_i.get_pool_heap_allocation_count( self->encoder_pool );
+
+			pass->encoder = encoder_i.acquire_from_pool( self->encoder_pool, ppAllocators, pipelineCache, stagingAllocator, pass_extents ); // NOTE: encoder is owned by pool
 
 			if ( pass->type == LeRenderPassType::LE_RENDER_PASS_TYPE_DRAW ) {
 
@@ -1099,7 +1111,35 @@ static void rendergraph_execute( le_rendergraph_o *self, size_t frameIndex, le_b
 				encoder_i.set_viewport( pass->encoder, 0, 1, default_viewport );
 			}
 
+			auto time_record_start = std::chrono::high_resolution_clock::now();
+
 			renderpass_run_execute_callbacks( pass ); // record draw commands into encoder
+
+			auto time_record_end = std::chrono::high_resolution_clock::now();
+
+			{
+				// Store statistics for this pass
+
+				le_renderpass_stats_t stats{};
+
+				stats.pass_id        = pass->id;
+				stats.record_time_ns = uint64_t( std::chrono::duration_cast<std::chrono::nanoseconds>( time_record_end - time_record_start ).count() );
+
+				void * cmd_data      = nullptr;
+				size_t cmd_data_size = 0;
+				size_t cmd_count     = 0;
+				encoder_i.get_encoded_data( pass->encoder, &cmd_data, &cmd_data_size, &cmd_count );
+
+				stats.command_bytes        = cmd_data_size;
+				stats.command_count        = cmd_count;
+				stats.heap_allocations     = encoder_i.get_pool_heap_allocation_count( self->encoder_pool ) - heap_allocation_count_start;
+				stats.elided_command_count = encoder_i.get_elided_command_count( pass->encoder );
+				stats.argument_bytes_saved = encoder_i.get_argument_bytes_saved( pass->encoder );
+
+				strncpy( stats.debug_name, pass->debugName.c_str(), LE_RENDERPASS_STATS_DEBUG_NAME_MAX_LEN );
+
+				self->pass_stats.emplace_back( stats );
+			}
 		}
 	}
 
@@ -1123,6 +1163,13 @@ static void rendergraph_get_declared_resources( le_rendergraph_o *self, le_resou
 
 // ----------------------------------------------------------------------
 
+static void rendergraph_get_pass_stats( le_rendergraph_o *self, le_renderpass_stats_t const **p_stats, size_t *p_stats_count ) {
+	*p_stats       = self->pass_stats.data();
+	*p_stats_count = self->pass_stats.size();
+}
+
+// ----------------------------------------------------------------------
+
 static le_render_module_o *render_module_create() {
 	auto obj = new le_render_module_o();
 	return obj;
@@ -1209,6 +1256,7 @@ void register_le_rendergraph_api( void *api_ ) {
 	le_rendergraph_i.execute                = rendergraph_execute;
 	le_rendergraph_i.get_passes             = rendergraph_get_passes;
 	le_rendergraph_i.get_declared_resources = rendergraph_get_declared_resources;
+	le_rendergraph_i.get_pass_stats         = rendergraph_get_pass_stats;
 
 	auto &le_renderpass_i                        = le_renderer_api_i->le_renderpass_i;
 	le_renderpass_i.create                       = renderpass_create;
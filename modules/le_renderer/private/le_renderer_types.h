@@ -18,7 +18,20 @@
 		}                                                              \
 	}
 
-#define LE_RESOURCE_LABEL_LENGTH 32 // (no-hotreload) set to zero to disable storing name (for debug printouts) with resource handles
+// Resource handles only store a hash of their name, so that they fit into 64 bits. Names (for debug
+// printouts) are kept out-of-line, in a name registry provided by le_core. Set to zero to compile out
+// the registry - `LE_RESOURCE()` may then be evaluated at compile-time.
+#ifndef LE_RESOURCE_NAME_REGISTRY
+#	ifndef NDEBUG
+#		define LE_RESOURCE_NAME_REGISTRY 1
+#	else
+#		define LE_RESOURCE_NAME_REGISTRY 0
+#	endif
+#endif
+
+#if ( LE_RESOURCE_NAME_REGISTRY )
+#	include <atomic>
+#endif
 
 enum class LeResourceType : uint8_t {
 	eUndefined = 0,
@@ -78,13 +91,18 @@ struct le_resource_handle_t {
 		return handle.as_data;
 	}
 
-#if LE_RESOURCE_LABEL_LENGTH > 0
-	char debug_name[ LE_RESOURCE_LABEL_LENGTH ];
+	// Returns resource name, if it could be looked up from the resource name registry.
+	inline char const *getDebugName() const noexcept {
+#if ( LE_RESOURCE_NAME_REGISTRY )
+		return le_get_resource_name_from_hash( handle.as_handle.name_hash );
 #else
-	char const *debug_name = "unknown";
+		return "unknown";
 #endif
+	}
 };
 
+static_assert( sizeof( le_resource_handle_t ) == sizeof( uint64_t ), "resource handle must be 64 bit of size." );
+
 static inline bool operator==( le_resource_handle_t const &lhs, le_resource_handle_t const &rhs ) noexcept {
 	return lhs.handle.as_data == rhs.handle.as_data;
 }
@@ -93,72 +111,100 @@ static inline bool operator!=( le_resource_handle_t const &lhs, le_resource_hand
 	return !( lhs == rhs );
 }
 
-constexpr le_resource_handle_t LE_RESOURCE( const char *const str, const LeResourceType tp ) noexcept {
+// Returns handle for resource with name `str` - does not register the name with the resource name registry.
+constexpr le_resource_handle_t le_resource_handle_from_name( const char *const str, const LeResourceType tp ) noexcept {
 	le_resource_handle_t h{};
 	h.handle.as_handle.name_hash         = hash_32_fnv1a_const( str );
 	h.handle.as_handle.meta.as_meta.type = tp;
+	return h;
+}
 
-#if ( LE_RESOURCE_LABEL_LENGTH > 0 )
-	auto c = str;
-	int  i = 0;
-	while ( *c != '\0' ) {
-		if ( i == LE_RESOURCE_LABEL_LENGTH - 1 ) {
-			// If given string is longer than length reserved for label, we must
-			// push everything forward, and insert at the end, so that the label
-			// is more likely to contain the most significant elements.
-			for ( int j = 0; j != LE_RESOURCE_LABEL_LENGTH - 2; ++j ) {
-				h.debug_name[ j ] = h.debug_name[ j + 1 ];
-				h.debug_name[ 0 ] = char( 0xE2 ); // 0xE2 0x80 0xA6 -- utf-8 ellipsis
-				h.debug_name[ 1 ] = char( 0x80 );
-				h.debug_name[ 2 ] = char( 0xA6 );
-			}
-			i = LE_RESOURCE_LABEL_LENGTH - 2;
-		}
-		h.debug_name[ i++ ] = *c++;
+#if ( LE_RESOURCE_NAME_REGISTRY )
+
+// Registers name for handle with the resource name registry, unless `last_registered_hash` shows that
+// the same name has already been registered from the same call site.
+inline le_resource_handle_t le_resource_handle_register_name( le_resource_handle_t const &h, const char *const str, std::atomic<uint64_t> &last_registered_hash ) noexcept {
+	if ( last_registered_hash.load( std::memory_order_relaxed ) != h.handle.as_handle.name_hash ) {
+		le_update_resource_name_table( str, h.handle.as_handle.name_hash );
+		last_registered_hash.store( h.handle.as_handle.name_hash, std::memory_order_relaxed );
 	}
-#else
-	h.debug_name           = str;
-#endif
 	return h;
 }
 
+// Each call site of `LE_RESOURCE()` keeps a function-local static which holds the name hash it
+// registered last, so that it only takes the registry's lock when it sees a name for the first
+// time. Calls which repeat (from a render callback, say) cost no more than hashing the name.
+#	define LE_RESOURCE( str, tp )                                                                      \
+		( []( const char *const name_, const LeResourceType tp_ ) noexcept {                            \
+			static std::atomic<uint64_t> last_registered_hash{ ~uint64_t( 0 ) };                        \
+			return le_resource_handle_register_name( le_resource_handle_from_name( name_, tp_ ), name_, \
+			                                         last_registered_hash );                            \
+		}( ( str ), ( tp ) ) )
+
+#else
+
+// Resource handles are evaluated at compile-time.
+#	define LE_RESOURCE( str, tp ) le_resource_handle_from_name( ( str ), ( tp ) )
+
+#endif
+
 struct LeResourceHandleIdentity {
 	inline uint64_t operator()( const le_resource_handle_t &key_ ) const noexcept {
 		return key_.handle.as_data;
 	}
 };
 
-constexpr le_resource_handle_t LE_IMG_RESOURCE( const char *str ) noexcept {
-	return LE_RESOURCE( str, LeResourceType::eImage );
-}
+#define LE_IMG_RESOURCE( str ) LE_RESOURCE( str, LeResourceType::eImage )
+#define LE_BUF_RESOURCE( str ) LE_RESOURCE( str, LeResourceType::eBuffer )
 
-constexpr le_resource_handle_t LE_BUF_RESOURCE( const char *str ) noexcept {
-	return LE_RESOURCE( str, LeResourceType::eBuffer );
-}
+// Handles declared in this header don't register their names: with LE_RESOURCE(), every translation
+// unit which includes this header would register them again during static initialisation. Instead,
+// le_renderer registers these names once, when it gets loaded.
+constexpr static uint32_t LE_SWAPCHAIN_HANDLES_COUNT = 16;
+
+constexpr static char const *LE_SWAPCHAIN_IMAGE_NAMES[ LE_SWAPCHAIN_HANDLES_COUNT ] = {
+    "Le_Swapchain_Image_Handle[0]",
+    "Le_Swapchain_Image_Handle[1]",
+    "Le_Swapchain_Image_Handle[2]",
+    "Le_Swapchain_Image_Handle[3]",
+    "Le_Swapchain_Image_Handle[4]",
+    "Le_Swapchain_Image_Handle[5]",
+    "Le_Swapchain_Image_Handle[6]",
+    "Le_Swapchain_Image_Handle[7]",
+    "Le_Swapchain_Image_Handle[8]",
+    "Le_Swapchain_Image_Handle[9]",
+    "Le_Swapchain_Image_Handle[10]",
+    "Le_Swapchain_Image_Handle[11]",
+    "Le_Swapchain_Image_Handle[12]",
+    "Le_Swapchain_Image_Handle[13]",
+    "Le_Swapchain_Image_Handle[14]",
+    "Le_Swapchain_Image_Handle[15]",
+};
+
+constexpr static char const LE_RTX_SCRATCH_BUFFER_NAME[] = "le_rtx_scratch_buffer_handle";
 
-constexpr static le_resource_handle_t LE_SWAPCHAIN_IMAGE_HANDLE  = LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[0]" ); // default opaque swapchain image handle
-constexpr static uint32_t             LE_SWAPCHAIN_HANDLES_COUNT = 16;
+static const le_resource_handle_t LE_SWAPCHAIN_IMAGE_HANDLE = le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 0 ], LeResourceType::eImage ); // default opaque swapchain image handle
 
-constexpr static le_resource_handle_t LE_SWAPCHAIN_IMAGE_HANDLES[ LE_SWAPCHAIN_HANDLES_COUNT ] = {
+static const le_resource_handle_t LE_SWAPCHAIN_IMAGE_HANDLES[ LE_SWAPCHAIN_HANDLES_COUNT ] = {
     LE_SWAPCHAIN_IMAGE_HANDLE,
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[1]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[2]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[3]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[4]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[5]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[6]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[7]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[8]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[9]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[10]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[11]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[12]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[13]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[14]" ),
-    LE_IMG_RESOURCE( "Le_Swapchain_Image_Handle[15]" ),
-};
-
-constexpr static le_resource_handle_t LE_RTX_SCRATCH_BUFFER_HANDLE = LE_BUF_RESOURCE( "le_rtx_scratch_buffer_handle" ); // opaque handle for rtx scratch buffer
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 1 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 2 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 3 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 4 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 5 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 6 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 7 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 8 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 9 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 10 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 11 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 12 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 13 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 14 ], LeResourceType::eImage ),
+    le_resource_handle_from_name( LE_SWAPCHAIN_IMAGE_NAMES[ 15 ], LeResourceType::eImage ),
+};
+
+static const le_resource_handle_t LE_RTX_SCRATCH_BUFFER_HANDLE = le_resource_handle_from_name( LE_RTX_SCRATCH_BUFFER_NAME, LeResourceType::eBuffer ); // opaque handle for rtx scratch buffer
 
 enum LeRenderPassType : uint32_t {
 	LE_RENDER_PASS_TYPE_UNDEFINED = 0,
@@ -1056,8 +1102,14 @@ struct le_renderer_settings_t {
 	uint32_t                requested_device_extensions_count = 0;       //
 	le_swapchain_settings_t swapchain_settings[ 16 ]          = {};
 	size_t                  num_swapchain_settings            = 1;
+	uint32_t                pipeline_depth                    = 3;     // number of frames in flight, from record to gpu completion: 2 (lowest latency) .. number of swapchain images (highest throughput)
+	bool                    bindless_descriptors              = false; // opt-in: enables descriptor indexing, and a global descriptor set for registered textures and buffers
 };
 
+// Returned for textures and buffers registered for bindless access if bindless mode is not enabled,
+// or if the bindless descriptor set has no more array elements available.
+constexpr uint32_t LE_BINDLESS_INDEX_INVALID = uint32_t( ~0 );
+
 // specifies parameters for an image write operation.
 struct le_write_to_image_settings_t {
 	uint32_t image_w         = 0; // image (slice) width in texels
@@ -1071,6 +1123,53 @@ struct le_write_to_image_settings_t {
 	uint32_t num_miplevels   = 1; // number of miplevels to auto-generate (default 1 - more than one means to auto-generate miplevels)
 };
 
+// Maximum number of characters kept of a renderpass name in le_renderpass_stats_t,
+// not counting the terminating '\0'.
+constexpr uint32_t LE_RENDERPASS_STATS_DEBUG_NAME_MAX_LEN = 32;
+
+// Per-pass statistics, gathered when recording a frame, and - once the frame
+// has come back from the GPU - from gpu timestamp queries.
+struct le_renderpass_stats_t {
+	uint64_t pass_id;                                                  // hash of renderpass name
+	char     debug_name[ LE_RENDERPASS_STATS_DEBUG_NAME_MAX_LEN + 1 ]; // renderpass name, truncated, always '\0'-terminated
+	uint64_t record_time_ns;                                           // cpu time spent in execute callbacks for this pass
+	uint64_t command_count;                                            // number of commands recorded into the pass' command stream
+	uint64_t command_bytes;                                            // size of the pass' command stream in bytes
+	uint64_t gpu_time_ns;                                              // gpu time spent on this pass, 0 if not available
+	uint64_t heap_allocations;                                         // heap allocations made in the encoder path while recording this pass, 0 in steady state
+	uint64_t elided_command_count;                                     // number of redundant commands which the encoder did not record
+	uint64_t argument_bytes_saved;                                     // argument data bytes which were shared with identical, previously written argument data
+};
+
+// Per-frame statistics, available once a frame has been cleared.
+struct le_frame_stats_t {
+	uint64_t frame_number;
+	uint64_t record_time_ns;              // cpu time for renderer record stage
+	uint64_t acquire_time_ns;             // cpu time for renderer acquire stage
+	uint64_t process_time_ns;             // cpu time for renderer process stage
+	uint64_t dispatch_time_ns;            // cpu time for renderer dispatch stage
+	uint64_t gpu_time_ns;                 // sum of gpu time over all passes, 0 if not available
+	uint64_t command_bytes;               // sum of command stream bytes over all passes
+	uint64_t peak_command_bytes;          // largest command stream recorded by any single pass
+	uint64_t heap_allocations;            // sum of encoder path heap allocations over all passes, 0 in steady state
+	uint64_t argument_bytes_saved;        // sum of argument data bytes saved by deduplication over all passes
+	uint64_t descriptor_set_cache_hits;   // descriptor sets re-used from an earlier frame
+	uint64_t descriptor_set_cache_misses; // descriptor sets which had to be allocated and written
+	uint64_t transient_bytes_used;        // bytes allocated from transient allocators, over all allocators
+	uint64_t transient_bytes_capacity;    // capacity of transient allocators, over all allocators and their blocks
+	uint64_t staging_bytes;               // bytes uploaded via staging memory
+	uint64_t staging_dedicated_bytes;     // bytes uploaded via dedicated staging allocations, because they did not fit the staging ring
+	uint32_t transient_block_count;       // number of blocks held by transient allocators - more than one per allocator means overflow
+	uint32_t staging_dedicated_count;     // number of uploads which needed dedicated staging allocations
+	uint32_t pass_count;                  // number of passes for which stats were recorded
+	uint32_t latency_frames;              // number of renderer updates between recording this frame and recycling its resources
+};
+
+enum class LeRendererStatsFormat : uint32_t {
+	eCSV = 0,
+	eJSON,
+};
+
 namespace le {
 using Presentmode = le_swapchain_settings_t::khr_settings_t::Presentmode;
 
@@ -1212,6 +1311,9 @@ class RendererInfoBuilder {
 		return mSwapchainInfoBuilder;
 	}
 
+	BUILDER_IMPLEMENT( RendererInfoBuilder, setPipelineDepth, uint32_t, pipeline_depth, = 3 )
+	BUILDER_IMPLEMENT( RendererInfoBuilder, setBindlessDescriptors, bool, bindless_descriptors, = true )
+
 	le_renderer_settings_t const &build() {
 
 		// Do some checks:
@@ -1576,6 +1678,7 @@ enum class CommandType : uint32_t {
 	eBindRtxPipeline,
 	eWriteToBuffer,
 	eWriteToImage,
+	eNextChunk, // not a rendering command: marks that the command stream continues in another chunk
 };
 
 struct CommandHeader {
@@ -1588,6 +1691,34 @@ struct CommandHeader {
 	} info;
 };
 
+// Builds a 64bit sort key for draw items recorded into an encoder draw list.
+// Items are sorted by pipeline first, then by arguments, vertex buffers, and finally depth,
+// so that draws which share state end up next to each other.
+constexpr uint64_t make_draw_sort_key( uint16_t pipeline_bits, uint16_t argument_bits, uint16_t vertex_buffer_bits, uint16_t depth_bits ) noexcept {
+	return ( uint64_t( pipeline_bits ) << 48 ) |
+	       ( uint64_t( argument_bits ) << 32 ) |
+	       ( uint64_t( vertex_buffer_bits ) << 16 ) |
+	       ( uint64_t( depth_bits ) );
+}
+
+// Folds a 64bit value (a hash, or a handle) into 16 bits, for use with make_draw_sort_key.
+constexpr uint16_t draw_sort_key_bits( uint64_t value ) noexcept {
+	return uint16_t( value ^ ( value >> 16 ) ^ ( value >> 32 ) ^ ( value >> 48 ) );
+}
+
+// Placed by the encoder at the end of a command stream chunk, if the
+// command stream continues in another chunk. Consumers of a command stream
+// must continue reading at `next_chunk`.
+//
+// Note: This command does not count towards the number of commands, or number
+// of bytes, which an encoder reports for its command stream.
+struct CommandNextChunk {
+	CommandHeader header = { { { CommandType::eNextChunk, sizeof( CommandNextChunk ) } } };
+	struct {
+		void *next_chunk; // address of first command in next chunk
+	} info;
+};
+
 struct CommandDrawIndexed {
 	CommandHeader header = { { { CommandType::eDrawIndexed, sizeof( CommandDrawIndexed ) } } };
 	struct {
@@ -1795,6 +1926,7 @@ struct CommandWriteToImage {
 	struct {
 		le_resource_handle_t src_buffer_id;   // le buffer id of scratch buffer
 		le_resource_handle_t dst_image_id;    // which resource to write to
+		uint64_t             src_offset;      // offset in scratch buffer where to find source data
 		uint64_t             numBytes;        // number of bytes
 		uint32_t             image_w;         // target region width in texels
 		uint32_t             image_h;         // target region height in texels
@@ -44,7 +44,7 @@
  * 
 */
 
-constexpr auto RTX_IMAGE_TARGET_HANDLE = LE_IMG_RESOURCE( "rtx_target_img" );
+static const auto RTX_IMAGE_TARGET_HANDLE = LE_IMG_RESOURCE( "rtx_target_img" );
 
 // Wrappers so that we can pass data via opaque pointers across header boundaries
 
@@ -421,13 +421,6 @@ static uint32_t le_stage_create_image_from_memory(
 	res.handle.as_handle.meta.as_meta.type = LeResourceType::eImage;
 	res.handle.as_handle.name_hash         = SpookyHash::Hash32( image_file_memory, image_file_sz, 0 );
 
-#if LE_RESOURCE_LABEL_LENGTH > 0
-	if ( debug_name ) {
-		// Copy debug name if such was given, and handle has debug name field.
-		strncpy( res.debug_name, debug_name, LE_RESOURCE_LABEL_LENGTH - 1 );
-	}
-#endif
-
 	uint32_t image_handle_idx = 0;
 	for ( auto &h : stage->image_handles ) {
 		if ( h == res ) {
@@ -438,6 +431,13 @@ static uint32_t le_stage_create_image_from_memory(
 
 	if ( image_handle_idx == stage->image_handles.size() ) {
 
+#if ( LE_RESOURCE_NAME_REGISTRY )
+		if ( debug_name ) {
+			// Register debug name if such was given - handle name is derived from image contents.
+			le_update_resource_name_table( debug_name, res.handle.as_handle.name_hash );
+		}
+#endif
+
 		stage_image_o *img = new stage_image_o{};
 
 		// We want to find out whether this image uses a 16 bit type.
@@ -578,13 +578,6 @@ static uint32_t le_stage_create_buffer( le_stage_o *stage, void *mem, uint32_t s
 
 	le_resource_handle_t res{};
 
-#if LE_RESOURCE_LABEL_LENGTH > 0
-	if ( debug_name ) {
-		// Copy debug name if such was given, and handle has debug name field.
-		strncpy( res.debug_name, debug_name, LE_RESOURCE_LABEL_LENGTH );
-	}
-#endif
-
 	res.handle.as_handle.name_hash         = SpookyHash::Hash32( mem, sz, 0 );
 	res.handle.as_handle.meta.as_meta.type = LeResourceType::eBuffer;
 
@@ -603,6 +596,13 @@ static uint32_t le_stage_create_buffer( le_stage_o *stage, void *mem, uint32_t s
 		// Buffer with this hash was not yet seen before
 		// - we must allocate a new buffer.
 
+#if ( LE_RESOURCE_NAME_REGISTRY )
+		if ( debug_name ) {
+			// Register debug name if such was given - handle name is derived from buffer contents.
+			le_update_resource_name_table( debug_name, res.handle.as_handle.name_hash );
+		}
+#endif
+
 		le_buffer_o *buffer = new le_buffer_o{};
 
 		buffer->handle = res;
@@ -1820,6 +1820,10 @@ static void pass_draw( le_command_buffer_encoder_o *encoder_, void *user_data )
 	std::vector<glm::mat4> joints_data( 256 );
 	std::vector<glm::mat4> joints_normal_data( 256 );
 
+	// We record primitives into a draw list, so that the encoder may sort draws
+	// by state, and filter out any state changes which become redundant.
+	encoder.beginDrawList();
+
 	for ( le_scene_o const &s : stage->scenes ) {
 		for ( le_node_o *n : stage->nodes ) {
 
@@ -1867,6 +1871,23 @@ static void pass_draw( le_command_buffer_encoder_o *encoder_, void *user_data )
 					mvp_ubo.modelMatrix  = n->global_transform;
 					mvp_ubo.normalMatrix = glm::transpose( n->inverse_global_transform );
 
+					{
+						// Each primitive is a draw item - we sort by pipeline, then material, then vertex
+						// buffers, then front-to-back.
+						float const distance_to_camera =
+						    glm::length( glm::vec3( n->global_transform[ 3 ] ) - glm::vec3( camera_in_world_space ) );
+
+						uint64_t const vertex_buffer_id =
+						    primitive.bindings_buffer_handles.empty() ? 0 : primitive.bindings_buffer_handles[ 0 ].handle.as_data;
+
+						encoder.setDrawSortKey(
+						    le::make_draw_sort_key(
+						        le::draw_sort_key_bits( reinterpret_cast<uint64_t>( primitive.pipeline_state_handle ) ),
+						        le::draw_sort_key_bits( primitive.has_material ? primitive.material_idx + 1 : 0 ),
+						        le::draw_sort_key_bits( vertex_buffer_id ),
+						        uint16_t( std::min( distance_to_camera, 65535.f ) ) ) );
+					}
+
 					encoder
 					    .bindGraphicsPipeline( primitive.pipeline_state_handle )
 					    .setArgumentData( LE_ARGUMENT_NAME( "LightSSBO" ), s.lights.data(), sizeof( le_light_o ) * s.lights.size() )
@@ -1965,6 +1986,8 @@ static void pass_draw( le_command_buffer_encoder_o *encoder_, void *user_data )
 			}
 		}
 	}
+
+	encoder.endDrawList();
 }
 
 // ----------------------------------------------------------------------
@@ -6,6 +6,7 @@ apps_list=("
 	examples/hello_world:Island-HelloWorld
 	examples/hello_triangle:Island-HelloTriangle
 	examples/lut_grading_example:Island-LutGradingExample
+	examples/bindless_example:Island-BindlessExample
 	examples/multi_window_example:Island-MultiWindowExample
 	examples/imgui_example:Island-ImguiExample
 	examples/asterisks:Island-Asterisks
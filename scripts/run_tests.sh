@@ -5,6 +5,7 @@
 apps_list=("
     examples/asterisks:Island-Asterisks
     examples/lut_grading_example:Island-LutGradingExample
+    examples/bindless_example:Island-BindlessExample
     examples/hello_world:Island-HelloWorld
     examples/hello_triangle:Island-HelloTriangle
     examples/imgui_example:Island-ImguiExample